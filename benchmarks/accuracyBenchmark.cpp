@@ -0,0 +1,51 @@
+/**
+    \file
+    \brief runs accuracy harness on long double solver and on adaptive (double) solver
+
+    Corpus is generated from roots (so discriminants are perfect squares and roots are exact) and then
+    coefficients of half of tests are perturbed, so that roots are irrational and cancellation shows up.
+*/
+
+#include <stdio.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/accuracyHarness.hpp"
+#include "../include/adaptiveSolver.hpp"
+#include "../include/corpusGenerator.hpp"
+
+const size_t NUM_OF_TESTS = (size_t)1 << 20;
+
+struct HarnessedSolver {
+    const char*         name;
+    getSolutionsFuncPtr solver;
+};
+
+int main() {
+    CorpusGeneratorConfig config = {};
+    setDefaultCorpusConfig(&config);
+    TestsArena tests = {};
+    if (generateCorpusTests(&config, NUM_OF_TESTS, &tests) != QUAD_EQ_ERRORS_OK)
+        return 1;
+
+    // odd tests get slightly changed c, their answers are taken from __float128 reference anyway
+    uint64_t randomState = 2024;
+    for (size_t i = 1; i < tests.count; i += 2)
+        tests.tests[i].equation.c += (long double)getRandomInRange(&randomState, 1, 1000) / 1024;
+
+    const HarnessedSolver solvers[] = {
+        {"getSolutions()",         &getSolutions},
+        {"getSolutionsAdaptive()", &getSolutionsAdaptive},
+    };
+    // verdicts are only printed: benchmark shows where solvers lose precision, it doesn't gate them
+    for (size_t i = 0; i < sizeof(solvers) / sizeof(*solvers); ++i) {
+        AccuracyReport report = {};
+        if (runAccuracyHarness(solvers[i].solver, tests.tests, tests.count, getDefaultAccuracyReference(),
+                               getDefaultAccuracyGate(), &report) != QUAD_EQ_ERRORS_OK)
+            return 1;
+        printf("-------------------- %s --------------------\n", solvers[i].name);
+        printAccuracyReport(&report, stdout);
+    }
+
+    freeTestsArena(&tests);
+    return 0;
+}
@@ -0,0 +1,68 @@
+/**
+    \file
+    \brief compares analyzeEquation() with separate calls of getDiscriminant(), getVertX(), getVertY() and getSolutions()
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/equationAnalysis.hpp"
+
+const size_t NUM_OF_EQUATIONS = 1 << 20;
+const int    NUM_OF_RUNS      = 10;
+
+/// @brief prints one line of results
+static void printResult(const char* name, uint64_t elapsedNs, long double checksum) {
+    double totalEquations = (double)NUM_OF_EQUATIONS * NUM_OF_RUNS;
+    printf("%-22s %10.2f Meq/s %8.3f ns/eq\n", name,
+           totalEquations / (double)elapsedNs * 1e3, (double)elapsedNs / totalEquations);
+    // checksum is printed, so compiler can not throw computation away
+    fprintf(stderr, "%s checksum: %Lg\n", name, checksum);
+}
+
+int main() {
+    QuadraticEquation* equations = (QuadraticEquation*)calloc(NUM_OF_EQUATIONS, sizeof(QuadraticEquation));
+    if (equations == NULL) {
+        fprintf(stderr, "Error: couldn't allocate memory\n");
+        return 1;
+    }
+
+    // a is never 0, so getVertX() and getVertY() don't report errors
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+        long long a = getRandomInRange(&randomState, 1, 6) * (getRandomInRange(&randomState, 0, 1) ? 1 : -1);
+        equations[i] = {(long double)a, (long double)getRandomInRange(&randomState, -20, 20),
+                        (long double)getRandomInRange(&randomState, -20, 20), DEFAULT_PRECISION};
+    }
+
+    long double checksum = 0;
+    uint64_t start = getMonotonicTimeNs();
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+            long double disc = 0, vertX = 0, vertY = 0;
+            QuadraticEquationAnswer answer = {};
+            getDiscriminant(&equations[i], &disc);
+            getVertX(&equations[i], &vertX);
+            getVertY(&equations[i], &vertY);
+            getSolutions(&equations[i], &answer);
+            checksum += disc + vertX + vertY + answer.root_1;
+        }
+    }
+    printResult("separate calls", getMonotonicTimeNs() - start, checksum);
+
+    checksum = 0;
+    start = getMonotonicTimeNs();
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+            QuadraticEquationAnalysis analysis;
+            analyzeEquation(&equations[i], &analysis);
+            checksum += analysis.discriminant + analysis.vertX + analysis.vertY + analysis.answer.root_1;
+        }
+    }
+    printResult("analyzeEquation", getMonotonicTimeNs() - start, checksum);
+
+    free(equations);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#ifndef BENCHMARK_COMMON_HEADER
+#define BENCHMARK_COMMON_HEADER
+
+/**
+    \file
+    \brief helpers, that are shared between all benchmarks
+*/
+
+#include <stdint.h>
+
+// clock is the same, that autotuning and accuracy harness use
+#include "../include/solverTiming.hpp"
+
+/// @brief fast deterministic pseudo random generator (xorshift64*), so all runs get same input
+static inline uint64_t getNextRandom(uint64_t* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+/// @brief returns random integer from [from, to]
+static inline long long getRandomInRange(uint64_t* state, long long from, long long to) {
+    return from + (long long)(getNextRandom(state) % (uint64_t)(to - from + 1));
+}
+
+#endif
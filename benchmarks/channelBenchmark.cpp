@@ -0,0 +1,158 @@
+/**
+    \file
+    \brief compares shared memory channel with running libRun for every equation
+
+    Solver is started in child process, benchmark submits equations to it one by one (round trip latency,
+    p50, p99, p999) and many at once (throughput). Then libRun -u is executed for every equation
+    and it's stdout is read, as producers did before channel.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <algorithm>
+
+#include "benchmarkCommon.hpp"
+#include "../include/sharedChannel.hpp"
+
+const char*  CHANNEL_NAME             = "/quadraticSolverBenchmark";
+const char*  LIB_RUN_PATH             = "./building/libRun";
+const size_t NUM_OF_SINGLE_REQUESTS   = 200000;
+const size_t NUM_OF_WARMUP_REQUESTS   = 10000;
+const size_t NUM_OF_PIPELINED         = 1 << 21;
+/// @brief number of equations, that are submitted before first answer is waited
+const size_t PIPELINE_DEPTH           = 1 << 10;
+const size_t NUM_OF_EXEC_REQUESTS     = 200;
+
+/// @brief runs solver of channel in child process, parent submits equations through the same mapping
+static pid_t startSolver(SharedChannel* channel) {
+    pid_t pid = fork();
+    if (pid != 0)
+        return pid;
+
+    QuadEqErrors error = runSharedChannelSolver(channel, NULL);
+    closeSharedChannel(channel);
+    _exit(error == QUAD_EQ_ERRORS_OK ? 0 : 1);
+}
+
+static QuadraticEquation getRandomEquation(uint64_t* randomState) {
+    QuadraticEquation eq = {};
+    eq.a = (long double)getRandomInRange(randomState, -3, 3);
+    eq.b = (long double)getRandomInRange(randomState, -20, 20);
+    eq.c = (long double)getRandomInRange(randomState, -20, 20);
+    eq.outputPrecision = DEFAULT_PRECISION;
+    return eq;
+}
+
+/// @brief prints percentiles of sorted latencies
+static void printLatencies(const char* name, uint64_t* latencies, size_t count) {
+    std::sort(latencies, latencies + count);
+    printf("%-24s %7zu requests  p50 %9.2f us  p99 %9.2f us  p999 %9.2f us\n", name, count,
+           (double)latencies[count / 2]           / 1e3,
+           (double)latencies[count * 99  / 100]   / 1e3,
+           (double)latencies[count * 999 / 1000]  / 1e3);
+}
+
+static bool measureChannelLatency(SharedChannel* channel) {
+    uint64_t* latencies = (uint64_t*)calloc(NUM_OF_SINGLE_REQUESTS, sizeof(uint64_t));
+    if (latencies == NULL)
+        return false;
+
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_WARMUP_REQUESTS + NUM_OF_SINGLE_REQUESTS; ++i) {
+        QuadraticEquation       eq     = getRandomEquation(&randomState);
+        QuadraticEquationAnswer answer = {};
+        uint64_t start = getMonotonicTimeNs();
+        if (solveOnSharedChannel(channel, &eq, &answer) != QUAD_EQ_ERRORS_OK) {
+            free(latencies);
+            return false;
+        }
+        if (i >= NUM_OF_WARMUP_REQUESTS)
+            latencies[i - NUM_OF_WARMUP_REQUESTS] = getMonotonicTimeNs() - start;
+    }
+
+    printLatencies("shared channel", latencies, NUM_OF_SINGLE_REQUESTS);
+    free(latencies);
+    return true;
+}
+
+/// @brief keeps PIPELINE_DEPTH equations submitted, answers are taken in order of tickets
+static bool measureChannelThroughput(SharedChannel* channel) {
+    uint64_t* tickets = (uint64_t*)calloc(PIPELINE_DEPTH, sizeof(uint64_t));
+    if (tickets == NULL)
+        return false;
+
+    uint64_t randomState = 2024;
+    bool isOk = true;
+    uint64_t start = getMonotonicTimeNs();
+    for (size_t i = 0; isOk && i < NUM_OF_PIPELINED + PIPELINE_DEPTH; ++i) {
+        if (i >= PIPELINE_DEPTH) {
+            QuadraticEquationAnswer answer = {};
+            isOk = waitSharedChannelAnswer(channel, tickets[i % PIPELINE_DEPTH], &answer) == QUAD_EQ_ERRORS_OK;
+        }
+        if (isOk && i < NUM_OF_PIPELINED) {
+            QuadraticEquation eq = getRandomEquation(&randomState);
+            isOk = submitToSharedChannel(channel, &eq, &tickets[i % PIPELINE_DEPTH]) == QUAD_EQ_ERRORS_OK;
+        }
+    }
+    uint64_t elapsedNs = getMonotonicTimeNs() - start;
+    if (isOk)
+        printf("shared channel, %zu in flight  %10.2f Meq/s\n", PIPELINE_DEPTH,
+               (double)NUM_OF_PIPELINED / (double)elapsedNs * 1e3);
+
+    free(tickets);
+    return isOk;
+}
+
+/// @brief runs libRun for every equation and reads it's whole stdout
+static bool measureExecLatency() {
+    if (access(LIB_RUN_PATH, X_OK) != 0) {
+        printf("%s is not built, exec per equation is not measured\n", LIB_RUN_PATH);
+        return true;
+    }
+
+    uint64_t latencies[NUM_OF_EXEC_REQUESTS] = {};
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_EXEC_REQUESTS; ++i) {
+        QuadraticEquation eq = getRandomEquation(&randomState);
+        char command[256] = {};
+        snprintf(command, sizeof(command), "%s -u \"%Lg %Lg %Lg\" </dev/null 2>/dev/null", LIB_RUN_PATH, eq.a, eq.b, eq.c);
+
+        uint64_t start = getMonotonicTimeNs();
+        FILE* output = popen(command, "r");
+        if (output == NULL)
+            return false;
+        char buffer[4096] = {};
+        while (fread(buffer, 1, sizeof(buffer), output) != 0)
+            ;
+        pclose(output);
+        latencies[i] = getMonotonicTimeNs() - start;
+    }
+
+    printLatencies("exec per equation", latencies, NUM_OF_EXEC_REQUESTS);
+    return true;
+}
+
+int main() {
+    // channel is created before fork, so producer never sees it half initialized
+    SharedChannel channel = {};
+    if (createSharedChannel(CHANNEL_NAME, SHARED_CHANNEL_DEFAULT_CAPACITY, &channel) != QUAD_EQ_ERRORS_OK)
+        return 1;
+    pid_t solver = startSolver(&channel);
+    if (solver == -1) {
+        fprintf(stderr, "Error: couldn't start solver\n");
+        closeSharedChannel(&channel);
+        return 1;
+    }
+
+    bool isOk = measureChannelLatency(&channel) && measureChannelThroughput(&channel);
+    if (!isOk)
+        fprintf(stderr, "Error: requests to channel failed\n");
+    kill(solver, SIGTERM);
+    waitpid(solver, NULL, 0);
+    closeSharedChannel(&channel);
+
+    return isOk && measureExecLatency() ? 0 : 1;
+}
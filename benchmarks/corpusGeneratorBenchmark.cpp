@@ -0,0 +1,95 @@
+/**
+    \file
+    \brief measures speed of corpus generator: sampling only, text corpus and binary corpus
+
+    Corpora are written to /tmp and loaded back by loadTestsFile(), so speed of loading of both formats is printed too.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/corpusGenerator.hpp"
+#include "../include/testsLoader.hpp"
+
+const size_t NUM_OF_TESTS = (size_t)1 << 20;
+const int    NUM_OF_RUNS  = 3;
+const char*  TEXT_FILE    = "/tmp/corpusGeneratorBenchmark.txt";
+const char*  BINARY_FILE  = "/tmp/corpusGeneratorBenchmark.bin";
+
+static void printResult(const char* name, uint64_t elapsedNs) {
+    printf("%-24s %8.1f ms %8.2f Mtests/s\n", name, (double)elapsedNs / 1e6,
+           (double)NUM_OF_TESTS / (double)elapsedNs * 1e3);
+}
+
+/// @brief generates records without writing them anywhere
+static uint64_t measureSampling(const CorpusGeneratorConfig* config) {
+    CorpusGenerator generator = {};
+    initCorpusGenerator(&generator, config);
+
+    double checksum = 0;
+    uint64_t start = getMonotonicTimeNs();
+    for (size_t i = 0; i < NUM_OF_TESTS; ++i) {
+        CorpusRecord record = {};
+        generateCorpusRecord(&generator, &record);
+        checksum += record.b;
+    }
+    uint64_t elapsedNs = getMonotonicTimeNs() - start;
+    // checksum is printed, so compiler doesn't throw loop away
+    if (checksum == 0.5)
+        printf("checksum %g\n", checksum);
+    return elapsedNs;
+}
+
+static uint64_t measureWriting(const CorpusGeneratorConfig* config, CorpusFormat format, const char* fileName) {
+    ResultWriter output = {};
+    uint64_t start = getMonotonicTimeNs();
+    if (openResultWriter(fileName, &output) != QUAD_EQ_ERRORS_OK ||
+        writeCorpus(config, NUM_OF_TESTS, format, &output, NULL) != QUAD_EQ_ERRORS_OK ||
+        closeResultWriter(&output) != QUAD_EQ_ERRORS_OK) {
+        fprintf(stderr, "Error: couldn't write %s\n", fileName);
+        exit(1);
+    }
+    return getMonotonicTimeNs() - start;
+}
+
+static uint64_t measureLoading(const char* fileName) {
+    TestsArena arena = {};
+    uint64_t start = getMonotonicTimeNs();
+    QuadEqErrors error = loadTestsFile(fileName, NULL, &arena);
+    uint64_t elapsedNs = getMonotonicTimeNs() - start;
+    if (error != QUAD_EQ_ERRORS_OK || arena.count != NUM_OF_TESTS) {
+        fprintf(stderr, "Error: loaded %zu tests of %zu from %s\n", arena.count, NUM_OF_TESTS, fileName);
+        exit(1);
+    }
+    freeTestsArena(&arena);
+    return elapsedNs;
+}
+
+int main() {
+    CorpusGeneratorConfig config = {};
+    setDefaultCorpusConfig(&config);
+
+    uint64_t bestNs[5] = {UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX};
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        uint64_t elapsedNs[5] = {
+            measureSampling(&config),
+            measureWriting (&config, CORPUS_FORMAT_TEXT,   TEXT_FILE),
+            measureWriting (&config, CORPUS_FORMAT_BINARY, BINARY_FILE),
+            measureLoading (TEXT_FILE),
+            measureLoading (BINARY_FILE),
+        };
+        for (int i = 0; i < 5; ++i)
+            bestNs[i] = elapsedNs[i] < bestNs[i] ? elapsedNs[i] : bestNs[i];
+    }
+
+    printResult("generateCorpusRecord()", bestNs[0]);
+    printResult("text corpus",            bestNs[1]);
+    printResult("binary corpus",          bestNs[2]);
+    printResult("load text corpus",       bestNs[3]);
+    printResult("load binary corpus",     bestNs[4]);
+
+    remove(TEXT_FILE);
+    remove(BINARY_FILE);
+    return 0;
+}
@@ -0,0 +1,52 @@
+/**
+    \file
+    \brief compares time, that calling thread spends in synchronous and asynchronous logging
+
+    Log goes to /dev/null, so only cost of call on calling thread is measured.
+    Calls are made in groups, that fit into ring, and logger is flushed between groups, so nothing is dropped.
+*/
+
+#include <stdio.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/asyncLogger.hpp"
+
+const size_t NUM_OF_GROUPS  = 200;
+const size_t GROUP_SIZE     = ASYNC_LOG_RING_CAPACITY;
+
+/// @brief logs NUM_OF_GROUPS groups, returns time spent in calls only
+static uint64_t runLogging() {
+    uint64_t elapsedNs = 0;
+    for (size_t group = 0; group < NUM_OF_GROUPS; ++group) {
+        uint64_t start = getMonotonicTimeNs();
+        for (size_t i = 0; i < GROUP_SIZE; ++i)
+            ASYNC_LOG(ERROR, "equation %zu of group %zu: a = %Lg, b = %Lg, c = %Lg, %s\n",
+                      i, group, (long double)i, 2.0L, -1.5L, "value is too big");
+        elapsedNs += getMonotonicTimeNs() - start;
+        flushAsyncLogger();
+    }
+    return elapsedNs;
+}
+
+static void printResult(const char* name, uint64_t elapsedNs) {
+    printf("%-14s %10.1f ns/call\n", name, (double)elapsedNs / (double)(NUM_OF_GROUPS * GROUP_SIZE));
+}
+
+int main() {
+    if (freopen("/dev/null", "w", stderr) == NULL) {
+        printf("Error: couldn't open /dev/null\n");
+        return 1;
+    }
+    setLoggingLevel(DEBUG);
+
+    printResult("synchronous", runLogging());
+
+    if (!startAsyncLogger()) {
+        printf("Error: couldn't start logger thread\n");
+        return 1;
+    }
+    printResult("asynchronous", runLogging());
+    printf("dropped records: %lu\n", (unsigned long)getAsyncLoggerDropped());
+    destructAsyncLogger();
+    return 0;
+}
@@ -0,0 +1,161 @@
+/**
+    \file
+    \brief measures throughput (MB/s) of input parsing
+
+    Big file with records "a b c" is generated, then it's parsed by old path (fgets() into buffer + strtod())
+    and by mmap reader with from_chars() parser. End to end batch mode (parsing + solving + printing) is measured too.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/mappedInput.hpp"
+#include "../include/batchMode.hpp"
+
+const size_t NUM_OF_RECORDS = 2000000;
+const int    NUM_OF_RUNS    = 3;
+const char*  SEPARATORS     = " \t\r\n,";
+
+/// @brief prints one line of results, best run is taken
+static void printResult(const char* name, size_t fileSize, uint64_t bestNs, long double checksum) {
+    printf("%-28s %10.2f MB/s %8.3f ns/record\n", name,
+           (double)fileSize / (double)bestNs * 1e3, (double)bestNs / (double)NUM_OF_RECORDS);
+    // checksum is printed, so compiler can not throw parsing away
+    fprintf(stderr, "%s checksum: %Lg\n", name, checksum);
+}
+
+/// @brief generates file with random records, returns it's size
+static size_t generateInput(const char* fileName) {
+    FILE* file = fopen(fileName, "w");
+    if (file == NULL)
+        return 0;
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < NUM_OF_RECORDS; ++i) {
+        double a = (double)getRandomInRange(&state, -1000000, 1000000) / 1000;
+        double b = (double)getRandomInRange(&state, -1000000, 1000000) / 1000;
+        double c = (double)getRandomInRange(&state, -1000000, 1000000) / 1000;
+        fprintf(file, "%.17g %.17g %.17g\n", a, b, c);
+    }
+
+    long size = ftell(file);
+    fclose(file);
+    return size < 0 ? 0 : (size_t)size;
+}
+
+/// @brief old path: line is read by fgets() into buffer and numbers are parsed by strtod()
+static long double parseWithFgets(const char* fileName) {
+    FILE* file = fopen(fileName, "r");
+    if (file == NULL)
+        return 0;
+
+    long double checksum = 0;
+    char line[256] = {};
+    while (fgets(line, sizeof(line), file)) {
+        char* savePtr = NULL;
+        for (char* word = strtok_r(line, SEPARATORS, &savePtr); word != NULL;
+                   word = strtok_r(NULL, SEPARATORS, &savePtr))
+            checksum += strtod(word, NULL);
+    }
+
+    fclose(file);
+    return checksum;
+}
+
+/// @brief new path: lines are taken from mapping without copying and numbers are parsed by parseNumberFast()
+static long double parseWithMmap(const char* fileName) {
+    MappedInput input = {};
+    if (openMappedInput(fileName, &input) != QUAD_EQ_ERRORS_OK)
+        return 0;
+
+    long double checksum = 0;
+    while (true) {
+        const char* begin = NULL;
+        const char* end   = NULL;
+        bool isEnd = false;
+        if (readMappedLine(&input, &begin, &end, &isEnd) != QUAD_EQ_ERRORS_OK || isEnd)
+            break;
+
+        while (begin < end) {
+            while (begin < end && strchr(SEPARATORS, *begin) != NULL)
+                ++begin;
+            const char* wordEnd = begin;
+            while (wordEnd < end && strchr(SEPARATORS, *wordEnd) == NULL)
+                ++wordEnd;
+
+            long double number = 0;
+            bool isOk = false;
+            parseNumberFast(begin, wordEnd, &number, &isOk);
+            checksum += number;
+            begin = wordEnd;
+        }
+    }
+
+    closeMappedInput(&input);
+    return checksum;
+}
+
+/// @brief batch mode reading through stream
+static long double runBatchOnStream(const char* fileName) {
+    FILE* input = fopen(fileName, "r");
+    ResultWriter output = {};
+    BatchModeStats stats = {};
+    if (input != NULL && openResultWriter("/dev/null", &output) == QUAD_EQ_ERRORS_OK) {
+        runBatchMode(input, &output, DEFAULT_PRECISION, NULL, &stats);
+        closeResultWriter(&output);
+    }
+    if (input != NULL) fclose(input);
+    return (long double)stats.numOfRecords;
+}
+
+/// @brief batch mode reading through mmap
+static long double runBatchOnMapping(const char* fileName) {
+    ResultWriter output = {};
+    BatchModeStats stats = {};
+    if (openResultWriter("/dev/null", &output) == QUAD_EQ_ERRORS_OK) {
+        runBatchModeOnFile(fileName, &output, DEFAULT_PRECISION, NULL, &stats);
+        closeResultWriter(&output);
+    }
+    return (long double)stats.numOfRecords;
+}
+
+/// @brief runs parser several times and prints best time
+static void benchmarkParser(const char* name, const char* fileName, size_t fileSize,
+                            long double (*parser)(const char* fileName)) {
+    uint64_t bestNs = UINT64_MAX;
+    long double checksum = 0;
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        uint64_t start = getMonotonicTimeNs();
+        checksum = parser(fileName);
+        uint64_t elapsed = getMonotonicTimeNs() - start;
+        if (elapsed < bestNs)
+            bestNs = elapsed;
+    }
+    printResult(name, fileSize, bestNs, checksum);
+}
+
+int main() {
+    char fileName[] = "/tmp/quadParserBenchXXXXXX";
+    int fd = mkstemp(fileName);
+    if (fd == -1) {
+        fprintf(stderr, "Error: couldn't create temporary file\n");
+        return 1;
+    }
+    close(fd);
+
+    size_t fileSize = generateInput(fileName);
+    printf("%zu records, %.2f MB, best of %d runs (file is in page cache)\n",
+           NUM_OF_RECORDS, (double)fileSize / 1e6, NUM_OF_RUNS);
+
+    benchmarkParser("fgets + strtod",         fileName, fileSize, parseWithFgets);
+    benchmarkParser("mmap + from_chars",      fileName, fileSize, parseWithMmap);
+    benchmarkParser("batch mode, stream",     fileName, fileSize, runBatchOnStream);
+    benchmarkParser("batch mode, mmap",       fileName, fileSize, runBatchOnMapping);
+
+    remove(fileName);
+    return 0;
+}
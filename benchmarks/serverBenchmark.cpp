@@ -0,0 +1,139 @@
+/**
+    \file
+    \brief measures latency and throughput of solver server
+
+    Server is started in child process, benchmark connects to it and measures round trip time of requests
+    with one equation (p50, p99, p999) and throughput of big requests.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <algorithm>
+#include <thread>
+
+#include "benchmarkCommon.hpp"
+#include "../include/solverServer.hpp"
+
+const char*  SOCKET_PATH            = "/tmp/quadraticSolverBenchmark.sock";
+const size_t NUM_OF_SINGLE_REQUESTS = 200000;
+const size_t NUM_OF_WARMUP_REQUESTS = 10000;
+const size_t BIG_REQUEST_SIZE       = 1 << 20;
+const int    NUM_OF_BIG_RUNS        = 10;
+/// @brief how long benchmark waits for server to create socket
+const int    MAX_CONNECT_ATTEMPTS   = 1000;
+
+/// @brief runs server in child process
+static pid_t startServer() {
+    pid_t pid = fork();
+    if (pid != 0)
+        return pid;
+
+    ThreadPool* pool = NULL;
+    createThreadPool(std::thread::hardware_concurrency(), &pool);
+    QuadEqErrors error = runSolverServer(SOCKET_PATH, pool);
+    destroyThreadPool(pool);
+    _exit(error == QUAD_EQ_ERRORS_OK ? 0 : 1);
+}
+
+static int connectWithRetries() {
+    for (int attempt = 0; attempt < MAX_CONNECT_ATTEMPTS; ++attempt) {
+        int fd = -1;
+        if (access(SOCKET_PATH, F_OK) == 0 && connectToSolverServer(SOCKET_PATH, &fd) == QUAD_EQ_ERRORS_OK)
+            return fd;
+        usleep(1000);
+    }
+    return -1;
+}
+
+/// @brief prints percentiles of round trip time of requests with one equation
+static bool measureLatency(int fd) {
+    uint64_t* latencies = (uint64_t*)calloc(NUM_OF_SINGLE_REQUESTS, sizeof(uint64_t));
+    if (latencies == NULL)
+        return false;
+
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_WARMUP_REQUESTS + NUM_OF_SINGLE_REQUESTS; ++i) {
+        double a = (double)getRandomInRange(&randomState, -3, 3);
+        double b = (double)getRandomInRange(&randomState, -20, 20);
+        double c = (double)getRandomInRange(&randomState, -20, 20);
+        double root_1 = 0, root_2 = 0;
+        QuadEqRootState numOfSols = NO_ROOTS;
+        QuadraticEquationDoubleBatch       batch  = {1, &a, &b, &c};
+        QuadraticEquationDoubleBatchAnswer answer = {&root_1, &root_2, &numOfSols};
+
+        uint64_t start = getMonotonicTimeNs();
+        if (solveOnSolverServer(fd, &batch, &answer) != QUAD_EQ_ERRORS_OK) {
+            free(latencies);
+            return false;
+        }
+        if (i >= NUM_OF_WARMUP_REQUESTS)
+            latencies[i - NUM_OF_WARMUP_REQUESTS] = getMonotonicTimeNs() - start;
+    }
+
+    std::sort(latencies, latencies + NUM_OF_SINGLE_REQUESTS);
+    printf("1 equation per request   %zu requests  p50 %7.2f us  p99 %7.2f us  p999 %7.2f us\n",
+           NUM_OF_SINGLE_REQUESTS,
+           (double)latencies[NUM_OF_SINGLE_REQUESTS / 2]                   / 1e3,
+           (double)latencies[NUM_OF_SINGLE_REQUESTS * 99  / 100]           / 1e3,
+           (double)latencies[NUM_OF_SINGLE_REQUESTS * 999 / 1000]          / 1e3);
+    free(latencies);
+    return true;
+}
+
+/// @brief prints throughput of requests with BIG_REQUEST_SIZE equations
+static bool measureThroughput(int fd) {
+    double*          a         = (double*)calloc(BIG_REQUEST_SIZE, sizeof(double));
+    double*          b         = (double*)calloc(BIG_REQUEST_SIZE, sizeof(double));
+    double*          c         = (double*)calloc(BIG_REQUEST_SIZE, sizeof(double));
+    double*          root_1    = (double*)calloc(BIG_REQUEST_SIZE, sizeof(double));
+    double*          root_2    = (double*)calloc(BIG_REQUEST_SIZE, sizeof(double));
+    QuadEqRootState* numOfSols = (QuadEqRootState*)calloc(BIG_REQUEST_SIZE, sizeof(QuadEqRootState));
+    bool isOk = a != NULL && b != NULL && c != NULL && root_1 != NULL && root_2 != NULL && numOfSols != NULL;
+
+    uint64_t randomState = 2024;
+    for (size_t i = 0; isOk && i < BIG_REQUEST_SIZE; ++i) {
+        a[i] = (double)getRandomInRange(&randomState, -3, 3);
+        b[i] = (double)getRandomInRange(&randomState, -20, 20);
+        c[i] = (double)getRandomInRange(&randomState, -20, 20);
+    }
+
+    QuadraticEquationDoubleBatch       batch  = {BIG_REQUEST_SIZE, a, b, c};
+    QuadraticEquationDoubleBatchAnswer answer = {root_1, root_2, numOfSols};
+    uint64_t start = getMonotonicTimeNs();
+    for (int run = 0; isOk && run < NUM_OF_BIG_RUNS; ++run)
+        isOk = solveOnSolverServer(fd, &batch, &answer) == QUAD_EQ_ERRORS_OK;
+    uint64_t elapsedNs = getMonotonicTimeNs() - start;
+    if (isOk)
+        printf("%zu equations per request  %10.2f Meq/s  %7.2f ms per request\n", BIG_REQUEST_SIZE,
+               (double)BIG_REQUEST_SIZE * NUM_OF_BIG_RUNS / (double)elapsedNs * 1e3,
+               (double)elapsedNs / NUM_OF_BIG_RUNS / 1e6);
+
+    free(a);
+    free(b);
+    free(c);
+    free(root_1);
+    free(root_2);
+    free(numOfSols);
+    return isOk;
+}
+
+int main() {
+    pid_t server = startServer();
+    if (server == -1) {
+        fprintf(stderr, "Error: couldn't start server\n");
+        return 1;
+    }
+
+    int fd = connectWithRetries();
+    bool isOk = fd != -1 && measureLatency(fd) && measureThroughput(fd);
+    if (!isOk)
+        fprintf(stderr, "Error: requests to server failed\n");
+
+    disconnectFromSolverServer(fd);
+    kill(server, SIGTERM);
+    waitpid(server, NULL, 0);
+    return isOk ? 0 : 1;
+}
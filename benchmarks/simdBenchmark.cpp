@@ -0,0 +1,127 @@
+/**
+    \file
+    \brief measures equations/second of vectorized solver for each supported instruction set
+
+    Scalar long double solver (getSolutions() and getSolutionsBatch()) and
+    all precision instantiations of solver core are measured too, for comparison.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/quadraticEquationSimd.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/adaptiveSolver.hpp"
+
+const size_t NUM_OF_EQUATIONS = 1 << 20;
+const int    NUM_OF_RUNS      = 20;
+
+/// @brief prints one line of results
+static void printResult(const char* name, uint64_t elapsedNs) {
+    double totalEquations = (double)NUM_OF_EQUATIONS * NUM_OF_RUNS;
+    printf("%-24s %10.2f Meq/s %8.3f ns/eq\n", name,
+           totalEquations / (double)elapsedNs * 1e3, (double)elapsedNs / totalEquations);
+}
+
+/// @brief measures getSolutionsT() instantiation for given coefficient type
+template <typename Scalar>
+static void benchmarkPrecision(const char* name, const long double* a, const long double* b, const long double* c) {
+    uint64_t start = getMonotonicTimeNs();
+    Scalar checksum = 0;
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+            QuadraticEquationT<Scalar> eq = {(Scalar)a[i], (Scalar)b[i], (Scalar)c[i]};
+            QuadraticEquationAnswerT<Scalar> result = {};
+            getSolutionsT<Scalar>(&eq, &result);
+            checksum += result.root_1;
+        }
+    }
+    printResult(name, getMonotonicTimeNs() - start);
+    // checksum is printed, so compiler can not throw solving away
+    fprintf(stderr, "%s checksum: %Lg\n", name, (long double)checksum);
+}
+
+int main() {
+    double*          a         = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    double*          b         = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    double*          c         = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    double*          root_1    = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    double*          root_2    = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    QuadEqRootState* numOfSols = (QuadEqRootState*)calloc(NUM_OF_EQUATIONS, sizeof(QuadEqRootState));
+    long double*     aLong     = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     bLong     = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     cLong     = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     rootLong1 = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     rootLong2 = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    if (a == NULL || b == NULL || c == NULL || root_1 == NULL || root_2 == NULL || numOfSols == NULL ||
+        aLong == NULL || bLong == NULL || cLong == NULL || rootLong1 == NULL || rootLong2 == NULL) {
+        fprintf(stderr, "Error: couldn't allocate memory\n");
+        return 1;
+    }
+
+    // small integer coefficients give mix of all cases (including linear ones)
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+        a[i] = (double)getRandomInRange(&randomState, -3, 3);
+        b[i] = (double)getRandomInRange(&randomState, -20, 20);
+        c[i] = (double)getRandomInRange(&randomState, -20, 20);
+        aLong[i] = (long double)a[i];
+        bLong[i] = (long double)b[i];
+        cLong[i] = (long double)c[i];
+    }
+
+    QuadraticEquationDoubleBatch       batch  = {NUM_OF_EQUATIONS, a, b, c};
+    QuadraticEquationDoubleBatchAnswer answer = {root_1, root_2, numOfSols};
+
+    printf("Supported instruction set: %s\n", getSimdLevelName(getSupportedSimdLevel()));
+    for (int level = SIMD_LEVEL_SCALAR; level <= getSupportedSimdLevel(); ++level) {
+        setSimdLevel((SimdLevel)level);
+        getSolutionsBatchSimd(&batch, &answer); // warmup
+
+        uint64_t start = getMonotonicTimeNs();
+        for (int run = 0; run < NUM_OF_RUNS; ++run)
+            getSolutionsBatchSimd(&batch, &answer);
+        printResult(getSimdLevelName((SimdLevel)level), getMonotonicTimeNs() - start);
+    }
+
+    QuadraticEquationBatch       batchLong  = {NUM_OF_EQUATIONS, aLong, bLong, cLong};
+    QuadraticEquationBatchAnswer answerLong = {rootLong1, rootLong2, numOfSols};
+    uint64_t start = getMonotonicTimeNs();
+    for (int run = 0; run < NUM_OF_RUNS; ++run)
+        getSolutionsBatch(&batchLong, &answerLong);
+    printResult("long double batch", getMonotonicTimeNs() - start);
+
+    start = getMonotonicTimeNs();
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+            QuadraticEquation eq = {aLong[i], bLong[i], cLong[i], DEFAULT_PRECISION};
+            QuadraticEquationAnswer result = {};
+            getSolutions(&eq, &result);
+        }
+    }
+    printResult("long double getSolutions", getMonotonicTimeNs() - start);
+
+    start = getMonotonicTimeNs();
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+            QuadraticEquation eq = {aLong[i], bLong[i], cLong[i], DEFAULT_PRECISION};
+            QuadraticEquationAnswer result = {};
+            getSolutionsAdaptive(&eq, &result);
+        }
+    }
+    printResult("adaptive getSolutions", getMonotonicTimeNs() - start);
+    printAdaptiveSolverStats(stdout);
+
+    benchmarkPrecision<float>      ("core float",       aLong, bLong, cLong);
+    benchmarkPrecision<double>     ("core double",      aLong, bLong, cLong);
+    benchmarkPrecision<long double>("core long double", aLong, bLong, cLong);
+#ifdef QUAD_SOLVER_HAS_FLOAT128
+    benchmarkPrecision<__float128> ("core __float128",  aLong, bLong, cLong);
+#endif
+
+    free(a); free(b); free(c); free(root_1); free(root_2); free(numOfSols);
+    free(aLong); free(bLong); free(cLong); free(rootLong1); free(rootLong2);
+    return 0;
+}
@@ -0,0 +1,45 @@
+/**
+    \file
+    \brief measures ns/call and calls/s of solver functions per class of input (see solverMicrobench.hpp)
+
+    Usage: solverBenchmark [json file [repetitions]], table goes to stdout, JSON report (with all samples) to file.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "solverMicrobench.hpp"
+
+const size_t NUM_OF_RESULTS = MICROBENCH_NUM_OF_FUNCTIONS * MICROBENCH_NUM_OF_CLASSES;
+
+int main(int argc, const char* argv[]) {
+    MicrobenchConfig config = getDefaultMicrobenchConfig();
+    const char* jsonFile = argc > 1 ? argv[1] : NULL;
+    if (argc > 2) {
+        int numOfRepetitions = atoi(argv[2]);
+        if (numOfRepetitions < 2 || numOfRepetitions > MICROBENCH_MAX_REPETITIONS) {
+            fprintf(stderr, "Error: number of repetitions should be from 2 to %d\n", MICROBENCH_MAX_REPETITIONS);
+            return 1;
+        }
+        config.numOfRepetitions = numOfRepetitions;
+    }
+
+    static MicrobenchResult results[NUM_OF_RESULTS] = {};
+    if (runMicrobenchSuite(&config, results) != QUAD_EQ_ERRORS_OK) {
+        fprintf(stderr, "Error: couldn't run benchmarks\n");
+        return 1;
+    }
+    printMicrobenchResults(results, NUM_OF_RESULTS, stdout);
+
+    if (jsonFile != NULL) {
+        FILE* file = fopen(jsonFile, "w");
+        if (file == NULL) {
+            fprintf(stderr, "Error: couldn't open %s\n", jsonFile);
+            return 1;
+        }
+        writeMicrobenchJson(results, NUM_OF_RESULTS, &config, file);
+        fclose(file);
+        printf("JSON report is written to %s\n", jsonFile);
+    }
+    return 0;
+}
@@ -0,0 +1,415 @@
+#ifndef SOLVER_MICROBENCH_HEADER
+#define SOLVER_MICROBENCH_HEADER
+
+/**
+    \file
+    \brief microbenchmarks of solver functions per class of input, shared by benchmarks and tools
+
+    Every case is one function (getSolutions(), getDiscriminant(), getPointValue(), parseLongDoubleAndCheckValid(),
+    printSolutions()) on one class of equations (two roots, double root, no roots, linear, degenerate).
+    Inputs of case are MICROBENCH_BATCH_SIZE equations (small enough to stay in cache), one sample is the time
+    of numOfPasses passes over them divided by number of calls. First numOfWarmups samples are thrown away:
+    \code
+    ns per call = elapsed ns / (numOfPasses * MICROBENCH_BATCH_SIZE)
+    \endcode
+    All samples are kept in result and in JSON report (writeMicrobenchJson(), readMicrobenchJson()),
+    so runs can be compared statistically, not only by mean.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/resultWriter.hpp"
+#include "../include/corpusGenerator.hpp"
+
+/// @brief number of equations of one case, they are generated once and reused by every pass
+const size_t MICROBENCH_BATCH_SIZE      = 1024;
+/// @brief maximum number of measured samples of one case
+const int    MICROBENCH_MAX_REPETITIONS = 256;
+/// @brief length of buffer for one coefficient in text form
+const size_t MICROBENCH_COEF_MAX_LEN    = 48;
+/// @brief version of JSON report, reports of other versions should not be compared
+const int    MICROBENCH_JSON_VERSION    = 1;
+
+/// @brief measured functions
+enum MicrobenchFunction {
+    MICROBENCH_GET_SOLUTIONS    = 0,
+    MICROBENCH_GET_DISCRIMINANT = 1,
+    MICROBENCH_GET_POINT_VALUE  = 2,
+    MICROBENCH_PARSE_COEF       = 3, ///< one call parses one coefficient
+    MICROBENCH_PRINT_SOLUTIONS  = 4, ///< answers are formatted into ResultWriter over /dev/null
+    MICROBENCH_NUM_OF_FUNCTIONS = 5,
+};
+
+/// @brief classes of input
+enum MicrobenchClass {
+    MICROBENCH_TWO_ROOTS        = 0,
+    MICROBENCH_DOUBLE_ROOT      = 1,
+    MICROBENCH_NO_ROOTS         = 2,
+    MICROBENCH_LINEAR           = 3, ///< a = 0 (1 of CORPUS_LINEAR_NO_ROOTS_RATE has b = 0 too)
+    MICROBENCH_DEGENERATE       = 4, ///< a = b = 0, every second equation has c = 0 (infinitely many roots)
+    MICROBENCH_NUM_OF_CLASSES   = 5,
+};
+
+const char* const MICROBENCH_FUNCTION_NAMES[MICROBENCH_NUM_OF_FUNCTIONS] = {
+    "getSolutions", "getDiscriminant", "getPointValue", "parseLongDoubleAndCheckValid", "printSolutions"};
+const char* const MICROBENCH_CLASS_NAMES[MICROBENCH_NUM_OF_CLASSES] = {
+    "two_roots", "double_root", "no_roots", "linear", "degenerate"};
+
+/// @brief settings of measurement
+struct MicrobenchConfig {
+    int numOfWarmups;       ///< samples, that are measured and thrown away
+    int numOfRepetitions;   ///< samples, that are kept, at most MICROBENCH_MAX_REPETITIONS
+    int numOfPasses;        ///< passes over batch in one sample
+    int outputPrecision;    ///< precision of printSolutions()
+};
+
+/// @brief inputs of all functions for one class
+struct MicrobenchInput {
+    QuadraticEquation       equations[MICROBENCH_BATCH_SIZE];
+    QuadraticEquationAnswer answers[MICROBENCH_BATCH_SIZE];
+    long double             points[MICROBENCH_BATCH_SIZE];                          ///< x for getPointValue()
+    char                    coefs[MICROBENCH_BATCH_SIZE][MICROBENCH_COEF_MAX_LEN];  ///< a, b or c in text form
+};
+
+/// @brief samples and their statistics for one case
+struct MicrobenchResult {
+    MicrobenchFunction function;
+    MicrobenchClass    inputClass;
+    int                numOfSamples;
+    double             samples[MICROBENCH_MAX_REPETITIONS];  ///< ns per call
+    double             mean;
+    double             stddev;                               ///< sample standard deviation
+    double             min;
+    double             median;
+};
+
+/// @brief defaults, one sample of the slowest case takes about a millisecond
+static inline MicrobenchConfig getDefaultMicrobenchConfig() {
+    MicrobenchConfig config = {};
+    config.numOfWarmups     = 3;
+    config.numOfRepetitions = 21;
+    config.numOfPasses      = 16;
+    config.outputPrecision  = DEFAULT_PRECISION;
+    return config;
+}
+
+/// @brief fills inputs of one class, they depend only on class, so all runs measure the same inputs
+static inline void fillMicrobenchInput(MicrobenchClass inputClass, MicrobenchInput* input) {
+    static const CorpusTestKind CLASS_KINDS[MICROBENCH_NUM_OF_CLASSES] = {
+        CORPUS_TWO_ROOTS, CORPUS_ONE_ROOT, CORPUS_NO_ROOTS, CORPUS_LINEAR, CORPUS_INFINITE_ROOTS};
+
+    CorpusGeneratorConfig config = {};
+    config.seed = CORPUS_DEFAULT_SEED + (uint64_t)inputClass;
+    config.weights[CLASS_KINDS[inputClass]] = 1;
+    CorpusGenerator generator = {};
+    initCorpusGenerator(&generator, &config);
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL + (uint64_t)inputClass;
+    for (size_t i = 0; i < MICROBENCH_BATCH_SIZE; ++i) {
+        CorpusRecord record = {};
+        generateCorpusRecord(&generator, &record);
+        // generator has no kind with a = b = 0 and c != 0, so c is set here
+        if (inputClass == MICROBENCH_DEGENERATE && i % 2 == 1) {
+            record.c         = (double)getRandomInRange(&state, 1, 1000000);
+            record.numOfSols = NO_ROOTS;
+        }
+
+        QuadraticEquation* eq = &input->equations[i];
+        eq->a               = record.a;
+        eq->b               = record.b;
+        eq->c               = record.c;
+        eq->outputPrecision = DEFAULT_PRECISION;
+
+        input->answers[i].root_1    = record.root_1;
+        input->answers[i].root_2    = record.root_2;
+        input->answers[i].numOfSols = (QuadEqRootState)record.numOfSols;
+
+        input->points[i] = (long double)getRandomInRange(&state, -1000000, 1000000) / 1024;
+
+        // coefficients are taken in turn, so parser gets integers, fractions and zeros in the same proportion as in files
+        long double coef = i % 3 == 0 ? eq->a : (i % 3 == 1 ? eq->b : eq->c);
+        snprintf(input->coefs[i], MICROBENCH_COEF_MAX_LEN, "%.17Lg", coef);
+    }
+}
+
+/// @brief one pass over batch, returns checksum, so calls can't be thrown away
+static inline long double runMicrobenchPass(MicrobenchFunction function, MicrobenchInput* input,
+                                            int outputPrecision, ResultWriter* output) {
+    long double checksum = 0;
+    switch (function) {
+        case MICROBENCH_GET_SOLUTIONS:
+            for (size_t i = 0; i < MICROBENCH_BATCH_SIZE; ++i) {
+                QuadraticEquationAnswer answer = {};
+                getSolutions(&input->equations[i], &answer);
+                checksum += answer.root_1;
+            }
+            break;
+        case MICROBENCH_GET_DISCRIMINANT:
+            for (size_t i = 0; i < MICROBENCH_BATCH_SIZE; ++i) {
+                long double discriminant = 0;
+                getDiscriminant(&input->equations[i], &discriminant);
+                checksum += discriminant;
+            }
+            break;
+        case MICROBENCH_GET_POINT_VALUE:
+            for (size_t i = 0; i < MICROBENCH_BATCH_SIZE; ++i) {
+                long double value = 0;
+                getPointValue(&input->equations[i], input->points[i], &value);
+                checksum += value;
+            }
+            break;
+        case MICROBENCH_PARSE_COEF:
+            for (size_t i = 0; i < MICROBENCH_BATCH_SIZE; ++i) {
+                long double coef = 0;
+                bool isOk = false;
+                parseLongDoubleAndCheckValid(input->coefs[i], &coef, &isOk);
+                checksum += coef;
+            }
+            break;
+        case MICROBENCH_PRINT_SOLUTIONS:
+            for (size_t i = 0; i < MICROBENCH_BATCH_SIZE; ++i)
+                printSolutions(&input->answers[i], outputPrecision, output);
+            checksum += (long double)output->size;
+            break;
+        case MICROBENCH_NUM_OF_FUNCTIONS:
+        default:
+            break;
+    }
+    return checksum;
+}
+
+static inline int compareMicrobenchSamples(const void* first, const void* second) {
+    double firstValue  = *(const double*)first;
+    double secondValue = *(const double*)second;
+    return (firstValue > secondValue) - (firstValue < secondValue);
+}
+
+/// @brief computes mean, stddev, min and median of samples of result
+static inline void computeMicrobenchStats(MicrobenchResult* result) {
+    int n = result->numOfSamples;
+    if (n <= 0)
+        return;
+
+    double sorted[MICROBENCH_MAX_REPETITIONS] = {};
+    memcpy(sorted, result->samples, (size_t)n * sizeof(double));
+    qsort(sorted, (size_t)n, sizeof(double), compareMicrobenchSamples);
+
+    double sum = 0;
+    for (int i = 0; i < n; ++i)
+        sum += sorted[i];
+    double mean = sum / n;
+
+    double squares = 0;
+    for (int i = 0; i < n; ++i)
+        squares += (sorted[i] - mean) * (sorted[i] - mean);
+
+    result->mean   = mean;
+    result->stddev = n > 1 ? sqrt(squares / (n - 1)) : 0;
+    result->min    = sorted[0];
+    result->median = n % 2 == 1 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+}
+
+/**
+    \brief measures one case
+    \param[in] input inputs of class, filled by fillMicrobenchInput()
+    \param[out] output writer for printSolutions(), it's never flushed to anything but /dev/null
+*/
+static inline void runMicrobenchCase(MicrobenchFunction function, MicrobenchClass inputClass,
+                                     MicrobenchInput* input, const MicrobenchConfig* config,
+                                     ResultWriter* output, MicrobenchResult* result) {
+    int numOfRepetitions = config->numOfRepetitions < MICROBENCH_MAX_REPETITIONS ?
+                           config->numOfRepetitions : MICROBENCH_MAX_REPETITIONS;
+    double callsPerSample = (double)config->numOfPasses * (double)MICROBENCH_BATCH_SIZE;
+
+    *result = {};
+    result->function   = function;
+    result->inputClass = inputClass;
+
+    long double checksum = 0;
+    for (int sample = -config->numOfWarmups; sample < numOfRepetitions; ++sample) {
+        uint64_t start = getMonotonicTimeNs();
+        for (int pass = 0; pass < config->numOfPasses; ++pass)
+            checksum += runMicrobenchPass(function, input, config->outputPrecision, output);
+        uint64_t elapsedNs = getMonotonicTimeNs() - start;
+
+        if (sample >= 0)
+            result->samples[result->numOfSamples++] = (double)elapsedNs / callsPerSample;
+    }
+    // checksum is printed, so compiler can not throw calls away
+    if (checksum == 0.5L)
+        fprintf(stderr, "checksum %Lg\n", checksum);
+
+    computeMicrobenchStats(result);
+}
+
+/**
+    \brief measures all functions on all classes
+    \param[out] results MICROBENCH_NUM_OF_FUNCTIONS * MICROBENCH_NUM_OF_CLASSES results, function-major
+    \result QUAD_EQ_ERRORS_MEMORY_ALLOCATION or error of opening /dev/null
+*/
+static inline QuadEqErrors runMicrobenchSuite(const MicrobenchConfig* config, MicrobenchResult* results) {
+    MicrobenchInput* inputs = (MicrobenchInput*)calloc(MICROBENCH_NUM_OF_CLASSES, sizeof(MicrobenchInput));
+    if (inputs == NULL)
+        return QUAD_EQ_ERRORS_MEMORY_ALLOCATION;
+
+    ResultWriter output = {};
+    QuadEqErrors error = openResultWriter("/dev/null", &output);
+    if (error != QUAD_EQ_ERRORS_OK) {
+        free(inputs);
+        return error;
+    }
+
+    for (int inputClass = 0; inputClass < MICROBENCH_NUM_OF_CLASSES; ++inputClass)
+        fillMicrobenchInput((MicrobenchClass)inputClass, &inputs[inputClass]);
+
+    for (int function = 0; function < MICROBENCH_NUM_OF_FUNCTIONS; ++function)
+        for (int inputClass = 0; inputClass < MICROBENCH_NUM_OF_CLASSES; ++inputClass)
+            runMicrobenchCase((MicrobenchFunction)function, (MicrobenchClass)inputClass, &inputs[inputClass],
+                              config, &output, &results[function * MICROBENCH_NUM_OF_CLASSES + inputClass]);
+
+    error = closeResultWriter(&output);
+    free(inputs);
+    return error;
+}
+
+/// @brief prints table: one line per case
+static inline void printMicrobenchResults(const MicrobenchResult* results, size_t numOfResults, FILE* stream) {
+    fprintf(stream, "%-28s %-12s %10s %10s %8s %10s %14s\n",
+            "function", "class", "median ns", "mean ns", "cv %", "min ns", "calls/s");
+    for (size_t i = 0; i < numOfResults; ++i) {
+        const MicrobenchResult* result = &results[i];
+        fprintf(stream, "%-28s %-12s %10.2f %10.2f %8.2f %10.2f %14.0f\n",
+                MICROBENCH_FUNCTION_NAMES[result->function], MICROBENCH_CLASS_NAMES[result->inputClass],
+                result->median, result->mean, result->mean > 0 ? result->stddev / result->mean * 100 : 0,
+                result->min, result->median > 0 ? 1e9 / result->median : 0);
+    }
+}
+
+/**
+    \brief writes results as JSON
+    \code
+    {"version": 1, "config": {...}, "cases": [{"function": "getSolutions", "class": "two_roots",
+      "median_ns": ..., "mean_ns": ..., "stddev_ns": ..., "min_ns": ..., "calls_per_s": ..., "samples_ns": [...]}, ...]}
+    \endcode
+*/
+static inline void writeMicrobenchJson(const MicrobenchResult* results, size_t numOfResults,
+                                       const MicrobenchConfig* config, FILE* stream) {
+    fprintf(stream, "{\n  \"version\": %d,\n", MICROBENCH_JSON_VERSION);
+    fprintf(stream, "  \"config\": {\"warmups\": %d, \"repetitions\": %d, \"passes\": %d, \"batch\": %zu},\n",
+            config->numOfWarmups, config->numOfRepetitions, config->numOfPasses, MICROBENCH_BATCH_SIZE);
+    fprintf(stream, "  \"cases\": [\n");
+    for (size_t i = 0; i < numOfResults; ++i) {
+        const MicrobenchResult* result = &results[i];
+        fprintf(stream, "    {\"function\": \"%s\", \"class\": \"%s\", \"median_ns\": %.4f, \"mean_ns\": %.4f, "
+                        "\"stddev_ns\": %.4f, \"min_ns\": %.4f, \"calls_per_s\": %.1f,\n     \"samples_ns\": [",
+                MICROBENCH_FUNCTION_NAMES[result->function], MICROBENCH_CLASS_NAMES[result->inputClass],
+                result->median, result->mean, result->stddev, result->min,
+                result->median > 0 ? 1e9 / result->median : 0);
+        for (int sample = 0; sample < result->numOfSamples; ++sample)
+            fprintf(stream, "%s%.4f", sample == 0 ? "" : ", ", result->samples[sample]);
+        fprintf(stream, "]}%s\n", i + 1 == numOfResults ? "" : ",");
+    }
+    fprintf(stream, "  ]\n}\n");
+}
+
+/// @brief returns pointer to value of "key" (after colon and blanks) in [from, end), NULL if there is no such key
+static inline const char* findMicrobenchJsonValue(const char* from, const char* end, const char* key) {
+    size_t keyLen = strlen(key);
+    for (const char* cur = from; cur + keyLen + 2 <= end; ++cur) {
+        if (*cur != '"' || strncmp(cur + 1, key, keyLen) != 0 || cur[keyLen + 1] != '"')
+            continue;
+        cur += keyLen + 2;
+        while (cur < end && (isspace(*cur) || *cur == ':'))
+            ++cur;
+        return cur;
+    }
+    return NULL;
+}
+
+/// @brief returns index of quoted name at value in names, -1 if it's unknown
+static inline int findMicrobenchJsonName(const char* value, const char* end, const char* const* names, int numOfNames) {
+    if (value == NULL || value >= end || *value != '"')
+        return -1;
+    ++value;
+    for (int i = 0; i < numOfNames; ++i) {
+        size_t nameLen = strlen(names[i]);
+        if (value + nameLen < end && strncmp(value, names[i], nameLen) == 0 && value[nameLen] == '"')
+            return i;
+    }
+    return -1;
+}
+
+/**
+    \brief reads report, written by writeMicrobenchJson(), statistics are recomputed from samples
+    \param[out] results function-major as in runMicrobenchSuite(), cases, that are absent in file, have no samples
+    \result QUAD_EQ_ERRORS_INVALID_FILE if file can't be read, has other version or has no cases
+*/
+static inline QuadEqErrors readMicrobenchJson(const char* fileName, MicrobenchResult* results) {
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+
+    char*  text = NULL;
+    size_t size = 0;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long fileSize = ftell(file);
+        if (fileSize > 0 && fseek(file, 0, SEEK_SET) == 0 && (text = (char*)calloc((size_t)fileSize + 1, 1)) != NULL)
+            size = fread(text, 1, (size_t)fileSize, file);
+    }
+    fclose(file);
+    if (text == NULL)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+
+    const char* end     = text + size;
+    const char* version = findMicrobenchJsonValue(text, end, "version");
+    if (version == NULL || atoi(version) != MICROBENCH_JSON_VERSION) {
+        free(text);
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+
+    for (int i = 0; i < MICROBENCH_NUM_OF_FUNCTIONS * MICROBENCH_NUM_OF_CLASSES; ++i) {
+        results[i] = {};
+        results[i].function   = (MicrobenchFunction)(i / MICROBENCH_NUM_OF_CLASSES);
+        results[i].inputClass = (MicrobenchClass)   (i % MICROBENCH_NUM_OF_CLASSES);
+    }
+
+    int numOfCases = 0;
+    const char* cur = text;
+    while ((cur = findMicrobenchJsonValue(cur, end, "function")) != NULL) {
+        int function   = findMicrobenchJsonName(cur, end, MICROBENCH_FUNCTION_NAMES, MICROBENCH_NUM_OF_FUNCTIONS);
+        int inputClass = findMicrobenchJsonName(findMicrobenchJsonValue(cur, end, "class"), end,
+                                                MICROBENCH_CLASS_NAMES, MICROBENCH_NUM_OF_CLASSES);
+        const char* samples = findMicrobenchJsonValue(cur, end, "samples_ns");
+        if (samples == NULL || *samples != '[')
+            break;
+        cur = samples + 1;
+        if (function < 0 || inputClass < 0)
+            continue;
+
+        MicrobenchResult* result = &results[function * MICROBENCH_NUM_OF_CLASSES + inputClass];
+        result->numOfSamples = 0;
+        while (cur < end && *cur != ']' && result->numOfSamples < MICROBENCH_MAX_REPETITIONS) {
+            char* numberEnd = NULL;
+            double sample = strtod(cur, &numberEnd);
+            if (numberEnd == cur)
+                break;
+            result->samples[result->numOfSamples++] = sample;
+            cur = numberEnd;
+            while (cur < end && (isspace(*cur) || *cur == ','))
+                ++cur;
+        }
+        computeMicrobenchStats(result);
+        ++numOfCases;
+    }
+
+    free(text);
+    return numOfCases > 0 ? QUAD_EQ_ERRORS_OK : QUAD_EQ_ERRORS_INVALID_FILE;
+}
+
+#endif
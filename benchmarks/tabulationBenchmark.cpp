@@ -0,0 +1,105 @@
+/**
+    \file
+    \brief measures points/second of tabulation of parabolas for each supported instruction set
+
+    Loop of getPointValue() (which validates equation and point on every call) is measured too, for comparison.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/parabolaTabulation.hpp"
+
+const size_t NUM_OF_POINTS    = 1 << 20;
+const int    NUM_OF_RUNS      = 50;
+/// @brief grid of tabulateParabolas() is smaller, so it stays in cache while many equations are evaluated
+const size_t NUM_OF_GRID_POINTS = 1 << 12;
+const size_t NUM_OF_EQUATIONS   = NUM_OF_POINTS / NUM_OF_GRID_POINTS;
+
+/// @brief prints one line of results
+static void printResult(const char* name, const char* level, uint64_t elapsedNs, const double* values) {
+    double totalPoints = (double)NUM_OF_POINTS * NUM_OF_RUNS;
+    printf("%-22s %-7s %10.2f Mpoints/s %8.3f ns/point\n", name, level,
+           totalPoints / (double)elapsedNs * 1e3, (double)elapsedNs / totalPoints);
+    // checksum is printed, so compiler can not throw computation away
+    double checksum = 0;
+    for (size_t i = 0; i < NUM_OF_POINTS; i += 4096)
+        checksum += values[i];
+    fprintf(stderr, "%s %s checksum: %g\n", name, level, checksum);
+}
+
+int main() {
+    double* x      = (double*)calloc(NUM_OF_POINTS, sizeof(double));
+    double* values = (double*)calloc(NUM_OF_POINTS, sizeof(double));
+    double* a      = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    double* b      = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    double* c      = (double*)calloc(NUM_OF_EQUATIONS, sizeof(double));
+    if (x == NULL || values == NULL || a == NULL || b == NULL || c == NULL) {
+        fprintf(stderr, "Error: couldn't allocate memory\n");
+        return 1;
+    }
+
+    const double start = -100, step = 200.0 / NUM_OF_POINTS;
+    for (size_t i = 0; i < NUM_OF_POINTS; ++i)
+        x[i] = start + (double)i * step;
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+        a[i] = (double)getRandomInRange(&randomState, -3, 3);
+        b[i] = (double)getRandomInRange(&randomState, -20, 20);
+        c[i] = (double)getRandomInRange(&randomState, -20, 20);
+    }
+    QuadraticEquation eq = {1.5, -2, 0.25, DEFAULT_PRECISION};
+    QuadraticEquationDoubleBatch batch = {NUM_OF_EQUATIONS, a, b, c};
+
+    uint64_t begin = getMonotonicTimeNs();
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        for (size_t i = 0; i < NUM_OF_POINTS; ++i) {
+            long double value = 0;
+            getPointValue(&eq, x[i], &value);
+            values[i] = (double)value;
+        }
+    }
+    printResult("getPointValue loop", "scalar", getMonotonicTimeNs() - begin, values);
+
+    SimdLevel supportedLevel = getSupportedSimdLevel();
+    for (int level = SIMD_LEVEL_SCALAR; level <= supportedLevel; ++level) {
+        setSimdLevel((SimdLevel)level);
+        const char* levelName = getSimdLevelName((SimdLevel)level);
+
+        begin = getMonotonicTimeNs();
+        for (int run = 0; run < NUM_OF_RUNS; ++run)
+            tabulateParabola(&eq, x, NUM_OF_POINTS, values);
+        printResult("tabulateParabola", levelName, getMonotonicTimeNs() - begin, values);
+
+        begin = getMonotonicTimeNs();
+        for (int run = 0; run < NUM_OF_RUNS; ++run)
+            tabulateParabolaRange(&eq, start, step, NUM_OF_POINTS, values);
+        printResult("tabulateParabolaRange", levelName, getMonotonicTimeNs() - begin, values);
+
+        begin = getMonotonicTimeNs();
+        for (int run = 0; run < NUM_OF_RUNS; ++run)
+            tabulateParabolas(&batch, x, NUM_OF_GRID_POINTS, values);
+        printResult("tabulateParabolas", levelName, getMonotonicTimeNs() - begin, values);
+    }
+    setSimdLevel(supportedLevel);
+
+    // vectorized results should be the same as scalar ones
+    double maxDifference = 0;
+    for (size_t i = 0; i < NUM_OF_POINTS; i += 997) {
+        long double value = 0;
+        getPointValue(&eq, x[i], &value);
+        tabulateParabola(&eq, x + i, 1, values);
+        maxDifference = fmax(maxDifference, fabs(values[0] - (double)value));
+    }
+    printf("max difference with getPointValue: %g\n", maxDifference);
+
+    free(x);
+    free(values);
+    free(a);
+    free(b);
+    free(c);
+    return 0;
+}
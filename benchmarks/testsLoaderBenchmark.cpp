@@ -0,0 +1,95 @@
+/**
+    \file
+    \brief compares loading of big tests file with reading of it's bytes
+
+    File with NUM_OF_TESTS tests is written to /tmp, then it's read by read() (lower bound, that is set by I/O)
+    and loaded by loadTestsFile() by 1, 2, 4, ... threads, up to number of CPUs.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <thread>
+
+#include "benchmarkCommon.hpp"
+#include "../include/testsLoader.hpp"
+#include "../include/threadPool.hpp"
+
+const size_t NUM_OF_TESTS   = (size_t)2 << 20;
+const int    NUM_OF_RUNS    = 3;
+const char*  TESTS_FILE     = "/tmp/testsLoaderBenchmark.txt";
+const size_t READ_BLOCK     = (size_t)1 << 20;
+
+/// @brief writes tests with two integer roots
+static bool writeTestsFile() {
+    FILE* file = fopen(TESTS_FILE, "w");
+    if (file == NULL)
+        return false;
+
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_TESTS; ++i) {
+        long long root_1 = getRandomInRange(&randomState, -50, 49);
+        long long root_2 = root_1 + getRandomInRange(&randomState, 1, 50);
+        fprintf(file, "1\n%lld\n%lld\n%lld\n%lld\n#\n", -(root_1 + root_2), root_1 * root_2, root_1, root_2);
+    }
+    return fclose(file) == 0;
+}
+
+/// @brief reads whole file by blocks, returns time in ns
+static uint64_t readFileBytes() {
+    static char block[READ_BLOCK];
+    uint64_t start = getMonotonicTimeNs();
+    int fd = open(TESTS_FILE, O_RDONLY);
+    while (fd != -1 && read(fd, block, sizeof(block)) > 0) {}
+    close(fd);
+    return getMonotonicTimeNs() - start;
+}
+
+static void printResult(const char* name, size_t numOfThreads, uint64_t elapsedNs) {
+    printf("%-16s %3zu threads %8.1f ms %8.2f Mtests/s\n", name, numOfThreads, (double)elapsedNs / 1e6,
+           (double)NUM_OF_TESTS / (double)elapsedNs * 1e3);
+}
+
+int main() {
+    if (!writeTestsFile()) {
+        fprintf(stderr, "Error: couldn't write %s\n", TESTS_FILE);
+        return 1;
+    }
+
+    // first read brings file to page cache, so all runs measure the same thing
+    readFileBytes();
+    uint64_t bestReadNs = UINT64_MAX;
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        uint64_t elapsedNs = readFileBytes();
+        bestReadNs = elapsedNs < bestReadNs ? elapsedNs : bestReadNs;
+    }
+    printResult("read()", 1, bestReadNs);
+
+    size_t maxNumOfThreads = std::thread::hardware_concurrency();
+    for (size_t numOfThreads = 1; numOfThreads <= maxNumOfThreads; numOfThreads *= 2) {
+        ThreadPool* pool = NULL;
+        if (numOfThreads > 1 && createThreadPool(numOfThreads, &pool) != QUAD_EQ_ERRORS_OK)
+            return 1;
+
+        uint64_t bestNs = UINT64_MAX;
+        for (int run = 0; run < NUM_OF_RUNS; ++run) {
+            TestsArena arena = {};
+            uint64_t start = getMonotonicTimeNs();
+            QuadEqErrors error = loadTestsFile(TESTS_FILE, pool, &arena);
+            uint64_t elapsedNs = getMonotonicTimeNs() - start;
+            if (error != QUAD_EQ_ERRORS_OK || arena.count != NUM_OF_TESTS) {
+                fprintf(stderr, "Error: loaded %zu tests of %zu\n", arena.count, NUM_OF_TESTS);
+                return 1;
+            }
+            freeTestsArena(&arena);
+            bestNs = elapsedNs < bestNs ? elapsedNs : bestNs;
+        }
+        printResult("loadTestsFile()", numOfThreads, bestNs);
+        if (pool != NULL)
+            destroyThreadPool(pool);
+    }
+
+    remove(TESTS_FILE);
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+    \file
+    \brief measures scaling of parallel solver with number of threads
+
+    Array of equations is solved by getSolutionsParallel() (per element getSolutions())
+    and by getSolutionsBatchParallel() with 1, 2, 4, ... threads, up to number of CPUs.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+
+#include "benchmarkCommon.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/threadPool.hpp"
+
+const size_t NUM_OF_EQUATIONS = 1 << 22;
+const int    NUM_OF_RUNS      = 5;
+
+/// @brief prints one line of results
+static void printResult(const char* name, size_t numOfThreads, uint64_t elapsedNs, uint64_t singleThreadNs) {
+    double totalEquations = (double)NUM_OF_EQUATIONS * NUM_OF_RUNS;
+    printf("%-26s %3zu threads %10.2f Meq/s  speedup %5.2f\n", name, numOfThreads,
+           totalEquations / (double)elapsedNs * 1e3, (double)singleThreadNs / (double)elapsedNs);
+}
+
+int main() {
+    QuadraticEquation*       equations = (QuadraticEquation*)      calloc(NUM_OF_EQUATIONS, sizeof(QuadraticEquation));
+    QuadraticEquationAnswer* answers   = (QuadraticEquationAnswer*)calloc(NUM_OF_EQUATIONS, sizeof(QuadraticEquationAnswer));
+    long double*     a         = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     b         = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     c         = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     root_1    = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    long double*     root_2    = (long double*)calloc(NUM_OF_EQUATIONS, sizeof(long double));
+    QuadEqRootState* numOfSols = (QuadEqRootState*)calloc(NUM_OF_EQUATIONS, sizeof(QuadEqRootState));
+    if (equations == NULL || answers == NULL || a == NULL || b == NULL || c == NULL ||
+        root_1 == NULL || root_2 == NULL || numOfSols == NULL) {
+        fprintf(stderr, "Error: couldn't allocate memory\n");
+        return 1;
+    }
+
+    uint64_t randomState = 2024;
+    for (size_t i = 0; i < NUM_OF_EQUATIONS; ++i) {
+        a[i] = (long double)getRandomInRange(&randomState, -3, 3);
+        b[i] = (long double)getRandomInRange(&randomState, -20, 20);
+        c[i] = (long double)getRandomInRange(&randomState, -20, 20);
+        equations[i] = {a[i], b[i], c[i], DEFAULT_PRECISION};
+    }
+
+    QuadraticEquationBatch       batch  = {NUM_OF_EQUATIONS, a, b, c};
+    QuadraticEquationBatchAnswer answer = {root_1, root_2, numOfSols};
+
+    size_t maxNumOfThreads = std::thread::hardware_concurrency();
+    printf("%zu CPUs\n", maxNumOfThreads);
+
+    uint64_t singleSolutionsNs = 0, singleBatchNs = 0;
+    for (size_t numOfThreads = 1; numOfThreads <= maxNumOfThreads; numOfThreads *= 2) {
+        ThreadPool* pool = NULL;
+        if (createThreadPool(numOfThreads, &pool) != QUAD_EQ_ERRORS_OK)
+            return 1;
+
+        getSolutionsParallel(pool, getSolutions, equations, answers, NULL, NUM_OF_EQUATIONS); // warmup
+        uint64_t start = getMonotonicTimeNs();
+        for (int run = 0; run < NUM_OF_RUNS; ++run)
+            getSolutionsParallel(pool, getSolutions, equations, answers, NULL, NUM_OF_EQUATIONS);
+        uint64_t elapsed = getMonotonicTimeNs() - start;
+        if (numOfThreads == 1)
+            singleSolutionsNs = elapsed;
+        printResult("getSolutionsParallel", numOfThreads, elapsed, singleSolutionsNs);
+
+        start = getMonotonicTimeNs();
+        for (int run = 0; run < NUM_OF_RUNS; ++run)
+            getSolutionsBatchParallel(pool, &batch, &answer);
+        elapsed = getMonotonicTimeNs() - start;
+        if (numOfThreads == 1)
+            singleBatchNs = elapsed;
+        printResult("getSolutionsBatchParallel", numOfThreads, elapsed, singleBatchNs);
+
+        destroyThreadPool(pool);
+    }
+
+    free(equations); free(answers); free(a); free(b); free(c); free(root_1); free(root_2); free(numOfSols);
+    return 0;
+}
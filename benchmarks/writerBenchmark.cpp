@@ -0,0 +1,85 @@
+/**
+    \file
+    \brief measures throughput of result printing
+
+    Random roots are printed in text format of batch mode by old path (fprintf() with "%.*Lg")
+    and by ResultWriter with to_chars() formatting. Output goes to /dev/null, so only formatting is measured.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "benchmarkCommon.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/resultWriter.hpp"
+#include "../include/batchMode.hpp"
+
+const size_t NUM_OF_RESULTS = 2000000;
+const int    NUM_OF_RUNS    = 3;
+
+/// @brief roots, that are printed by every path
+struct PrintedRoots {
+    long double root_1[NUM_OF_RESULTS];
+    long double root_2[NUM_OF_RESULTS];
+};
+
+/// @brief old path: every line is formatted by fprintf()
+static void printWithFprintf(const PrintedRoots* roots, int outputPrecision) {
+    FILE* output = fopen("/dev/null", "w");
+    if (output == NULL)
+        return;
+
+    for (size_t i = 0; i < NUM_OF_RESULTS; ++i)
+        fprintf(output, "2 %.*Lg %.*Lg\n", outputPrecision, roots->root_1[i], outputPrecision, roots->root_2[i]);
+    fclose(output);
+}
+
+/// @brief new path: lines are formatted into buffer of writer
+static void printWithWriter(const PrintedRoots* roots, int outputPrecision) {
+    ResultWriter output = {};
+    if (openResultWriter("/dev/null", &output) != QUAD_EQ_ERRORS_OK)
+        return;
+
+    for (size_t i = 0; i < NUM_OF_RESULTS; ++i)
+        printBatchResult(&output, TWO_ROOTS, roots->root_1[i], roots->root_2[i], outputPrecision);
+    closeResultWriter(&output);
+}
+
+/// @brief runs printer several times and prints best time
+static void benchmarkPrinter(const char* name, const PrintedRoots* roots, int outputPrecision,
+                             void (*printer)(const PrintedRoots* roots, int outputPrecision)) {
+    uint64_t bestNs = UINT64_MAX;
+    for (int run = 0; run < NUM_OF_RUNS; ++run) {
+        uint64_t start = getMonotonicTimeNs();
+        printer(roots, outputPrecision);
+        uint64_t elapsed = getMonotonicTimeNs() - start;
+        if (elapsed < bestNs)
+            bestNs = elapsed;
+    }
+    printf("%-18s precision %2d %10.2f Mlines/s %8.3f ns/line\n", name, outputPrecision,
+           (double)NUM_OF_RESULTS / (double)bestNs * 1e3, (double)bestNs / (double)NUM_OF_RESULTS);
+}
+
+int main() {
+    PrintedRoots* roots = (PrintedRoots*)calloc(1, sizeof(PrintedRoots));
+    if (roots == NULL) {
+        fprintf(stderr, "Error: couldn't allocate memory\n");
+        return 1;
+    }
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < NUM_OF_RESULTS; ++i) {
+        roots->root_1[i] = (long double)getRandomInRange(&state, -1000000, 1000000) / 7;
+        roots->root_2[i] = (long double)getRandomInRange(&state, -1000000, 1000000) / 1000;
+    }
+
+    printf("%zu result lines, best of %d runs\n", NUM_OF_RESULTS, NUM_OF_RUNS);
+    const int precisions[] = {DEFAULT_PRECISION, 18, 30};
+    for (int precision : precisions) {
+        benchmarkPrinter("fprintf",      roots, precision, printWithFprintf);
+        benchmarkPrinter("result writer", roots, precision, printWithWriter);
+    }
+
+    free(roots);
+    return 0;
+}
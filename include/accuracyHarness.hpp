@@ -0,0 +1,105 @@
+#ifndef ACCURACY_HARNESS_HEADER
+#define ACCURACY_HARNESS_HEADER
+
+/**
+    \file
+    \brief differential harness: measures accuracy and speed of solver against high precision reference
+
+    Every equation is solved by tested solver (any getSolutionsFuncPtr) and compared with reference: roots
+    computed in __float128 (113 bits of mantissa against 64 of long double), or expected answers of tests,
+    if __float128 is not available (answers of generated corpora are exact). Number of roots of reference is
+    always taken from expected answer of test, it's not computed by EPSILON rules of tested solver.
+    Errors of roots are collected into histograms per class of equation (by number of roots of reference):
+    \code
+    ulp      = |root - reference| / ULP of long double at reference (ULP of 1 for reference 0)
+    relative = |root - reference| / |reference|                      (absolute error for reference 0)
+    \endcode
+    Speed is measured separately, as best time of ACCURACY_NUM_OF_RUNS runs of solver over all equations.
+
+    Harness is a gate for faster solvers: solver passes if it classifies all equations as reference does,
+    absolute error of every root is at most maxAbsError (what checkOnTests() demands) and, if it's stated,
+    error in ULP is at most maxUlp.
+*/
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+#include "testsGenerator.hpp"
+
+/// @brief bucket 0 - exact roots, 1 - errors from (0, 1] ULP, i - from (2^(i - 2), 2^(i - 1)] ULP, last - all bigger
+const int    ACCURACY_NUM_OF_ULP_BUCKETS = 34;
+/// @brief bucket 0 - exact roots, 1 - errors from (0, 1e-19], i - from (10^(i - 21), 10^(i - 20)], last - all bigger
+const int    ACCURACY_NUM_OF_REL_BUCKETS = 22;
+/// @brief solver is run so many times over all equations, best time is taken
+const int    ACCURACY_NUM_OF_RUNS        = 3;
+/// @brief number of generated tests, that are used by libRun --accuracy, if corpus is not stated
+const size_t ACCURACY_DEFAULT_NUM_OF_TESTS = (size_t)1 << 20;
+/// @brief maxUlp, that means, that error in ULP is not checked
+const double ACCURACY_NO_ULP_LIMIT       = 0;
+
+/// @brief where reference answers come from
+enum AccuracyReference {
+    ACCURACY_REFERENCE_FLOAT128 = 0, ///< roots are computed in __float128, their number is expected one
+    ACCURACY_REFERENCE_EXPECTED = 1, ///< answers of tests are used as they are
+};
+
+/// @brief conditions, that solver should satisfy to pass
+struct AccuracyGate {
+    long double maxAbsError;   ///< maximum absolute error of root, EPSILON by default
+    double      maxUlp;        ///< maximum error of root in ULP, ACCURACY_NO_ULP_LIMIT by default
+};
+
+/// @brief errors of one class of equations (same number of roots in reference)
+struct AccuracyClassReport {
+    size_t      numOfEquations;
+    size_t      numOfMisclassified;                          ///< solver found other number of roots
+    size_t      numOfRoots;                                  ///< roots, that were compared
+    size_t      numOfFailedRoots;                            ///< roots, that don't pass gate
+    double      maxUlp;
+    double      maxRelError;
+    long double maxAbsError;
+    size_t      ulpHistogram[ACCURACY_NUM_OF_ULP_BUCKETS];
+    size_t      relHistogram[ACCURACY_NUM_OF_REL_BUCKETS];
+};
+
+/// @brief result of harness
+struct AccuracyReport {
+    AccuracyReference   reference;
+    AccuracyGate        gate;
+    size_t              numOfEquations;
+    size_t              numOfSolverErrors;                   ///< solver returned error code
+    double              nsPerEquation;                       ///< best of ACCURACY_NUM_OF_RUNS runs
+    AccuracyClassReport classes[INFINITE_ROOTS + 1];         ///< index is QuadEqRootState of reference
+    bool                isPassed;
+};
+
+/**
+    \brief returns gate, that demands the same as checkOnTests(): right classification and absolute error <= EPSILON
+*/
+AccuracyGate getDefaultAccuracyGate();
+
+/**
+    \brief returns best available reference (__float128, if compiler supports it)
+*/
+AccuracyReference getDefaultAccuracyReference();
+
+/**
+    \brief runs solver on all tests, compares it with reference and measures it's speed
+    \param[in] solver tested solver
+    \param[in] tests equations (and expected answers, that are used by ACCURACY_REFERENCE_EXPECTED)
+    \param[in] reference source of reference answers
+    \param[in] gate conditions of passing
+    \param[out] report histograms, speed and verdict
+    \result QUAD_EQ_ERRORS_ILLEGAL_ARG if __float128 reference is asked, but not available
+*/
+QuadEqErrors runAccuracyHarness(getSolutionsFuncPtr solver, const struct Test* tests, size_t numOfTests,
+                                AccuracyReference reference, AccuracyGate gate, struct AccuracyReport* report);
+
+/**
+    \brief prints speed, histograms of every class and verdict
+    \param[in] stream where to print
+*/
+void printAccuracyReport(const struct AccuracyReport* report, FILE* stream);
+
+#endif
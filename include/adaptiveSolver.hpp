@@ -0,0 +1,57 @@
+#ifndef ADAPTIVE_SOLVER_HEADER
+#define ADAPTIVE_SOLVER_HEADER
+
+/**
+    \file
+    \brief solver, that works in double and uses long double only when it's needed
+
+    Discriminant is computed in double with error-free transformations (FMA), together with bound of it's error.
+    If discriminant is so close to +-EPSILON, that it's classification (no roots, one root, two roots)
+    could change because of this error, equation is solved again by long double getSolutions().
+    Equations, which coefficients can not be represented in double exactly, are always solved by long double path.
+
+    What is guaranteed: equations with exact coefficients are classified by the same EPSILON threshold as sign(),
+    applied to discriminant, that differs from exact one less than by computed bound. getSolutions() rounds
+    discriminant in long double on it's own, so when it's rounding error moves discriminant across EPSILON,
+    classifications of getSolutions() and getSolutionsAdaptive() can differ. Roots have double precision.
+*/
+
+#include <stdio.h>
+
+#include "quadraticEquation.hpp"
+
+/// @brief counters of adaptive solver, they show how often escalation to long double happens
+struct AdaptiveSolverStats {
+    unsigned long long numOfCalls;         ///< equations solved by getSolutionsAdaptive()
+    unsigned long long numOfFastSolved;    ///< equations solved entirely in double
+    unsigned long long numOfEscalations;   ///< classification was ambiguous, so long double was used
+    unsigned long long numOfInexactInputs; ///< coefficients were not representable in double, so long double was used
+};
+
+/**
+    \brief gets solutions of quadratic equation, same interface as getSolutions()
+
+    Roots of equations, solved in double, have double precision (but are stored in long double).
+    Counters are updated atomically, so this function can be called from several threads.
+    \param[in] eq given equation
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors getSolutionsAdaptive(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer);
+
+/**
+    \brief returns counters of adaptive solver
+*/
+AdaptiveSolverStats getAdaptiveSolverStats();
+
+/**
+    \brief sets all counters of adaptive solver to 0
+*/
+void resetAdaptiveSolverStats();
+
+/**
+    \brief prints counters of adaptive solver and share of escalations
+    \param[in] stream where to print
+*/
+void printAdaptiveSolverStats(FILE* stream);
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef ASYNC_LOGGER_HEADER
+#define ASYNC_LOGGER_HEADER
+
+/**
+    \file
+    \brief asynchronous backend for logging: calling thread only copies arguments, background thread formats and writes
+
+    Every thread, that logs, gets it's own ring of ASYNC_LOG_RING_CAPACITY records (single producer, single consumer,
+    no locks). Record keeps pointer to format, file and function (they are literals) and raw values of arguments,
+    strings are copied into record (up to ASYNC_LOG_STRING_BYTES bytes for all strings of record, longer are cut).
+    Background thread takes records from all rings, formats them and passes them to LoggerLib (printMessageToLog()),
+    so time, colors and log file are still handled by LoggerLib, but strftime() and fprintf() don't run on callers.
+    Time in log is time of writing, it's later than time of call by at most ASYNC_LOG_IDLE_SLEEP_US microseconds,
+    if logger is not overloaded.
+
+    Memory is bounded: record, that doesn't fit into full ring, is dropped and counted (getAsyncLoggerDropped()).
+    Until startAsyncLogger() is called (and after stopAsyncLogger()) records are formatted and written synchronously.
+    startAsyncLogger() registers atexit() handler, that stops logger, so background thread is always joined
+    and records are written, even if program exits without destructAsyncLogger().
+    destructLogger() of LoggerLib knows nothing about rings, so destructAsyncLogger() should be called instead of it.
+
+    \code
+    startAsyncLogger();
+    ASYNC_LOG(INFO, "solved %zu equations in %.3f s\n", count, seconds);
+    destructAsyncLogger(); // writes all records, stops thread, calls destructLogger()
+    \endcode
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+#include "../LoggerLib/include/logLib.hpp"
+
+/// @brief number of records in ring of one thread
+const size_t ASYNC_LOG_RING_CAPACITY = 256;
+/// @brief maximum number of arguments of one record, the rest are printed as "?"
+const size_t ASYNC_LOG_MAX_ARGS      = 8;
+/// @brief bytes for copies of all string arguments of one record
+const size_t ASYNC_LOG_STRING_BYTES  = 192;
+/// @brief maximum number of threads with own rings, records of other threads are dropped
+const size_t ASYNC_LOG_MAX_THREADS   = 64;
+/// @brief background thread sleeps so long, when all rings are empty
+const long   ASYNC_LOG_IDLE_SLEEP_US = 1000;
+
+/// @brief type of captured argument
+enum AsyncLogArgType {
+    ASYNC_LOG_ARG_INT,
+    ASYNC_LOG_ARG_UINT,
+    ASYNC_LOG_ARG_DOUBLE,
+    ASYNC_LOG_ARG_LONG_DOUBLE,
+    ASYNC_LOG_ARG_STRING,       ///< copied into record, value is offset of copy
+    ASYNC_LOG_ARG_POINTER,
+};
+
+/// @brief raw value of one argument
+struct AsyncLogArg {
+    union {
+        long long          i;
+        unsigned long long u;
+        double             d;
+        long double        ld;
+        const void*        p;
+        size_t             stringOffset;
+    };
+    AsyncLogArgType type;
+};
+
+/// @brief one call of ASYNC_LOG()
+struct AsyncLogRecord {
+    LoggingLevels level;
+    int           line;
+    const char*   file;
+    const char*   function;
+    const char*   format;
+    size_t        numOfArgs;
+    size_t        stringsSize;  ///< used bytes of strings
+    AsyncLogArg   args[ASYNC_LOG_MAX_ARGS];
+    char          strings[ASYNC_LOG_STRING_BYTES];
+};
+
+/**
+    \brief starts background thread, after that records go to rings
+    \result false if thread couldn't be started (then logging stays synchronous)
+*/
+bool startAsyncLogger();
+
+/**
+    \brief waits, until every record, that is in rings at the moment of call, is written
+*/
+void flushAsyncLogger();
+
+/**
+    \brief writes all records and stops background thread, logging becomes synchronous again
+
+    Other threads should not log during this call, their records can be lost.
+    If some records were dropped, warning with their number is written.
+*/
+void stopAsyncLogger();
+
+/**
+    \brief stopAsyncLogger() and destructLogger() of LoggerLib, should be used instead of destructLogger()
+*/
+void destructAsyncLogger();
+
+/**
+    \brief returns number of records, that were dropped because their ring was full
+*/
+uint64_t getAsyncLoggerDropped();
+
+/// @brief takes free record from ring of calling thread, NULL if ring is full (record is counted as dropped)
+AsyncLogRecord* beginAsyncLogRecord();
+
+/// @brief makes record visible to background thread, or writes it at once if logger is not started
+void commitAsyncLogRecord(AsyncLogRecord* record);
+
+// --------------------------   CAPTURE OF ARGUMENTS   ---------------------------------
+
+void captureAsyncLogString(AsyncLogRecord* record, AsyncLogArg* arg, const char* string);
+
+template <typename Arg>
+static inline void captureAsyncLogArg(AsyncLogRecord* record, Arg value) {
+    if (record->numOfArgs >= ASYNC_LOG_MAX_ARGS)
+        return;
+
+    AsyncLogArg* arg = &record->args[record->numOfArgs++];
+    typedef typename std::decay<Arg>::type Type;
+    if constexpr (std::is_same<Type, char*>::value || std::is_same<Type, const char*>::value) {
+        captureAsyncLogString(record, arg, value);
+    } else if constexpr (std::is_pointer<Type>::value || std::is_null_pointer<Type>::value) {
+        arg->type = ASYNC_LOG_ARG_POINTER;
+        arg->p    = (const void*)value;
+    } else if constexpr (std::is_same<Type, long double>::value) {
+        arg->type = ASYNC_LOG_ARG_LONG_DOUBLE;
+        arg->ld   = value;
+    } else if constexpr (std::is_floating_point<Type>::value) {
+        arg->type = ASYNC_LOG_ARG_DOUBLE;
+        arg->d    = (double)value;
+    } else if constexpr (std::is_enum<Type>::value || std::is_signed<Type>::value) {
+        arg->type = ASYNC_LOG_ARG_INT;
+        arg->i    = (long long)value;
+    } else {
+        static_assert(std::is_integral<Type>::value, "argument of log can't be printed by printf");
+        arg->type = ASYNC_LOG_ARG_UINT;
+        arg->u    = (unsigned long long)value;
+    }
+}
+
+/// @brief copies raw arguments into record, formatting is done later
+template <typename... Args>
+static inline void asyncLog(LoggingLevels level, const char* file, const char* function, int line,
+                            const char* format, Args... args) {
+    AsyncLogRecord* record = beginAsyncLogRecord();
+    if (record == NULL)
+        return;
+
+    record->level       = level;
+    record->line        = line;
+    record->file        = file;
+    record->function    = function;
+    record->format      = format;
+    record->numOfArgs   = 0;
+    record->stringsSize = 0;
+    (captureAsyncLogArg(record, args), ...);
+    commitAsyncLogRecord(record);
+}
+
+/// @brief never called, only lets compiler check format of ASYNC_LOG() against arguments
+static inline void checkAsyncLogFormat(const char* format, ...) __attribute__((format(printf, 1, 2)));
+static inline void checkAsyncLogFormat(const char*, ...) {}
+
+/// @brief same as LOG_ERROR() and others of LoggerLib, but through asynchronous backend
+#define ASYNC_LOG(LEVEL, ...)                                                   \
+    do {                                                                        \
+        if (false)                                                              \
+            checkAsyncLogFormat(__VA_ARGS__);                                   \
+        asyncLog(LEVEL, __FILE__, __FUNCTION__, __LINE__, __VA_ARGS__);         \
+    } while(0)
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef BATCH_MODE_HEADER
+#define BATCH_MODE_HEADER
+
+/**
+    \file
+    \brief streaming solver of many equations
+
+    Reads records "a b c" (separated by blanks or commas, one record per line) and writes one result line per record:
+    \code
+    2 root_1 root_2     - two roots
+    1 root              - one root
+    0                   - no roots
+    inf                 - infinitely many roots
+    error               - record is malformed (reason is passed to error sink with name of input and line number)
+    \endcode
+    Input is read in one pass and solved by chunks, so memory usage doesn't depend on size of input.
+*/
+
+#include <stdio.h>
+
+#include "quadraticEquation.hpp"
+#include "threadPool.hpp"
+#include "resultWriter.hpp"
+
+/// @brief statistics of one batch run
+struct BatchModeStats {
+    size_t numOfRecords;   ///< number of non empty lines
+    size_t numOfMalformed; ///< number of lines, that couldn't be solved
+};
+
+/**
+    \brief solves all equations from input stream and prints results to output stream
+    \param[in] input stream with records
+    \param[in] output writer of results
+    \param[in] outputPrecision maximum number of digits of roots
+    \param[in] pool threads, that solve chunks of records (if NULL, everything is done in calling thread)
+    \param[out] stats number of processed and malformed records
+*/
+QuadEqErrors runBatchMode(FILE* input, struct ResultWriter* output, int outputPrecision, struct ThreadPool* pool,
+                          struct BatchModeStats* stats);
+
+/**
+    \brief same as runBatchMode(), but regular files are read through mmap (see mappedInput.hpp) without copying
+    \param[in] fileName name of file with records, if it's not a regular file, it's read as stream
+*/
+QuadEqErrors runBatchModeOnFile(const char* fileName, struct ResultWriter* output, int outputPrecision, struct ThreadPool* pool,
+                                struct BatchModeStats* stats);
+
+/**
+    \brief converts text records to binary columnar file (see columnarFormat.hpp) with coefficients and answers
+
+    File is created with double precision and solved by vectorized solver.
+    Malformed records are passed to error sink (see errorReporting.hpp) and skipped.
+    \param[in] fileName name of regular file with records (it is read twice, so stdin can't be used)
+    \param[in] columnarFileName name of created binary file
+    \param[in] pool threads, that solve equations (can be NULL)
+    \param[out] stats number of processed and malformed records
+*/
+QuadEqErrors runBatchModeToColumnar(const char* fileName, const char* columnarFileName, struct ThreadPool* pool,
+                                    struct BatchModeStats* stats);
+
+/**
+    \brief prints result line of one equation
+    \param[in] numOfSols number of solutions
+    \param[in] root_1 first root (ignored if there are no roots)
+    \param[in] root_2 second root (ignored if there are less than 2 roots)
+    \param[in] outputPrecision maximum number of digits of roots
+*/
+void printBatchResult(struct ResultWriter* output, QuadEqRootState numOfSols, long double root_1, long double root_2,
+                      int outputPrecision);
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef COLUMNAR_FORMAT_HEADER
+#define COLUMNAR_FORMAT_HEADER
+
+/**
+    \file
+    \brief binary columnar format for equations and their answers
+
+    File looks like this:
+    \code
+    offset 0               ColumnarHeader (128 bytes)
+    columnOffsets[A]       a[0], a[1], ..., a[count - 1]
+    columnOffsets[B]       b[0], ...
+    ...                    every present column starts at offset, that is multiple of 64
+    \endcode
+    Coefficients and roots are stored as double (COLUMNAR_PRECISION_F64) or as x87 long double
+    in 16 bytes (COLUMNAR_PRECISION_F80), numbers of solutions are stored as QuadEqRootState (4 bytes).
+    Everything is in native (little endian) byte order, so mapped file can be solved without parsing and copying.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "quadraticEquation.hpp"
+#include "threadPool.hpp"
+#include "resultWriter.hpp"
+
+/// @brief first 8 bytes of every columnar file
+const char     COLUMNAR_MAGIC[8]  = {'Q', 'U', 'A', 'D', 'C', 'O', 'L', '\0'};
+/// @brief version of format, files with other versions are rejected
+const uint32_t COLUMNAR_VERSION   = 1;
+/// @brief alignment of every column (size of cache line)
+const size_t   COLUMNAR_ALIGNMENT = 64;
+
+/// @brief type of coefficients and roots
+enum ColumnarPrecision {
+    COLUMNAR_PRECISION_F64 = 1, ///< double, 8 bytes, solved by vectorized solver
+    COLUMNAR_PRECISION_F80 = 2, ///< long double, 16 bytes (only 10 of them are used)
+};
+
+/// @brief columns of file, present columns are marked in ColumnarHeader::columns by bits (1 << column)
+enum ColumnarColumn {
+    COLUMNAR_COLUMN_A           = 0, ///< coefficients at x^2
+    COLUMNAR_COLUMN_B           = 1, ///< coefficients at x
+    COLUMNAR_COLUMN_C           = 2, ///< "free" coefficients
+    COLUMNAR_COLUMN_ROOT_1      = 3, ///< first roots
+    COLUMNAR_COLUMN_ROOT_2      = 4, ///< second roots
+    COLUMNAR_COLUMN_NUM_OF_SOLS = 5, ///< number of solutions
+    COLUMNAR_NUM_OF_COLUMNS     = 6,
+};
+
+/// @brief mask of coefficient columns
+const uint32_t COLUMNAR_COEF_COLUMNS   = (1u << COLUMNAR_COLUMN_A) | (1u << COLUMNAR_COLUMN_B) |
+                                         (1u << COLUMNAR_COLUMN_C);
+/// @brief mask of answer columns
+const uint32_t COLUMNAR_ANSWER_COLUMNS = (1u << COLUMNAR_COLUMN_ROOT_1) | (1u << COLUMNAR_COLUMN_ROOT_2) |
+                                         (1u << COLUMNAR_COLUMN_NUM_OF_SOLS);
+
+/// @brief header of columnar file, occupies 2 cache lines
+struct ColumnarHeader {
+    char     magic[8];                                ///< COLUMNAR_MAGIC
+    uint32_t version;                                 ///< COLUMNAR_VERSION
+    uint32_t precision;                               ///< ColumnarPrecision
+    uint64_t count;                                   ///< number of equations
+    uint32_t columns;                                 ///< bit mask of present columns
+    uint32_t elementSize;                             ///< size of one coefficient (or root) in bytes
+    uint64_t columnOffsets[COLUMNAR_NUM_OF_COLUMNS];  ///< offset of every column from beginning of file, 0 if absent
+    uint8_t  reserved[48];                            ///< zeros
+};
+
+static_assert(sizeof(ColumnarHeader) == 2 * COLUMNAR_ALIGNMENT, "header should occupy exactly 2 cache lines");
+static_assert(sizeof(QuadEqRootState) == 4, "numbers of solutions are stored in 4 bytes");
+
+/// @brief mapped columnar file
+struct ColumnarFile {
+    int                   fd;          ///< descriptor of file, -1 for buffers in memory
+    unsigned char*        mapping;     ///< whole file
+    size_t                mappingSize; ///< size of file
+    const ColumnarHeader* header;      ///< header at the beginning of mapping
+};
+
+/**
+    \brief checks that both names refer to the same existing file (same device and inode)
+    \note output is truncated by createColumnarFile(), so it should not be input, that is mapped for reading
+*/
+bool isSameFile(const char* firstName, const char* secondName);
+
+/**
+    \brief creates file with given columns (contents of columns are zeros) and maps it for writing
+    \param[in] fileName name of file, it is rewritten if exists
+    \param[in] precision type of coefficients and roots
+    \param[in] count number of equations
+    \param[in] columns bit mask of columns, for example COLUMNAR_COEF_COLUMNS | COLUMNAR_ANSWER_COLUMNS
+    \param[out] file mapped file
+    \memberof ColumnarFile
+*/
+QuadEqErrors createColumnarFile(const char* fileName, ColumnarPrecision precision, size_t count, uint32_t columns,
+                                struct ColumnarFile* file);
+
+/**
+    \brief same as createColumnarFile(), but columns are stored in anonymous memory instead of file
+    \memberof ColumnarFile
+*/
+QuadEqErrors createColumnarBuffer(ColumnarPrecision precision, size_t count, uint32_t columns,
+                                  struct ColumnarFile* file);
+
+/**
+    \brief maps existing file and checks it's header
+    \param[in] isWritable if true, columns can be changed (and changes are saved to file)
+    \result QUAD_EQ_ERRORS_INVALID_FILE if file can't be opened or it's not a correct columnar file
+    \memberof ColumnarFile
+*/
+QuadEqErrors openColumnarFile(const char* fileName, bool isWritable, struct ColumnarFile* file);
+
+/**
+    \brief unmaps and closes file
+    \memberof ColumnarFile
+*/
+QuadEqErrors closeColumnarFile(struct ColumnarFile* file);
+
+/**
+    \brief decreases number of equations in writable file (columns are not moved, their tails become unused)
+
+    Useful when number of equations is not known in advance: file is created for upper bound and then shrinked.
+    \memberof ColumnarFile
+*/
+QuadEqErrors setColumnarCount(struct ColumnarFile* file, size_t count);
+
+/**
+    \brief returns pointer to column (array of count elements), NULL if column is absent
+    \memberof ColumnarFile
+*/
+void* getColumnarColumn(const struct ColumnarFile* file, ColumnarColumn column);
+
+/**
+    \brief solves equations from coefficient columns of input and writes answers to answer columns of output
+
+    F64 files are solved by vectorized solver, F80 files - by long double solver,
+    roots are written directly into mapping of output.
+    \param[in] input file with coefficients
+    \param[in] pool threads, that solve file (if NULL, file is solved in calling thread)
+    \param[out] output file with answer columns, same precision and count, can be the same file as input
+    \memberof ColumnarFile
+*/
+QuadEqErrors solveColumnarFile(const struct ColumnarFile* input, struct ColumnarFile* output, struct ThreadPool* pool);
+
+/**
+    \brief copies coefficient columns from one file to another with the same precision and count
+    \memberof ColumnarFile
+*/
+QuadEqErrors copyColumnarCoefs(const struct ColumnarFile* source, struct ColumnarFile* destination);
+
+/**
+    \brief prints answers from file in text format of batch mode (see batchMode.hpp)
+    \param[in] outputPrecision maximum number of digits of roots
+    \memberof ColumnarFile
+*/
+QuadEqErrors printColumnarAnswers(const struct ColumnarFile* file, struct ResultWriter* output, int outputPrecision);
+
+#endif
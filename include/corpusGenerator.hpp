@@ -0,0 +1,175 @@
+#ifndef CORPUS_GENERATOR_HEADER
+#define CORPUS_GENERATOR_HEADER
+
+/**
+    \file
+    \brief generator of big tests corpora: equations are built from sampled roots
+
+    Roots are sampled first, coefficients are built from them by Vieta's formulas:
+    \code
+    a = k,  b = -k * (root_1 + root_2),  c = k * root_1 * root_2
+    \endcode
+    so expected answer is known without solving. Roots are m / 2^p (|m| < 2^CORPUS_ROOT_BITS), k is integer
+    (|k| < 2^CORPUS_FACTOR_BITS), so every coefficient fits into double exactly, discriminant is computed exactly
+    in long double and every root turns equation to exact zero (isValidTest() accepts all generated tests).
+    Equations with two roots always have k > 0, so roots are in ascending order, as solver returns them.
+
+    Corpus is written as tests file (format of testsLoader.hpp) or as compact binary file:
+    \code
+    offset 0    CorpusHeader (64 bytes)
+    offset 64   CorpusRecord[count] (48 bytes each)
+    \endcode
+    Binary file is recognized by loadTestsFile() by it's magic, so it can be given to --test as is.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "quadraticEquation.hpp"
+#include "resultWriter.hpp"
+#include "testsLoader.hpp"
+
+/// @brief kinds of generated equations
+enum CorpusTestKind {
+    CORPUS_TWO_ROOTS       = 0, ///< two distinct roots, discriminant is far from 0
+    CORPUS_ONE_ROOT        = 1, ///< double root, discriminant is exactly 0
+    CORPUS_NO_ROOTS        = 2, ///< vertex is above (or below) axis, discriminant is far from 0
+    CORPUS_LINEAR          = 3, ///< a = 0, one root (or no roots if b = 0 too)
+    CORPUS_INFINITE_ROOTS  = 4, ///< a = b = c = 0
+    CORPUS_NEAR_DEGENERATE = 5, ///< two very close roots (or no roots), discriminant is tiny relative to b^2
+    CORPUS_EXTREME         = 6, ///< one of kinds above, scaled so that biggest coefficient is close to MAX_COEF_ABS_VALUE
+    CORPUS_NUM_OF_KINDS    = 7,
+};
+
+/// @brief names of kinds in mix (see parseCorpusMix()), in order of CorpusTestKind
+const char* const CORPUS_KIND_NAMES[CORPUS_NUM_OF_KINDS] = {"two", "one", "none", "linear", "inf", "near", "extreme"};
+
+/// @brief weights of kinds, that are used, if mix is not stated
+const uint32_t CORPUS_DEFAULT_WEIGHTS[CORPUS_NUM_OF_KINDS] = {5, 2, 3, 2, 1, 2, 1};
+/// @brief maximum weight of one kind in mix
+const uint32_t CORPUS_MAX_WEIGHT        = 1000000;
+/// @brief seed, that is used, if it's not stated
+const uint64_t CORPUS_DEFAULT_SEED      = 2024;
+
+/// @brief numerators of roots are less than 2^CORPUS_ROOT_BITS by absolute value
+const int CORPUS_ROOT_BITS   = 20;
+/// @brief leading coefficients are less than 2^CORPUS_FACTOR_BITS by absolute value
+const int CORPUS_FACTOR_BITS = 10;
+
+/// @brief format of generated corpus
+enum CorpusFormat {
+    CORPUS_FORMAT_TEXT   = 0, ///< tests file, one number per line, tests are separated by '#'
+    CORPUS_FORMAT_BINARY = 1, ///< CorpusHeader and CorpusRecord's
+};
+
+/// @brief first 8 bytes of binary corpus
+const char     CORPUS_MAGIC[8] = {'Q', 'U', 'A', 'D', 'T', 'S', 'T', '\0'};
+/// @brief version of binary format, files with other versions are rejected
+const uint32_t CORPUS_VERSION  = 1;
+
+/// @brief header of binary corpus, occupies one cache line
+struct CorpusHeader {
+    char     magic[8];      ///< CORPUS_MAGIC
+    uint32_t version;       ///< CORPUS_VERSION
+    uint32_t recordSize;    ///< sizeof(CorpusRecord)
+    uint64_t count;         ///< number of records
+    uint8_t  reserved[40];  ///< zeros
+};
+
+/// @brief one test of binary corpus, also the result of generateCorpusRecord()
+struct CorpusRecord {
+    double  a;
+    double  b;
+    double  c;
+    double  root_1;         ///< 0 if equation has no roots (or infinitely many)
+    double  root_2;         ///< equal to root_1, if equation has one root
+    uint8_t numOfSols;      ///< QuadEqRootState
+    uint8_t kind;           ///< CorpusTestKind
+    uint8_t reserved[6];    ///< zeros
+};
+
+static_assert(sizeof(CorpusHeader) == 64, "header should occupy one cache line");
+static_assert(sizeof(CorpusRecord) == 48, "record should have no hidden padding");
+
+/// @brief settings of generator
+struct CorpusGeneratorConfig {
+    uint64_t seed;                             ///< same seed and weights give same corpus
+    uint32_t weights[CORPUS_NUM_OF_KINDS];     ///< kind is chosen with probability weight / sum of weights
+};
+
+/// @brief state of generator, all fields are private
+struct CorpusGenerator {
+    uint64_t randomState;
+    uint32_t weightBounds[CORPUS_NUM_OF_KINDS]; ///< prefix sums of weights
+    uint32_t totalWeight;
+};
+
+/// @brief number of generated tests of every kind
+struct CorpusStats {
+    size_t numOfTests;
+    size_t numOfKind[CORPUS_NUM_OF_KINDS];
+};
+
+/**
+    \brief fills config with default seed and weights
+    \memberof CorpusGeneratorConfig
+*/
+void setDefaultCorpusConfig(struct CorpusGeneratorConfig* config);
+
+/**
+    \brief parses mix of kinds like "two=5,one=2,near=1", kinds, that are not stated, get weight 0
+    \param[in] mix comma separated pairs name=weight, names are from CORPUS_KIND_NAMES
+    \param[out] config weights are changed only if mix is correct
+    \result QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT if mix is incorrect or all weights are 0
+    \memberof CorpusGeneratorConfig
+*/
+QuadEqErrors parseCorpusMix(const char* mix, struct CorpusGeneratorConfig* config);
+
+/**
+    \brief prepares generator
+    \result QUAD_EQ_ERRORS_ILLEGAL_ARG if all weights are 0 or their sum is too big
+    \memberof CorpusGenerator
+*/
+QuadEqErrors initCorpusGenerator(struct CorpusGenerator* generator, const struct CorpusGeneratorConfig* config);
+
+/**
+    \brief generates next test
+    \param[out] record equation and it's answer
+    \memberof CorpusGenerator
+*/
+void generateCorpusRecord(struct CorpusGenerator* generator, struct CorpusRecord* record);
+
+/**
+    \brief converts record to Test
+    \memberof CorpusGenerator
+*/
+void corpusRecordToTest(const struct CorpusRecord* record, struct Test* test);
+
+/**
+    \brief generates corpus and writes it in given format
+    \param[in] numOfTests number of generated tests
+    \param[out] output text or binary corpus goes here (it can be stdout, corpus is streamed by blocks)
+    \param[out] stats number of tests of every kind, can be NULL
+*/
+QuadEqErrors writeCorpus(const struct CorpusGeneratorConfig* config, size_t numOfTests, CorpusFormat format,
+                         struct ResultWriter* output, struct CorpusStats* stats);
+
+/**
+    \brief generates corpus directly into arena (without text or binary form)
+    \param[out] arena tests are added to the end of it
+*/
+QuadEqErrors generateCorpusTests(const struct CorpusGeneratorConfig* config, size_t numOfTests,
+                                 struct TestsArena* arena);
+
+/**
+    \brief checks if data starts with CORPUS_MAGIC
+*/
+bool isCorpusBinary(const void* data, size_t size);
+
+/**
+    \brief adds all tests of binary corpus to arena
+    \result QUAD_EQ_ERRORS_INVALID_FILE if version, size of record or size of data is wrong
+*/
+QuadEqErrors parseCorpusBinary(const void* data, size_t size, struct TestsArena* arena);
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef EQUATION_ANALYSIS_HEADER
+#define EQUATION_ANALYSIS_HEADER
+
+/**
+    \file
+    \brief everything, that is known about equation, computed at once
+
+    getVertX(), getVertY(), getSolutions() and others validate equation on every call and compute discriminant
+    again and again. analyzeEquation() validates equation once, computes discriminant once and gets vertex,
+    roots and intervals of constant sign from it.
+    LazyEquationAnalysis does the same on demand: every value is computed on first request and then remembered.
+*/
+
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+
+/// @brief maximum number of intervals of constant sign (two roots split line into three parts)
+const size_t MAX_NUM_OF_SIGN_INTERVALS = 3;
+
+/// @brief interval (from, to), where equation keeps sign, ends are -HUGE_VALL and HUGE_VALL for infinite ones
+struct SignInterval {
+    long double from;
+    long double to;
+    int         sign;  ///< -1, 0 or 1, sign of a * x ^ 2 + b * x + c inside of interval
+};
+
+/// @brief result of analyzeEquation()
+struct QuadraticEquationAnalysis {
+    bool                    isQuadratic;  ///< a != 0, only then vertex and axis exist
+    long double             discriminant;
+    long double             vertX;        ///< axis of symmetry is x = vertX, 0 if equation is not quadratic
+    long double             vertY;        ///< 0 if equation is not quadratic
+    QuadraticEquationAnswer answer;       ///< same as getSolutions() gives
+    size_t                  numOfIntervals;
+    SignInterval            intervals[MAX_NUM_OF_SIGN_INTERVALS];  ///< sorted from left to right, cover whole line
+};
+
+/**
+    \brief computes discriminant, vertex, roots and intervals of constant sign of equation
+    \param[in] eq given equation
+    \param[out] analysis found values
+*/
+QuadEqErrors analyzeEquation(const struct QuadraticEquation* eq, struct QuadraticEquationAnalysis* analysis);
+
+/// @brief flags of values, that LazyEquationAnalysis has already computed
+enum LazyAnalysisParts {
+    LAZY_ANALYSIS_DISCRIMINANT = 1 << 0,
+    LAZY_ANALYSIS_VERTEX       = 1 << 1,
+    LAZY_ANALYSIS_SOLUTIONS    = 1 << 2,
+    LAZY_ANALYSIS_INTERVALS    = 1 << 3,
+};
+
+/// @brief analysis of one equation, that computes values on first request and remembers them
+struct LazyEquationAnalysis {
+    QuadraticEquation         eq;
+    QuadEqErrors              validationError; ///< result of validation in initLazyAnalysis()
+    unsigned                  computedParts;   ///< LazyAnalysisParts
+    QuadraticEquationAnalysis analysis;        ///< only computed parts are filled
+};
+
+/**
+    \brief copies and validates equation, nothing else is computed
+    \param[out] lazy analysis object
+    \param[in] eq given equation
+*/
+QuadEqErrors initLazyAnalysis(struct LazyEquationAnalysis* lazy, const struct QuadraticEquation* eq);
+
+/**
+    \brief returns discriminant of equation
+*/
+QuadEqErrors getLazyDiscriminant(struct LazyEquationAnalysis* lazy, long double* discriminant);
+
+/**
+    \brief returns vertex of parabola
+    \result QUAD_EQ_ERRORS_LINEAR_EQ if a = 0
+*/
+QuadEqErrors getLazyVertex(struct LazyEquationAnalysis* lazy, long double* vertX, long double* vertY);
+
+/**
+    \brief returns roots of equation, same as getSolutions()
+*/
+QuadEqErrors getLazySolutions(struct LazyEquationAnalysis* lazy, struct QuadraticEquationAnswer* answer);
+
+/**
+    \brief returns intervals of constant sign
+    \param[out] intervals array of MAX_NUM_OF_SIGN_INTERVALS elements
+    \param[out] numOfIntervals number of filled intervals
+*/
+QuadEqErrors getLazySignIntervals(struct LazyEquationAnalysis* lazy, struct SignInterval* intervals, size_t* numOfIntervals);
+
+#endif
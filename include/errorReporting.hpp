@@ -0,0 +1,116 @@
+#ifndef ERROR_REPORTING_HEADER
+#define ERROR_REPORTING_HEADER
+
+/**
+    \file
+    \brief where errors of library go: caller-supplied error sink and compile-time log threshold
+
+    Functions of library return error codes and never write to console by themselves.
+    Every failure is passed to error sink, that is installed by setErrorSink(), no sink (default) means
+    that errors are only returned. Program, that wants old behaviour (log + red message in stderr),
+    installs printErrorSink().
+
+    Logging is cut at compile time by QUAD_EQ_LOG_LEVEL (-DQUAD_EQ_LOG_LEVEL=0 or make LOG_LEVEL=0):
+    calls of disabled levels are compiled to nothing, so their arguments are not even evaluated.
+    Enabled levels go through asynchronous backend (asyncLogger.hpp), that writes them synchronously until it's started.
+    With QUAD_EQ_LOG_LEVEL_NONE errors are not passed to sink either.
+*/
+
+#include "quadraticEquation.hpp"
+#include "asyncLogger.hpp"
+
+#define QUAD_EQ_LOG_LEVEL_NONE    0 ///< nothing is logged or reported, errors are only returned
+#define QUAD_EQ_LOG_LEVEL_ERROR   1
+#define QUAD_EQ_LOG_LEVEL_WARNING 2
+#define QUAD_EQ_LOG_LEVEL_INFO    3
+#define QUAD_EQ_LOG_LEVEL_DEBUG   4
+
+#ifndef QUAD_EQ_LOG_LEVEL
+    #define QUAD_EQ_LOG_LEVEL QUAD_EQ_LOG_LEVEL_DEBUG
+#endif
+
+#if QUAD_EQ_LOG_LEVEL >= QUAD_EQ_LOG_LEVEL_ERROR
+    #define QUAD_EQ_LOG_ERROR(...)   ASYNC_LOG(ERROR, __VA_ARGS__)
+#else
+    #define QUAD_EQ_LOG_ERROR(...)   do {} while(0)
+#endif
+
+#if QUAD_EQ_LOG_LEVEL >= QUAD_EQ_LOG_LEVEL_WARNING
+    #define QUAD_EQ_LOG_WARNING(...) ASYNC_LOG(WARNING, __VA_ARGS__)
+#else
+    #define QUAD_EQ_LOG_WARNING(...) do {} while(0)
+#endif
+
+#if QUAD_EQ_LOG_LEVEL >= QUAD_EQ_LOG_LEVEL_INFO
+    #define QUAD_EQ_LOG_INFO(...)    ASYNC_LOG(INFO, __VA_ARGS__)
+#else
+    #define QUAD_EQ_LOG_INFO(...)    do {} while(0)
+#endif
+
+#if QUAD_EQ_LOG_LEVEL >= QUAD_EQ_LOG_LEVEL_DEBUG
+    #define QUAD_EQ_LOG_DEBUG(...)   ASYNC_LOG(DEBUG, __VA_ARGS__)
+#else
+    #define QUAD_EQ_LOG_DEBUG(...)   do {} while(0)
+#endif
+
+/**
+    handy pointer to error sink
+    \code
+    typedef void (*QuadEqErrorSink)(QuadEqErrors error, const char* file, const char* function, int line, void* userData);
+    \endcode
+    file, function and line are place, where error was returned, userData is pointer given to setErrorSink().
+    Errors of input data (see REPORT_INPUT_ERROR) have function NULL, file and line are name of input and line in it.
+*/
+typedef void (*QuadEqErrorSink)(QuadEqErrors error, const char* file, const char* function, int line, void* userData);
+
+/**
+    \brief installs error sink
+    \param[in] sink function, that gets every error of library, NULL to only return error codes
+    \param[in] userData passed to sink as is
+    \warning should be called before threads, that use library, are started, sink can be called from any of them
+*/
+void setErrorSink(QuadEqErrorSink sink, void* userData);
+
+/**
+    \brief returns installed error sink (NULL if there is none) and it's userData, so that it can be restored later
+*/
+void getErrorSink(QuadEqErrorSink* sink, void** userData);
+
+/**
+    \brief sink, that logs error and prints it's message to stderr (behaviour of libRun)
+*/
+void printErrorSink(QuadEqErrors error, const char* file, const char* function, int line, void* userData);
+
+/**
+    \brief passes error to installed sink, does nothing if there is no sink
+
+    Function is out of line and marked cold, so error paths don't slow down loops, that contain them.
+*/
+__attribute__((cold)) void reportError(QuadEqErrors error, const char* file, const char* function, int line);
+
+#if QUAD_EQ_LOG_LEVEL >= QUAD_EQ_LOG_LEVEL_ERROR
+    #define LOG_AND_RETURN(ERROR)                                       \
+        do {                                                            \
+            reportError(ERROR, __FILE__, __FUNCTION__, __LINE__);       \
+            return ERROR;                                               \
+        } while(0)
+#else
+    #define LOG_AND_RETURN(ERROR)                                       \
+        do {                                                            \
+            return ERROR;                                               \
+        } while(0)
+#endif
+
+/**
+    reports error in input data (for example, malformed record of batch), that is not returned:
+    processing goes on, sink gets NULL as function, name of input as file and number of line in it
+*/
+#if QUAD_EQ_LOG_LEVEL >= QUAD_EQ_LOG_LEVEL_ERROR
+    #define REPORT_INPUT_ERROR(ERROR, INPUT_NAME, LINE_NUMBER)          \
+        reportError(ERROR, INPUT_NAME, NULL, (int)(LINE_NUMBER))
+#else
+    #define REPORT_INPUT_ERROR(ERROR, INPUT_NAME, LINE_NUMBER)          \
+        do { (void)(ERROR); (void)(INPUT_NAME); (void)(LINE_NUMBER); } while(0)
+#endif
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef EXACT_SOLVER_HEADER
+#define EXACT_SOLVER_HEADER
+
+/**
+    \file
+    \brief exact solver for equations with integer (or rational) coefficients
+
+    Coefficients are brought to common denominator (it does not change roots),
+    so equation becomes a * x ^ 2 + b * x + c with integer a, b, c.
+    Discriminant b ^ 2 - 4 * a * c is computed exactly in __int128
+    (it fits, because |a|, |b|, |c| <= MAX_COEF_ABS_VALUE = 1e18), so number of roots is found without any EPSILON.
+    If discriminant is a perfect square, roots are rational and are reported exactly, as fractions.
+*/
+
+#include "quadraticEquation.hpp"
+
+/// @brief fraction numerator / denominator, always reduced and denominator is positive
+struct ExactRational {
+    long long numerator;   ///< numerator of fraction
+    long long denominator; ///< denominator of fraction, > 0
+};
+
+/**
+    \brief equation with integer coefficients
+
+    Real equation is (a / denominator) * x ^ 2 + (b / denominator) * x + (c / denominator),
+    it has the same roots as a * x ^ 2 + b * x + c.
+*/
+struct IntegerQuadraticEquation {
+    long long a;           ///< coefficient at x^2
+    long long b;           ///< coefficient at x
+    long long c;           ///< "free" coefficient
+    long long denominator; ///< common denominator of all coefficients, > 0
+};
+
+/// @brief answer of exact solver
+struct ExactQuadraticEquationAnswer {
+    QuadraticEquationAnswer answer;  ///< number of roots and roots as long double (always filled)
+    __int128 discriminant;           ///< exact b ^ 2 - 4 * a * c (0 for linear equations)
+    bool areRootsRational;           ///< if true, exactRoot_1 and exactRoot_2 are filled
+    struct ExactRational exactRoot_1; ///< first root, as fraction
+    struct ExactRational exactRoot_2; ///< second root, as fraction
+};
+
+/**
+    \brief parses rational number: integer ("-12"), decimal fraction ("0.581") or fraction ("7/3")
+
+    \param[in] line string with number, may end with blanks and new line
+    \param[out] coef parsed fraction
+    \param[out] result false if number has another format or is too big
+*/
+QuadEqErrors parseExactCoef(const char* line, struct ExactRational* coef, bool* result);
+
+/**
+    \brief builds integer equation from 3 rational coefficients
+    \param[out] result false if coefficients become bigger than MAX_COEF_ABS_VALUE after bringing to common denominator
+*/
+QuadEqErrors buildIntegerEquation(const struct ExactRational coefs[3], struct IntegerQuadraticEquation* eq, bool* result);
+
+/**
+    \brief solves equation exactly
+    \param[in] eq given equation, coefficients should not be bigger than MAX_COEF_ABS_VALUE
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors getSolutionsExact(const struct IntegerQuadraticEquation* eq, struct ExactQuadraticEquationAnswer* answer);
+
+/**
+    \brief prints found solutions: rational roots as fractions, irrational ones as formula and approximate value
+    \param[in] eq solved equation
+    \param[in] answer found roots
+    \param[in] outputPrecision maximum number of digits of approximate values
+*/
+QuadEqErrors printExactSolutions(const struct IntegerQuadraticEquation* eq,
+                                 const struct ExactQuadraticEquationAnswer* answer, int outputPrecision);
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef MAPPED_INPUT_HEADER
+#define MAPPED_INPUT_HEADER
+
+/**
+    \file
+    \brief reader of big text files, that works through mmap without copying
+
+    Only a window of file (MAPPED_INPUT_WINDOW_SIZE bytes) is mapped at once, when reader reaches it's end,
+    window slides forward, so files bigger than RAM (or address space) can be read.
+    Lines are returned as pointers into mapping, they are valid only until next call of readMappedLine().
+*/
+
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+
+/// @brief size of mapped part of file, multiple of page size
+const size_t MAPPED_INPUT_WINDOW_SIZE = (size_t)64 << 20;
+
+/// @brief state of reader, all fields are private
+struct MappedInput {
+    int         fd;             ///< descriptor of file
+    size_t      fileSize;       ///< size of file in bytes
+    const char* window;         ///< mapped part of file, NULL if nothing is mapped
+    size_t      windowOffset;   ///< offset of window in file, multiple of page size
+    size_t      windowSize;     ///< size of mapped part
+    size_t      position;       ///< offset of next unread byte in file
+};
+
+/**
+    \brief opens file and prepares it for reading
+    \param[in] fileName name of file
+    \param[out] input reader
+    \result QUAD_EQ_ERRORS_INVALID_FILE if file can't be opened or it's not a regular file (pipe, terminal...)
+    \memberof MappedInput
+*/
+QuadEqErrors openMappedInput(const char* fileName, struct MappedInput* input);
+
+/**
+    \brief unmaps window and closes file
+    \memberof MappedInput
+*/
+QuadEqErrors closeMappedInput(struct MappedInput* input);
+
+/**
+    \brief returns next line of file (without '\\n')
+    \param[out] lineBegin pointer to first symbol of line
+    \param[out] lineEnd pointer after last symbol of line
+    \param[out] isEnd true if there are no more lines, lineBegin and lineEnd are not changed then
+    \warning line is valid only until next call
+    \memberof MappedInput
+*/
+QuadEqErrors readMappedLine(struct MappedInput* input, const char** lineBegin, const char** lineEnd, bool* isEnd);
+
+/**
+    \brief parses one number from [begin, end) with locale independent parser
+
+    Number should occupy whole range, leading '+' is allowed.
+    Number is parsed as double (same as strtod() did) and then converted to long double.
+    \param[out] coef parsed number
+    \param[out] result false if range is not a correct finite number (or it is out of range of double)
+*/
+QuadEqErrors parseNumberFast(const char* begin, const char* end, long double* coef, bool* result);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef MODULE_TESTS_HEADER
+#define MODULE_TESTS_HEADER
+
+/**
+    \file
+    \brief behaviour tests of modules, they are run by testsRun after myTests
+
+    myTests (testsGenerator.cpp) check only answers of solver. These tests check modules around it: answers should
+    survive round trips through caches and files, other solvers and APIs should agree with getSolutions().
+    Temporary files are created in own directory under /tmp and removed after tests.
+*/
+
+#include "testsGenerator.hpp"
+
+/**
+    \brief runs all module tests, prints every failed check
+    \result ALL_TESTS_PASSED or FAILED_ON_SOME_TEST
+*/
+CheckOnTestsState runModuleTests();
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef PARABOLA_TABULATION_HEADER
+#define PARABOLA_TABULATION_HEADER
+
+/**
+    \file
+    \brief evaluation of parabolas at many points at once
+
+    Values a * x ^ 2 + b * x + c are computed by Horner scheme (a * x + b) * x + c in double,
+    several points at a time, with the same instruction set as vectorized solver (see getSimdLevel()).
+    Coefficients and points are validated once per call, if any of them is too big nothing is computed.
+*/
+
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+#include "quadraticEquationSimd.hpp"
+
+/**
+    \brief evaluates equation at every point of array
+    \param[in] eq given equation
+    \param[in] x points
+    \param[in] count number of points
+    \param[out] values values[i] is value at x[i]
+*/
+QuadEqErrors tabulateParabola(const struct QuadraticEquation* eq, const double* x, size_t count, double* values);
+
+/**
+    \brief evaluates equation at points start, start + step, ..., start + (count - 1) * step
+    \param[in] eq given equation
+    \param[in] start first point
+    \param[in] step distance between neighbouring points
+    \param[in] count number of points
+    \param[out] values values[i] is value at start + i * step
+*/
+QuadEqErrors tabulateParabolaRange(const struct QuadraticEquation* eq, double start, double step, size_t count,
+                                   double* values);
+
+/**
+    \brief evaluates every equation of batch at every point of shared grid
+    \param[in] batch given equations
+    \param[in] x points
+    \param[in] numOfPoints number of points
+    \param[out] values batch->count x numOfPoints matrix (row per equation), values[i * numOfPoints + j] is
+                value of i-th equation at x[j]
+*/
+QuadEqErrors tabulateParabolas(const struct QuadraticEquationDoubleBatch* batch, const double* x, size_t numOfPoints,
+                               double* values);
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef QUAD_SOLVER_C_HEADER
+#define QUAD_SOLVER_C_HEADER
+
+/**
+    \file
+    \brief stable C interface of libquadsolver.so / libquadsolver.a
+
+    Header can be included from C and C++. Only functions from this file are exported by library,
+    they never print or log anything, all problems are reported by returned error codes.
+    Layout of structures and values of enums are part of ABI: they are changed only together with
+    QUAD_SOLVER_VERSION_MAJOR (and soname libquadsolver.so.MAJOR), new functions increase minor version.
+*/
+
+#include <stddef.h>
+
+#define QUAD_SOLVER_VERSION_MAJOR 1
+#define QUAD_SOLVER_VERSION_MINOR 0
+#define QUAD_SOLVER_VERSION_PATCH 0
+
+/// @brief version as one number, like 0x010000 for 1.0.0
+#define QUAD_SOLVER_VERSION                                                                   \
+    ((QUAD_SOLVER_VERSION_MAJOR << 16) | (QUAD_SOLVER_VERSION_MINOR << 8) | QUAD_SOLVER_VERSION_PATCH)
+
+// library is built with -fvisibility=hidden, so only marked functions are exported
+#if defined(QUAD_SOLVER_BUILD) && defined(__GNUC__)
+    #define QUAD_SOLVER_API __attribute__((visibility("default")))
+#else
+    #define QUAD_SOLVER_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief error codes, same values as QuadEqErrors
+enum QsError {
+    QS_ERROR_OK               = 0,
+    QS_ERROR_ILLEGAL_ARG      = 2, ///< NULL pointer
+    QS_ERROR_VALUE_IS_TOO_BIG = 3, ///< absolute value of coefficient (or point) is bigger than 1e18
+    QS_ERROR_LINEAR_EQ        = 5, ///< vertex of equation with a = 0 is asked
+};
+
+/// @brief number of roots, same values as QuadEqRootState
+enum QsRootState {
+    QS_NO_ROOTS       = 0,
+    QS_ONE_ROOT       = 1,
+    QS_TWO_ROOTS      = 2,
+    QS_INFINITE_ROOTS = 3,
+};
+
+/// @brief equation a * x ^ 2 + b * x + c
+typedef struct QsEquation {
+    long double a;
+    long double b;
+    long double c;
+} QsEquation;
+
+/// @brief roots of equation, if it has no roots (or infinitely many), both roots are 0
+typedef struct QsAnswer {
+    long double root_1;
+    long double root_2;
+    int         numOfSols; ///< QsRootState
+} QsAnswer;
+
+/**
+    \brief returns version of loaded library, QUAD_SOLVER_VERSION of header it was built with
+*/
+QUAD_SOLVER_API unsigned qsGetVersion(void);
+
+/**
+    \brief returns static string with description of error, "unknown error" for unknown codes
+*/
+QUAD_SOLVER_API const char* qsGetErrorMessage(int error);
+
+/**
+    \brief gets solutions of equation
+    \param[in] eq given equation
+    \param[out] answer found roots and info about their cnt
+    \result QsError
+*/
+QUAD_SOLVER_API int qsGetSolutions(const QsEquation* eq, QsAnswer* answer);
+
+/**
+    \brief returns discriminant b ^ 2 - 4 * a * c
+    \result QsError, QS_ERROR_VALUE_IS_TOO_BIG if coefficients are invalid (as in qsGetSolutions())
+*/
+QUAD_SOLVER_API int qsGetDiscriminant(const QsEquation* eq, long double* result);
+
+/**
+    \brief returns x coordinate of vertex of parabola, QS_ERROR_LINEAR_EQ if a = 0
+*/
+QUAD_SOLVER_API int qsGetVertX(const QsEquation* eq, long double* result);
+
+/**
+    \brief returns y coordinate of vertex of parabola, QS_ERROR_LINEAR_EQ if a = 0
+*/
+QUAD_SOLVER_API int qsGetVertY(const QsEquation* eq, long double* result);
+
+/**
+    \brief returns value of a * x ^ 2 + b * x + c
+*/
+QUAD_SOLVER_API int qsGetPointValue(const QsEquation* eq, long double x, long double* result);
+
+/**
+    \brief gets solutions of many equations, coefficients and answers are separate arrays of count elements
+
+    All coefficients are validated before solving, so if any of them is invalid nothing is solved.
+    \param[out] numOfSols QsRootState of every equation
+*/
+QUAD_SOLVER_API int qsGetSolutionsArray(size_t count, const long double* a, const long double* b, const long double* c,
+                                        long double* root_1, long double* root_2, int* numOfSols);
+
+/**
+    \brief same as qsGetSolutionsArray(), but in double precision (faster, less precise)
+*/
+QUAD_SOLVER_API int qsGetSolutionsArrayDouble(size_t count, const double* a, const double* b, const double* c,
+                                              double* root_1, double* root_2, int* numOfSols);
+
+/**
+    \brief gets values of equation at count points
+    \param[in] x array of count points
+    \param[out] values array of count values
+*/
+QUAD_SOLVER_API int qsGetPointValues(const QsEquation* eq, size_t count, const long double* x, long double* values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
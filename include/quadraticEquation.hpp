@@ -8,8 +8,22 @@
     In this file prototypes of all methods of class QuadraticEquation are declared
 */
 
+#include <stddef.h>
+
 const int DEFAULT_PRECISION = 10;
 
+/**
+    \warning should be around 1e18, otherwise there might be errors with overflow
+    (cause long double MAX is around 1e36 and we use square of inputed values)
+*/
+constexpr long double MAX_COEF_ABS_VALUE = 1e18; ///< maximum absolute value that coefficient can take
+
+/**
+    epsilon, regulates with what precision we work
+    \warning Should not be too small, otherwise there might be some errors with precision
+*/
+constexpr long double EPSILON = 1e-9; ///< regulates with what precision we work
+
 /// @brief enum that contains errors
 enum QuadEqErrors {
     QUAD_EQ_ERRORS_OK                    = 0,
@@ -19,7 +33,8 @@ enum QuadEqErrors {
     QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT = 4,
     QUAD_EQ_ERRORS_LINEAR_EQ             = 5,
     QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG   = 6,
-    QUAD_EQ_ERRORS_INVALID_EQUATION      = 7
+    QUAD_EQ_ERRORS_INVALID_EQUATION      = 7,
+    QUAD_EQ_ERRORS_MEMORY_ALLOCATION     = 8
 };
 
 /**
@@ -83,6 +98,31 @@ struct QuadraticEquationAnswer {
     QuadEqRootState numOfSols; ///< number of solutions equation has
 };
 
+/**
+    \brief Structure of arrays with coefficients of many equations
+
+    i-th equation looks like this: a[i] * x ^ 2 + b[i] * x + c[i].
+    Each array should contain at least count elements.
+*/
+struct QuadraticEquationBatch {
+    size_t count;         ///< number of equations in batch
+    const long double* a; ///< coefficients at x^2
+    const long double* b; ///< coefficients at x
+    const long double* c; ///< "free" coefficients
+};
+
+/**
+    \brief Structure of arrays, that is filled by getSolutionsBatch()
+
+    i-th elements of arrays are answer to i-th equation of batch.
+    If equation has no roots (or infinitely many), both roots are set to 0.
+*/
+struct QuadraticEquationBatchAnswer {
+    long double*     root_1;    ///< first roots of equations
+    long double*     root_2;    ///< second roots of equations
+    QuadEqRootState* numOfSols; ///< number of solutions of each equation
+};
+
 
 
 
@@ -146,21 +186,39 @@ QuadEqErrors getVertY(const struct QuadraticEquation* eq, long double* result);
 */
 QuadEqErrors getSolutions(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer); ///< \memberof QuadraticEquation
 
+/**
+    handy pointer to a solver function
+    \code
+    typedef void (*getSolutionsFuncPtr)(const struct QuadraticEquation*, struct QuadraticEquationAnswer*);
+    \endcode
+*/
+typedef QuadEqErrors (*getSolutionsFuncPtr)(const struct QuadraticEquation*, struct QuadraticEquationAnswer*);
+
+/**
+    \brief gets solutions of many equations at once
+
+    All coefficients are validated once, before solving, so if any of them is invalid nothing is solved.
+    Results are the same as if getSolutions() was called for every equation.
+    \param[in] batch given equations
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors getSolutionsBatch(const struct QuadraticEquationBatch* batch, struct QuadraticEquationBatchAnswer* answer);
+
+struct ResultWriter; // resultWriter.hpp
+
 /**
     \brief prints found solutions
     \param[in] answer found roots and info about their cnt
     \param[in] outputPrecision maximum number of digits after comma
-    \param[in] outputFile can be equal to "", if len > 0 then output goes to file
-    \warning outputFile should be a correct file name
+    \param[in] output writer, that stays open for whole run (see resultWriter.hpp), NULL means stdout
 */
-QuadEqErrors printSolutions(const struct QuadraticEquationAnswer* answer, int outputPrecision, const char* outputFile); ///< \memberof QuadraticEquation
+QuadEqErrors printSolutions(const struct QuadraticEquationAnswer* answer, int outputPrecision, struct ResultWriter* output); ///< \memberof QuadraticEquation
 
 /**
     \brief solves equation and prints found solutions
     \param[in] eq given equation
-    \param[in] outputFile can be equal to NULL (means that output goes to stdout), if len > 0 then output goes to file
-    \warning outputFile should be a correct file name
+    \param[in] output writer, that stays open for whole run (see resultWriter.hpp), NULL means stdout
 */
-QuadEqErrors solveAndPrintEquation(const struct QuadraticEquation* eq, const char* outputFile); ///< \memberof QuadraticEquation
+QuadEqErrors solveAndPrintEquation(const struct QuadraticEquation* eq, struct ResultWriter* output); ///< \memberof QuadraticEquation
 
 #endif
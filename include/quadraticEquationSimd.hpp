@@ -0,0 +1,81 @@
+#ifndef QUADRATIC_EQUATION_SIMD_HEADER
+#define QUADRATIC_EQUATION_SIMD_HEADER
+
+/**
+    \file
+    \brief vectorized solver of many quadratic equations
+
+    x87 long double can not be vectorized, so this solver works with double coefficients.
+    Equations are classified and solved several at a time (2 with SSE2, 4 with AVX2, 8 with AVX-512),
+    without branches: all cases are computed and then blended by masks.
+    Instruction set is chosen at startup from CPUID, if nothing is supported scalar path is used.
+*/
+
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+
+/// @brief instruction sets that vectorized solver can use
+enum SimdLevel {
+    SIMD_LEVEL_SCALAR = 0, ///< no vectorization, one equation at a time
+    SIMD_LEVEL_SSE2   = 1, ///< 2 equations at a time
+    SIMD_LEVEL_AVX2   = 2, ///< 4 equations at a time
+    SIMD_LEVEL_AVX512 = 3, ///< 8 equations at a time
+};
+
+/**
+    \brief Structure of arrays with double coefficients of many equations
+
+    i-th equation looks like this: a[i] * x ^ 2 + b[i] * x + c[i].
+*/
+struct QuadraticEquationDoubleBatch {
+    size_t count;    ///< number of equations in batch
+    const double* a; ///< coefficients at x^2
+    const double* b; ///< coefficients at x
+    const double* c; ///< "free" coefficients
+};
+
+/**
+    \brief Structure of arrays, that is filled by getSolutionsBatchSimd()
+
+    If equation has no roots (or infinitely many), both roots are set to 0.
+*/
+struct QuadraticEquationDoubleBatchAnswer {
+    double*          root_1;    ///< first roots of equations
+    double*          root_2;    ///< second roots of equations
+    QuadEqRootState* numOfSols; ///< number of solutions of each equation
+};
+
+/**
+    \brief returns best instruction set supported by this CPU
+*/
+SimdLevel getSupportedSimdLevel();
+
+/**
+    \brief returns instruction set that is currently used by getSolutionsBatchSimd()
+*/
+SimdLevel getSimdLevel();
+
+/**
+    \brief forces solver to use given instruction set (by default best supported is used)
+    \param[in] level instruction set, should be supported by CPU
+*/
+QuadEqErrors setSimdLevel(SimdLevel level);
+
+/**
+    \brief returns name of instruction set
+    \param[in] level instruction set
+*/
+const char* getSimdLevelName(SimdLevel level);
+
+/**
+    \brief gets solutions of many equations at once, using vector instructions
+
+    All coefficients are validated once, before solving, so if any of them is invalid nothing is solved.
+    \param[in] batch given equations
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors getSolutionsBatchSimd(const struct QuadraticEquationDoubleBatch* batch,
+                                   struct QuadraticEquationDoubleBatchAnswer* answer);
+
+#endif
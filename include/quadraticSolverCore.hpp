@@ -0,0 +1,245 @@
+#ifndef QUADRATIC_SOLVER_CORE_HEADER
+#define QUADRATIC_SOLVER_CORE_HEADER
+
+/**
+    \file
+    \brief solver core, templated on type of coefficients
+
+    Type is chosen at compile time: float (fastest, lowest precision), double,
+    long double (used by C-style API from quadraticEquation.hpp) or __float128 (high precision, slow).
+    Precision and range of each type are described by SolverPrecisionTraits.
+    Discriminant is compared with absolute EPSILON, float also compares it with it's own rounding error
+    (DISC_RELATIVE_EPSILON), because for big coefficients one ulp of float discriminant is much bigger than EPSILON.
+    Functions from this file never print or log anything, they only return error codes.
+*/
+
+#include <stddef.h>
+#include <math.h>
+
+#include "quadraticEquation.hpp"
+
+#if defined(__SIZEOF_FLOAT128__)
+    /// __float128 instantiation is available only on compilers that support this type
+    #define QUAD_SOLVER_HAS_FLOAT128 1
+#endif
+
+/**
+    \brief describes precision and range of coefficient type
+    \warning should be specialized for every type, that solver is used with
+*/
+template <typename Scalar>
+struct SolverPrecisionTraits;
+
+template <>
+struct SolverPrecisionTraits<float> {
+    static constexpr float EPSILON               = 1e-5f; ///< float has only ~7 significant digits
+    static constexpr float MAX_COEF_ABS_VALUE    = 1e18f; ///< squares still fit into float (max is ~3e38)
+    /// error of b * b - 4 * a * c is less than FLT_EPSILON * (b * b + |4 * a * c|), it's doubled for safety
+    static constexpr float DISC_RELATIVE_EPSILON = 2 * __FLT_EPSILON__;
+
+    static float getAbs (float x) { return fabsf(x); }
+    static float getSqrt(float x) { return sqrtf(x); }
+};
+
+template <>
+struct SolverPrecisionTraits<double> {
+    static constexpr double EPSILON               = 1e-9;
+    static constexpr double MAX_COEF_ABS_VALUE    = 1e18;
+    static constexpr double DISC_RELATIVE_EPSILON = 0; ///< only absolute EPSILON, as in long double
+
+    static double getAbs (double x) { return fabs(x); }
+    static double getSqrt(double x) { return sqrt(x); }
+};
+
+template <>
+struct SolverPrecisionTraits<long double> {
+    static constexpr long double EPSILON               = ::EPSILON;
+    static constexpr long double MAX_COEF_ABS_VALUE    = ::MAX_COEF_ABS_VALUE;
+    static constexpr long double DISC_RELATIVE_EPSILON = 0;
+
+    static long double getAbs (long double x) { return fabsl(x); }
+    static long double getSqrt(long double x) { return sqrtl(x); }
+};
+
+#ifdef QUAD_SOLVER_HAS_FLOAT128
+template <>
+struct SolverPrecisionTraits<__float128> {
+    /// same as for long double, so classification of equations is the same, only roots are more precise
+    static constexpr __float128 EPSILON               = (__float128)::EPSILON;
+    static constexpr __float128 MAX_COEF_ABS_VALUE    = (__float128)::MAX_COEF_ABS_VALUE;
+    static constexpr __float128 DISC_RELATIVE_EPSILON = 0;
+
+    static __float128 getAbs(__float128 x) { return x < 0 ? -x : x; }
+
+    /// one Newton step from long double root doubles number of correct bits (64 -> 113), so libquadmath is not needed
+    static __float128 getSqrt(__float128 x) {
+        if (x <= 0) return 0;
+        __float128 root = sqrtl((long double)x);
+        return (root + x / root) / 2;
+    }
+};
+#endif
+
+/// @brief quadratic equation a * x ^ 2 + b * x + c with coefficients of given type
+template <typename Scalar>
+struct QuadraticEquationT {
+    Scalar a; ///< coefficient at x^2
+    Scalar b; ///< coefficient at x
+    Scalar c; ///< "free" coefficient
+};
+
+/// @brief answer to QuadraticEquationT, same as QuadraticEquationAnswer
+template <typename Scalar>
+struct QuadraticEquationAnswerT {
+    Scalar root_1;             ///< first root of equation
+    Scalar root_2;             ///< second root of equation
+    QuadEqRootState numOfSols; ///< number of solutions equation has
+};
+
+typedef QuadraticEquationT<float>             QuadraticEquationF32;       ///< throughput mode
+typedef QuadraticEquationT<double>            QuadraticEquationF64;       ///< double mode
+typedef QuadraticEquationAnswerT<float>       QuadraticEquationAnswerF32; ///< throughput mode
+typedef QuadraticEquationAnswerT<double>      QuadraticEquationAnswerF64; ///< double mode
+#ifdef QUAD_SOLVER_HAS_FLOAT128
+typedef QuadraticEquationT<__float128>        QuadraticEquationF128;       ///< high precision mode
+typedef QuadraticEquationAnswerT<__float128>  QuadraticEquationAnswerF128; ///< high precision mode
+#endif
+
+/// @brief returns sign of x, values that are closer to 0 than EPSILON of type are treated as 0
+template <typename Scalar>
+static inline int signT(Scalar x) {
+    if (x < -SolverPrecisionTraits<Scalar>::EPSILON) return -1;
+    return x > SolverPrecisionTraits<Scalar>::EPSILON;
+}
+
+/// @brief checks that absolute value of coefficient is not too big, NaN is not valid
+template <typename Scalar>
+static inline bool isCoefValidT(Scalar coef) {
+    typedef SolverPrecisionTraits<Scalar> Traits;
+    // same as signT(...) <= 0, but comparison with NaN is false, so NaN doesn't pass
+    return Traits::getAbs(coef) - Traits::MAX_COEF_ABS_VALUE <= Traits::EPSILON;
+}
+
+/// @brief b ^ 2 - 4 * a * c
+template <typename Scalar>
+static inline Scalar computeDiscriminantT(Scalar a, Scalar b, Scalar c) {
+    return b * b - 4 * a * c;
+}
+
+/**
+    \brief sign of discriminant, values that are closer to 0 than EPSILON or than rounding error of discriminant
+    (for types with DISC_RELATIVE_EPSILON) are treated as 0
+*/
+template <typename Scalar>
+static inline int signDiscriminantT(Scalar b, Scalar disc) {
+    typedef SolverPrecisionTraits<Scalar> Traits;
+    if constexpr (Traits::DISC_RELATIVE_EPSILON <= 0) {
+        return signT<Scalar>(disc);
+    } else {
+        // 4 * a * c = b * b - disc, so size of both terms is known without a and c
+        Scalar bound = Traits::DISC_RELATIVE_EPSILON * (b * b + Traits::getAbs(b * b - disc));
+        if (bound < Traits::EPSILON)
+            bound = Traits::EPSILON;
+        if (disc < -bound) return -1;
+        return disc > bound;
+    }
+}
+
+/**
+    \brief solves equation with a != 0, which discriminant is already computed
+    \warning coefficients should be already validated
+    \warning if equation has no roots, roots are not changed
+*/
+template <typename Scalar>
+static inline void solveQuadraticWithDiscriminantT(Scalar a, Scalar b, Scalar disc,
+                                                   Scalar* root_1, Scalar* root_2, QuadEqRootState* numOfSols) {
+    int discSign = signDiscriminantT<Scalar>(b, disc);
+    /// negative disc -> no solutions
+    if (discSign < 0) {
+        *numOfSols = NO_ROOTS;
+        return;
+    }
+
+    // disc can be slightly negative here (but still equal to zero with EPSILON precision)
+    Scalar discRoot = disc > 0 ? SolverPrecisionTraits<Scalar>::getSqrt(disc) : 0;
+    Scalar denom = 1 / (2 * a);
+    *root_1 = (-b - discRoot) * denom;
+    /// we have 2 distinct solutions in case if disc != 0
+    if (discSign != 0) {
+        *root_2 = (-b + discRoot) * denom;
+        *numOfSols = TWO_ROOTS;
+    } else {
+        *root_2 = *root_1;
+        *numOfSols = ONE_ROOT;
+    }
+}
+
+/**
+    \brief solves equation without any checks
+    \warning coefficients should be already validated
+    \warning if equation has no roots (or infinitely many), roots are not changed
+*/
+template <typename Scalar>
+static inline void solveValidatedEquationT(Scalar a, Scalar b, Scalar c,
+                                           Scalar* root_1, Scalar* root_2, QuadEqRootState* numOfSols) {
+    // linear case
+    if (signT<Scalar>(a) == 0) {
+        if (signT<Scalar>(b) == 0) {
+            *numOfSols = signT<Scalar>(c) ? NO_ROOTS : INFINITE_ROOTS;
+            return;
+        }
+
+        *root_1 = *root_2 = -c / b;
+        *numOfSols = ONE_ROOT;
+        return;
+    }
+
+    solveQuadraticWithDiscriminantT<Scalar>(a, b, computeDiscriminantT<Scalar>(a, b, c), root_1, root_2, numOfSols);
+}
+
+/**
+    \brief core function, gets solutions of quadratic equation
+    \param[in] eq given equation
+    \param[out] answer found roots and info about their cnt
+*/
+template <typename Scalar>
+static inline QuadEqErrors getSolutionsT(const QuadraticEquationT<Scalar>* eq, QuadraticEquationAnswerT<Scalar>* answer) {
+    if (eq == NULL || answer == NULL)
+        return QUAD_EQ_ERRORS_ILLEGAL_ARG;
+
+    if (!isCoefValidT<Scalar>(eq->a) || !isCoefValidT<Scalar>(eq->b) || !isCoefValidT<Scalar>(eq->c))
+        return QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG;
+
+    solveValidatedEquationT<Scalar>(eq->a, eq->b, eq->c, &answer->root_1, &answer->root_2, &answer->numOfSols);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/**
+    \brief gets solutions of many equations, coefficients and answers are given as separate arrays
+
+    All coefficients are validated once, before solving, so if any of them is invalid nothing is solved.
+    If equation has no roots (or infinitely many), both roots are set to 0.
+*/
+template <typename Scalar>
+static inline QuadEqErrors getSolutionsBatchT(size_t count, const Scalar* a, const Scalar* b, const Scalar* c,
+                                              Scalar* root_1, Scalar* root_2, QuadEqRootState* numOfSols) {
+    if (count == 0)
+        return QUAD_EQ_ERRORS_OK;
+
+    if (a == NULL || b == NULL || c == NULL || root_1 == NULL || root_2 == NULL || numOfSols == NULL)
+        return QUAD_EQ_ERRORS_ILLEGAL_ARG;
+
+    // validation is done once for whole batch, so solving loop has no error checks
+    for (size_t i = 0; i < count; ++i)
+        if (!isCoefValidT<Scalar>(a[i]) || !isCoefValidT<Scalar>(b[i]) || !isCoefValidT<Scalar>(c[i]))
+            return QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG;
+
+    for (size_t i = 0; i < count; ++i) {
+        root_1[i] = root_2[i] = 0;
+        solveValidatedEquationT<Scalar>(a[i], b[i], c[i], &root_1[i], &root_2[i], &numOfSols[i]);
+    }
+
+    return QUAD_EQ_ERRORS_OK;
+}
+
+#endif
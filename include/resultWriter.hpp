@@ -0,0 +1,88 @@
+#ifndef RESULT_WRITER_HEADER
+#define RESULT_WRITER_HEADER
+
+/**
+    \file
+    \brief buffered sink for results, that stays open for whole run
+
+    Text is formatted into big user space buffer and goes to stream only by big writes (when buffer is full
+    or writer is flushed). Numbers are formatted with std::to_chars() instead of printf, see formatResultNumber().
+*/
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+
+/// @brief size of buffer, stream is written by blocks of this size
+const size_t RESULT_WRITER_BUFFER_SIZE = (size_t)1 << 20;
+
+/// @brief maximum length of one number formatted by formatResultNumber()
+const size_t RESULT_NUMBER_MAX_LEN = 128;
+
+/// @brief state of writer, all fields are private
+struct ResultWriter {
+    FILE*        stream;        ///< stream, where buffer is flushed
+    bool         isOwnStream;   ///< stream was opened by writer, so it's closed by writer
+    char*        buffer;        ///< formatted text, that wasn't written yet
+    size_t       size;          ///< number of bytes in buffer
+    QuadEqErrors error;         ///< first error of writing, all next writes are ignored
+};
+
+/**
+    \brief opens writer
+    \param[in] fileName name of output file, if NULL text goes to stdout
+    \param[out] writer opened writer
+    \memberof ResultWriter
+*/
+QuadEqErrors openResultWriter(const char* fileName, struct ResultWriter* writer);
+
+/**
+    \brief opens writer over already opened stream (stream is not closed by writer)
+    \memberof ResultWriter
+*/
+QuadEqErrors openResultWriterOnStream(FILE* stream, struct ResultWriter* writer);
+
+/**
+    \brief writes buffered text to stream
+    \result first error, that occured while writing
+    \memberof ResultWriter
+*/
+QuadEqErrors flushResultWriter(struct ResultWriter* writer);
+
+/**
+    \brief flushes writer, frees buffer and closes file (if it was opened by writer)
+    \memberof ResultWriter
+*/
+QuadEqErrors closeResultWriter(struct ResultWriter* writer);
+
+/**
+    \brief appends len bytes of text to writer
+    \memberof ResultWriter
+*/
+void writeResultChars(struct ResultWriter* writer, const char* text, size_t len);
+
+/**
+    \brief appends null terminated string to writer
+    \memberof ResultWriter
+*/
+void writeResultString(struct ResultWriter* writer, const char* text);
+
+/**
+    \brief appends number, formatted by formatResultNumber()
+    \memberof ResultWriter
+*/
+void writeResultNumber(struct ResultWriter* writer, long double number, int outputPrecision);
+
+/**
+    \brief formats number with at most outputPrecision significant digits (same meaning as "%.*Lg")
+
+    Precision up to DBL_DIG is formatted from double (it's much faster, result differs from "%.*Lg" only
+    if number is closer to rounding boundary than precision of double). Precision of at least LDBL_DECIMAL_DIG
+    gives shortest text, that is read back to the same long double, instead of exact binary value.
+    \param[out] buffer at least RESULT_NUMBER_MAX_LEN bytes, result is not null terminated
+    \result pointer after last written symbol
+*/
+char* formatResultNumber(char* buffer, long double number, int outputPrecision);
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef SHARED_CHANNEL_HEADER
+#define SHARED_CHANNEL_HEADER
+
+/**
+    \file
+    \brief submission channel in shared memory, for producers on the same host as resident solver
+
+    Channel is POSIX shared memory object (shm_open()), producers attach to it by name:
+    \code
+    offset 0        SharedChannelHeader (256 bytes)
+    offset 256      capacity slots of SharedChannelSlot (192 bytes)
+    \endcode
+    Slots form bounded lock-free ring (multiple producers, single consumer, every slot has sequence number).
+    For slot with position pos sequence means:
+    \code
+    pos             slot is free, producer can take it by moving header->enqueuePos
+    pos + 1         equation is written, solver can take it
+    pos + 2         answer is written, producer can read it
+    pos + capacity  answer is read, slot is free for next lap
+    \endcode
+    Producer owns slot from submit until it reads answer, so answer slot and equation slot are the same.
+    Idle solver sleeps on futex header->submitFutex, producer sleeps on futex of it's slot,
+    futexes are woken only if somebody sleeps, so busy channel makes no system calls.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+#include "threadPool.hpp"
+
+/// @brief first 8 bytes of shared memory object
+const char     SHARED_CHANNEL_MAGIC[8]         = {'Q', 'U', 'A', 'D', 'C', 'H', 'N', '\0'};
+/// @brief version of layout, channels with other versions are rejected
+const uint32_t SHARED_CHANNEL_VERSION          = 1;
+/// @brief number of slots, if 0 is given to createSharedChannel()
+const size_t   SHARED_CHANNEL_DEFAULT_CAPACITY = 1 << 12;
+/// @brief maximum number of slots, that solver takes at once
+const size_t   SHARED_CHANNEL_MAX_BATCH        = 1 << 10;
+
+/// @brief header of channel, fields, written by different sides, are on different cache lines
+struct SharedChannelHeader {
+    char     magic[8];          ///< SHARED_CHANNEL_MAGIC
+    uint32_t version;           ///< SHARED_CHANNEL_VERSION
+    uint32_t slotSize;          ///< sizeof(SharedChannelSlot)
+    uint64_t capacity;          ///< number of slots, power of 2
+    uint32_t isSolverRunning;   ///< 0 after solver has stopped, producers don't wait for answers anymore
+    uint8_t  reserved0[36];
+
+    uint64_t enqueuePos;        ///< position of next slot for producers
+    uint8_t  reserved1[56];
+
+    uint32_t submitFutex;       ///< incremented after every submit, idle solver waits on it
+    uint32_t numOfSolverWaiters; ///< 1 while solver sleeps
+    uint8_t  reserved2[56];
+
+    uint64_t dequeuePos;        ///< position of next slot for solver, written only by solver
+    uint64_t numOfSolved;       ///< number of solved equations, written only by solver
+    uint8_t  reserved3[48];
+};
+
+/// @brief one request and it's answer, occupies 3 cache lines
+struct SharedChannelSlot {
+    uint64_t                sequence;     ///< see description of file
+    uint32_t                answerFutex;  ///< incremented after answer is written, producer waits on it
+    uint32_t                numOfWaiters; ///< 1 while producer sleeps
+    QuadraticEquation       eq;
+    QuadraticEquationAnswer answer;
+    uint32_t                error;        ///< QuadEqErrors of getSolutions()
+    uint8_t                 reserved[60];
+};
+
+static_assert(sizeof(SharedChannelHeader) == 256, "header should occupy 4 cache lines");
+static_assert(sizeof(SharedChannelSlot)   == 192, "slot should occupy 3 cache lines");
+
+/// @brief mapped channel
+struct SharedChannel {
+    SharedChannelHeader* header;
+    SharedChannelSlot*   slots;
+    size_t               mappingSize;
+    bool                 isOwner;  ///< channel was created by this process, it's removed on close
+    char                 name[256];
+};
+
+/**
+    \brief creates channel (existing channel with the same name is replaced), called by solver
+    \param[in] name name of shared memory object, like "/quadraticSolver"
+    \param[in] capacity number of slots (rounded up to power of 2), 0 means SHARED_CHANNEL_DEFAULT_CAPACITY
+    \param[out] channel mapped channel
+*/
+QuadEqErrors createSharedChannel(const char* name, size_t capacity, struct SharedChannel* channel);
+
+/**
+    \brief attaches to existing channel, called by producers
+    \param[in] name name of shared memory object
+    \param[out] channel mapped channel
+*/
+QuadEqErrors openSharedChannel(const char* name, struct SharedChannel* channel);
+
+/**
+    \brief unmaps channel, creator also removes shared memory object
+*/
+void closeSharedChannel(struct SharedChannel* channel);
+
+/**
+    \brief solves submitted equations until SIGINT or SIGTERM
+    \param[in] channel channel, created by createSharedChannel()
+    \param[in] pool threads, that solve big groups of equations (if NULL, everything is done in calling thread)
+*/
+QuadEqErrors runSharedChannelSolver(struct SharedChannel* channel, struct ThreadPool* pool);
+
+/**
+    \brief writes equation to free slot, waits if channel is full
+    \param[in] channel channel
+    \param[in] eq given equation
+    \param[out] ticket position of slot, answer is taken by waitSharedChannelAnswer()
+*/
+QuadEqErrors submitToSharedChannel(struct SharedChannel* channel, const struct QuadraticEquation* eq, uint64_t* ticket);
+
+/**
+    \brief waits for answer of submitted equation and frees it's slot
+
+    Every ticket should be waited exactly once, slots are reused in order of tickets.
+    \param[in] channel channel
+    \param[in] ticket ticket from submitToSharedChannel()
+    \param[out] answer found roots and info about their cnt
+    \result error of solving, QUAD_EQ_ERRORS_INVALID_FILE if solver has stopped
+*/
+QuadEqErrors waitSharedChannelAnswer(struct SharedChannel* channel, uint64_t ticket, struct QuadraticEquationAnswer* answer);
+
+/**
+    \brief submits equation and waits for it's answer
+    \param[in] channel channel
+    \param[in] eq given equation
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors solveOnSharedChannel(struct SharedChannel* channel, const struct QuadraticEquation* eq,
+                                  struct QuadraticEquationAnswer* answer);
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef SOLUTIONS_CACHE_HEADER
+#define SOLUTIONS_CACHE_HEADER
+
+/**
+    \file
+    \brief memoization cache in front of getSolutions()
+
+    Proportional equations have the same roots, so key of equation is it's coefficients divided by a
+    (b / a, c / a), or c / b for linear equations. Division is correctly rounded, so exactly proportional
+    coefficients give exactly the same key. Discriminant is compared with absolute EPSILON, so key of quadratic
+    equation contains binary exponent of a too, and equations with discriminant near EPSILON are not cached:
+    proportional equations with the same key are classified by solver in the same way.
+    Equations with a = b = 0 are solved directly, they are cheaper than lookup.
+
+    Cache is set associative: every key can be stored only in one set of SOLUTIONS_CACHE_WAYS entries,
+    set is evicted by CLOCK (second chance) policy. Memory is bounded by capacity given to createSolutionsCache().
+    Every set has it's own spin lock, so cache can be used from several threads.
+*/
+
+#include <stdio.h>
+
+#include "quadraticEquation.hpp"
+
+/// @brief number of entries in one set
+const size_t SOLUTIONS_CACHE_WAYS = 8;
+
+/// @brief counters of cache, they show hit rate
+struct SolutionsCacheStats {
+    unsigned long long numOfHits;      ///< answer was taken from cache
+    unsigned long long numOfMisses;    ///< equation was solved and added to cache
+    unsigned long long numOfEvictions; ///< entry was replaced by new one
+    unsigned long long numOfUncached;  ///< equation with a = b = 0 or discriminant near EPSILON, it's not cached
+};
+
+/**
+    \brief creates global cache, previous cache (if it exists) is destroyed
+    \param[in] capacity maximum number of cached equations, rounded up to power of 2 sets, 0 disables cache
+*/
+QuadEqErrors createSolutionsCache(size_t capacity);
+
+/**
+    \brief frees global cache, after that getSolutionsCached() works as solver of cache
+*/
+void destroySolutionsCache();
+
+/**
+    \brief sets solver of cache misses and of equations, that are not cached (getSolutions() by default)
+    \note cached answers are not dropped, so solver should be set before cache is used
+    \param[in] solver implementation with interface of getSolutions(), NULL returns default one
+*/
+void setSolutionsCacheSolver(getSolutionsFuncPtr solver);
+
+/**
+    \brief checks that cache was created
+*/
+bool isSolutionsCacheEnabled();
+
+/**
+    \brief gets solutions of quadratic equation through cache, same interface as getSolutions()
+    \param[in] eq given equation
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors getSolutionsCached(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer);
+
+/**
+    \brief same as getSolutionsBatch(), but every equation goes through cache
+*/
+QuadEqErrors getSolutionsBatchCached(const struct QuadraticEquationBatch* batch,
+                                     struct QuadraticEquationBatchAnswer* answer);
+
+/**
+    \brief returns counters of cache
+*/
+SolutionsCacheStats getSolutionsCacheStats();
+
+/**
+    \brief sets all counters of cache to 0
+*/
+void resetSolutionsCacheStats();
+
+/**
+    \brief prints counters of cache and hit rate
+    \param[in] stream where to print
+*/
+void printSolutionsCacheStats(FILE* stream);
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef SOLUTIONS_STORE_HEADER
+#define SOLUTIONS_STORE_HEADER
+
+/**
+    \file
+    \brief persistent on-disk store of solutions, shared between runs and processes
+
+    File is open addressing hash table (a, b, c) -> answer with linear probing:
+    \code
+    offset 0        SolutionsStoreHeader (64 bytes)
+    offset 64       capacity slots of SolutionsStoreSlot (96 bytes)
+    \endcode
+    Slots are never moved or deleted, so mapped file can be read by any number of processes without locks.
+    Only one process (the one that holds exclusive flock() of file) appends new answers, others only read.
+    Writer fills slot first and then marks it as filled (release store), reader checks mark (acquire load)
+    before reading slot, so it never sees half written answer.
+
+    Table is never resized in place (readers map it once), new answers are dropped when load factor reaches
+    SOLUTIONS_STORE_MAX_LOAD. Compaction rebuilds file with bigger capacity and replaces old one by rename(),
+    processes, that have old file mapped, continue to use it.
+
+    Header keeps name of solver, that filled file. Implementations can give different answers (see solverRegistry.hpp),
+    so file is opened only with the same solver, otherwise answers of one solver would be returned as answers of other.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "quadraticEquation.hpp"
+
+/// @brief first 8 bytes of every store file
+const char     SOLUTIONS_STORE_MAGIC[8]          = {'Q', 'U', 'A', 'D', 'S', 'T', 'R', '\0'};
+/// @brief version of format, files with other versions are rejected
+const uint32_t SOLUTIONS_STORE_VERSION           = 2;
+/// @brief number of slots of new file
+const uint64_t SOLUTIONS_STORE_DEFAULT_CAPACITY  = 1 << 20;
+/// @brief maximum share of filled slots, longer probe sequences make lookups slow
+const double   SOLUTIONS_STORE_MAX_LOAD          = 0.75;
+/// @brief size of field with name of solver (including '\\0'), longer names can't be used with store
+const size_t   SOLUTIONS_STORE_SOLVER_NAME_SIZE  = 24;
+
+/// @brief state of slot
+enum SolutionsStoreSlotState {
+    SOLUTIONS_STORE_SLOT_EMPTY  = 0,
+    SOLUTIONS_STORE_SLOT_FILLED = 1,
+};
+
+/// @brief header of store file, occupies 1 cache line
+struct SolutionsStoreHeader {
+    char     magic[8];      ///< SOLUTIONS_STORE_MAGIC
+    uint32_t version;       ///< SOLUTIONS_STORE_VERSION
+    uint32_t slotSize;      ///< sizeof(SolutionsStoreSlot)
+    uint64_t capacity;      ///< number of slots, power of 2
+    uint64_t numOfEntries;  ///< number of filled slots, written only by writer
+    char     solverName[SOLUTIONS_STORE_SOLVER_NAME_SIZE]; ///< solver, that filled file, ends with '\\0'
+    uint8_t  reserved[8];   ///< zeros
+};
+
+/// @brief one entry of table, coefficients are stored exactly (-0 is stored as +0)
+struct SolutionsStoreSlot {
+    long double a;
+    long double b;
+    long double c;
+    long double root_1;
+    long double root_2;
+    uint32_t    numOfSols;  ///< QuadEqRootState
+    uint32_t    state;      ///< SolutionsStoreSlotState
+    uint8_t     reserved[8];
+};
+
+static_assert(sizeof(SolutionsStoreHeader) == 64, "header should occupy exactly 1 cache line");
+static_assert(sizeof(SolutionsStoreSlot)   == 96, "slot should occupy exactly 96 bytes");
+
+/// @brief counters of store
+struct SolutionsStoreStats {
+    unsigned long long numOfHits;     ///< answer was found in file
+    unsigned long long numOfMisses;   ///< answer was not found, equation was solved
+    unsigned long long numOfAppended; ///< answers added to file by this process
+    unsigned long long numOfDropped;  ///< answers, that were not added, because file is full (or opened read only)
+};
+
+/**
+    \brief opens (or creates) global store
+
+    If no other process writes to file, this process becomes writer, otherwise file is opened read only.
+    \param[in] fileName name of file
+    \param[in] solverName name of solver, it's written into new file and compared with name in existing one
+    \param[in] solver function, that solves equations, which are not found in file (for example getSolutions)
+    \result QUAD_EQ_ERRORS_ILLEGAL_ARG if file was filled by other solver (or name is too long),
+            QUAD_EQ_ERRORS_INVALID_FILE if file can't be opened or it's not a correct store
+*/
+QuadEqErrors openSolutionsStore(const char* fileName, const char* solverName, getSolutionsFuncPtr solver);
+
+/**
+    \brief unmaps and closes global store
+*/
+void closeSolutionsStore();
+
+/**
+    \brief checks that store is opened
+*/
+bool isSolutionsStoreOpened();
+
+/**
+    \brief gets solutions through store, same interface as getSolutions()
+
+    Can be called from several threads, appends of one process are serialized.
+    \param[in] eq given equation
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors getSolutionsStored(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer);
+
+/**
+    \brief rebuilds store file with capacity for 4 times more entries than it has (so probe sequences are short)
+
+    Name of solver is copied to new file.
+    \param[in] fileName name of file, no other process should write to it
+    \param[out] numOfEntries number of entries in compacted file
+*/
+QuadEqErrors compactSolutionsStore(const char* fileName, size_t* numOfEntries);
+
+/**
+    \brief returns counters of store
+*/
+SolutionsStoreStats getSolutionsStoreStats();
+
+/**
+    \brief sets all counters of store to 0
+*/
+void resetSolutionsStoreStats();
+
+/**
+    \brief prints counters of store and hit rate
+    \param[in] stream where to print
+*/
+void printSolutionsStoreStats(FILE* stream);
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef SOLVER_REGISTRY_HEADER
+#define SOLVER_REGISTRY_HEADER
+
+/**
+    \file
+    \brief registry of named solver implementations and their autotuning
+
+    Every implementation has interface of getSolutions() (getSolutionsFuncPtr), so it can be given to Tester,
+    accuracy harness or thread pool as is. Built-in implementations:
+    \code
+    long-double   getSolutions(), solver core in long double (default)
+    double        solver core in double
+    branch-free   double, all cases are computed and selected without branches (scalar form of SIMD kernels)
+    adaptive      getSolutionsAdaptive(), double with escalation to long double
+    reference     solver core in __float128 (only if compiler supports it), slow
+    \endcode
+    Other implementations can be added by registerSolver(). Autotuning runs every implementation on calibration
+    corpus: implementation should pass checkOnTests(), fastest of passed ones is chosen.
+*/
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+#include "testsGenerator.hpp"
+
+/// @brief maximum number of registered implementations
+const size_t SOLVER_REGISTRY_CAPACITY        = 16;
+/// @brief name, that asks for autotuning instead of concrete implementation
+const char* const SOLVER_AUTO_NAME           = "auto";
+/// @brief implementation, that is used, if nothing is stated
+const char* const SOLVER_DEFAULT_NAME        = "long-double";
+/// @brief number of tests in calibration corpus, they are generated with default config
+const size_t SOLVER_CALIBRATION_NUM_OF_TESTS = (size_t)1 << 14;
+/// @brief every implementation is run so many times over calibration corpus, best time is taken
+const int    SOLVER_CALIBRATION_NUM_OF_RUNS  = 5;
+
+/// @brief named implementation of getSolutions()
+struct SolverImplementation {
+    const char*         name;
+    const char*         description;
+    getSolutionsFuncPtr solver;
+};
+
+/// @brief result of calibration of one implementation
+struct SolverCalibration {
+    const SolverImplementation* implementation;
+    bool                        isPassed;        ///< checkOnTests() passed on calibration corpus
+    int                         failedTest;      ///< first failed test, if it's not passed
+    double                      nsPerEquation;   ///< best of SOLVER_CALIBRATION_NUM_OF_RUNS runs
+};
+
+/**
+    \brief adds implementation to registry
+    \param[in] name unique name, it can't be SOLVER_AUTO_NAME (string is not copied)
+    \result QUAD_EQ_ERRORS_ILLEGAL_ARG if name is taken or registry is full
+*/
+QuadEqErrors registerSolver(const char* name, const char* description, getSolutionsFuncPtr solver);
+
+/**
+    \brief returns number of registered implementations (built-in ones are always registered)
+*/
+size_t getNumOfSolvers();
+
+/**
+    \brief returns implementation by it's index, NULL if index is too big
+*/
+const SolverImplementation* getSolverImplementation(size_t index);
+
+/**
+    \brief returns implementation by it's name, NULL if there is no such implementation
+*/
+const SolverImplementation* findSolver(const char* name);
+
+/**
+    \brief checks and measures every registered implementation on tests
+    \param[out] results getNumOfSolvers() results, in order of registry
+    \param[out] fastest fastest implementation, that passed tests, NULL if nothing passed
+*/
+QuadEqErrors calibrateSolvers(const struct Test* tests, size_t numOfTests, struct SolverCalibration* results,
+                              const struct SolverImplementation** fastest);
+
+/**
+    \brief prints one line for every implementation: speed and verdict, chosen one is marked
+*/
+void printSolverCalibration(const struct SolverCalibration* results, size_t numOfResults,
+                            const struct SolverImplementation* chosen, FILE* stream);
+
+/**
+    \brief prints names and descriptions of all implementations
+*/
+void printSolverNames(FILE* stream);
+
+#endif
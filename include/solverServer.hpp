@@ -0,0 +1,105 @@
+#ifndef SOLVER_SERVER_HEADER
+#define SOLVER_SERVER_HEADER
+
+/**
+    \file
+    \brief resident solver, that answers requests over unix domain socket
+
+    Client sends framed requests, every request contains one or many equations with double coefficients:
+    \code
+    SolverRequestHeader   {magic, count}
+    SolverRequestEquation {a, b, c} x count
+    \endcode
+    and gets one response per request, in the same order:
+    \code
+    SolverResponseHeader  {magic, status, count}
+    SolverResponseAnswer  {root_1, root_2, numOfSols} x count
+    \endcode
+    If any coefficient of request is invalid, status is error and response has no answers.
+    Everything is in native byte order, client and server are on the same host.
+
+    Server is single epoll loop, it reads all requests, that arrived during one wakeup, solves all of them as one batch
+    (by vectorized solver, in threads of pool) and writes responses. At most one biggest request worth of bytes is
+    buffered per connection, the rest waits in socket. Requests of connection are not read, while more than two biggest
+    responses worth of bytes are not sent to it, so client should read responses, while it sends requests. Connection,
+    that is closed by client, gets all responses before it's closed by server. Server stops on SIGINT or SIGTERM.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+#include "quadraticEquationSimd.hpp"
+#include "threadPool.hpp"
+
+/// @brief first 4 bytes of every request
+const uint32_t SOLVER_REQUEST_MAGIC  = 0x51455251; // "QREQ"
+/// @brief first 4 bytes of every response
+const uint32_t SOLVER_RESPONSE_MAGIC = 0x53455251; // "QRES"
+/// @brief maximum number of equations in one request, bigger requests close connection
+const uint32_t SOLVER_SERVER_MAX_EQUATIONS = 1 << 20;
+
+/// @brief header of request
+struct SolverRequestHeader {
+    uint32_t magic;  ///< SOLVER_REQUEST_MAGIC
+    uint32_t count;  ///< number of equations after header
+};
+
+/// @brief one equation of request
+struct SolverRequestEquation {
+    double a;
+    double b;
+    double c;
+};
+
+/// @brief header of response
+struct SolverResponseHeader {
+    uint32_t magic;    ///< SOLVER_RESPONSE_MAGIC
+    uint32_t status;   ///< QuadEqErrors
+    uint32_t count;    ///< number of answers after header, 0 if status is not QUAD_EQ_ERRORS_OK
+    uint32_t reserved; ///< zero
+};
+
+/// @brief answer to one equation, roots are 0 if there are no roots (or infinitely many)
+struct SolverResponseAnswer {
+    double   root_1;
+    double   root_2;
+    uint32_t numOfSols; ///< QuadEqRootState
+    uint32_t reserved;  ///< zero
+};
+
+static_assert(sizeof(SolverRequestEquation) == 24, "equation should occupy 24 bytes");
+static_assert(sizeof(SolverResponseAnswer)  == 24, "answer should occupy 24 bytes");
+
+/**
+    \brief creates socket and serves requests until SIGINT or SIGTERM
+
+    Socket file is removed at the end.
+    \param[in] socketPath path of unix domain socket, existing file is replaced
+    \param[in] pool threads, that solve requests (if NULL, everything is done in calling thread)
+*/
+QuadEqErrors runSolverServer(const char* socketPath, struct ThreadPool* pool);
+
+/**
+    \brief connects to server
+    \param[out] fd descriptor of connection
+*/
+QuadEqErrors connectToSolverServer(const char* socketPath, int* fd);
+
+/**
+    \brief sends equations to server and waits for answers
+
+    Big batches are split into several requests, next request is sent before answer to previous one is read.
+    \param[in] fd descriptor of connection
+    \param[in] batch equations
+    \param[out] answer found roots and info about their cnt
+*/
+QuadEqErrors solveOnSolverServer(int fd, const struct QuadraticEquationDoubleBatch* batch,
+                                 struct QuadraticEquationDoubleBatchAnswer* answer);
+
+/**
+    \brief closes connection
+*/
+void disconnectFromSolverServer(int fd);
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef SOLVER_TIMING_HEADER
+#define SOLVER_TIMING_HEADER
+
+/**
+    \file
+    \brief measuring of time, that is shared by autotuning, accuracy harness and benchmarks
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "quadraticEquation.hpp"
+#include "testsGenerator.hpp"
+
+/// @brief returns monotonic time in nanoseconds
+uint64_t getMonotonicTimeNs();
+
+/**
+    \brief solves all tests numOfRuns times
+    \param[in] solver measured solver
+    \param[in] tests equations, they should not be empty
+    \result best time of all runs, in nanoseconds per equation
+*/
+double measureSolverSpeed(getSolutionsFuncPtr solver, const struct Test* tests, size_t numOfTests, int numOfRuns);
+
+#endif
@@ -7,6 +7,8 @@
 */
 
 #include "quadraticEquation.hpp"
+#include "exactSolver.hpp"
+#include "corpusGenerator.hpp"
 
 // enum terminalArgsErros {
 //     TERMINAL_ARGS_NO_ERROR =                   0,
@@ -32,7 +34,27 @@ const char* const HELP_MESSAGE = "This app solves quadratic equation.\n"
                                  "--help   (-h)          prints helping message (current command)\n"
                                  "--user   (-u) a b c    specifies coefficients of equation via user input (a, b, c)\n"
                                  "--output (-o)          specifies output file\n"
-                                 "--test   (-t) source   runs tests, if source specified reads tests from source file\n";
+                                 "--test   (-t) source   runs tests, if source specified reads tests from source file\n"
+                                 "--exact  (-e)          solves equation from --user exactly (coefficients can be like 12, 0.581 or 7/3)\n"
+                                 "--batch  (-b) source   solves records \"a b c\" (one per line) from source file (or stdin), one result line per record\n"
+                                 "--bin-input  (-bi) source   solves equations from binary columnar file\n"
+                                 "--bin-output (-bo) file     writes coefficients and answers of --batch or --bin-input to binary columnar file\n"
+                                 "--threads (-j) N   solves --batch, --bin-input and --test in N threads (0 means number of CPUs)\n"
+                                 "--cache   (-c) N   solves --batch and --test through cache of N proportional equations, prints hit rate\n"
+                                 "--store   (-s) file        solves --batch and --test through persistent store of answers (file is created if needed)\n"
+                                 "--compact-store (-cs) file rebuilds persistent store with bigger capacity\n"
+                                 "--serve   (-sv) socket     answers requests of solverClient over unix domain socket until SIGINT or SIGTERM\n"
+                                 "--channel (-ch) name       solves equations, submitted to shared memory channel (like /quadraticSolver), until SIGINT or SIGTERM\n"
+                                 "--generate   (-g) N        writes N generated tests to --output file (or stdout), it can be given to --test\n"
+                                 "--gen-seed   (-gs) S       seed of --generate, same seed gives same tests\n"
+                                 "--gen-mix    (-gm) mix     weights of kinds of --generate, like two=5,one=2,none=3,linear=2,inf=1,near=2,extreme=1\n"
+                                 "--gen-binary (-gb)         --generate writes compact binary corpus instead of text\n"
+                                 "--accuracy   (-ac) source  compares solver with __float128 reference on tests from source (or on --generate N\n"
+                                 "                           tests, generated in memory), prints error histograms and ns/equation\n"
+                                 "--max-ulp    (-mu) N       --accuracy fails, if some root has error bigger than N ULP\n"
+                                 "--solver     (-so) name    solver of --test and --accuracy: long-double (default), double, branch-free, adaptive,\n"
+                                 "                           reference (__float128) or auto - fastest of them, that passes generated tests\n"
+                                 "                           (it solves misses of --cache and --store too), other modes don't accept it\n";
 
 struct ArgsManager {
     int argc;
@@ -54,6 +76,100 @@ void validateManager(const ArgsManager* manager);
 */
 const char* parseOutputFile(const ArgsManager* manager);
 
+/**
+    \brief parses name of binary columnar input file from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result file name, NULL if it's not stated
+    \memberof ArgsManager
+*/
+const char* parseBinInputFile(const ArgsManager* manager);
+
+/**
+    \brief parses name of binary columnar output file from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result file name, NULL if it's not stated
+    \memberof ArgsManager
+*/
+const char* parseBinOutputFile(const ArgsManager* manager);
+
+/**
+    \brief parses name of persistent solutions store from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result file name, NULL if it's not stated
+    \memberof ArgsManager
+*/
+const char* parseStoreFile(const ArgsManager* manager);
+
+/**
+    \brief parses name of persistent solutions store, that should be compacted, from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result file name, NULL if it's not stated
+    \memberof ArgsManager
+*/
+const char* parseCompactStoreFile(const ArgsManager* manager);
+
+/**
+    \brief parses path of unix domain socket of solver server from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result socket path, NULL if it's not stated
+    \memberof ArgsManager
+*/
+const char* parseServeSocket(const ArgsManager* manager);
+
+/**
+    \brief parses name of shared memory channel of solver from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result channel name, NULL if it's not stated
+    \memberof ArgsManager
+*/
+const char* parseChannelName(const ArgsManager* manager);
+
+/**
+    \brief parses name of solver implementation (see solverRegistry.hpp) from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result name of implementation or "auto", NULL if it's not stated
+    \memberof ArgsManager
+*/
+const char* parseSolverName(const ArgsManager* manager);
+
+/**
+    \brief parses number of threads from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \param[out] numOfThreads number of threads, 1 if flag is not stated, 0 means number of CPUs
+    \result false if number of threads is incorrect
+    \memberof ArgsManager
+*/
+bool parseThreadsArg(const ArgsManager* manager, size_t* numOfThreads);
+
+/**
+    \brief parses capacity of solutions cache from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \param[out] capacity number of cached equations, 0 if flag is not stated (cache is disabled)
+    \result false if capacity is incorrect
+    \memberof ArgsManager
+*/
+bool parseCacheArg(const ArgsManager* manager, size_t* capacity);
+
+/**
+    \brief checks if generate flag occurs in terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result should tests corpus be generated
+    \memberof ArgsManager
+*/
+bool isGenerateNeeded(const ArgsManager* manager);
+
+/**
+    \brief parses number of generated tests, seed, mix of kinds and format of corpus from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \param[out] numOfTests number of tests, 0 if generate flag is not stated
+    \param[out] config seed and weights, defaults if they are not stated
+    \param[out] format binary if --gen-binary is stated, text otherwise
+    \result false if some argument is incorrect
+    \memberof ArgsManager
+*/
+bool parseGenerateArgs(const ArgsManager* manager, size_t* numOfTests, CorpusGeneratorConfig* config,
+                       CorpusFormat* format);
+
 /**
     \brief parses coefficients from terminal arguments
     \param[in] manager Manager that contains argc and argv
@@ -62,6 +178,23 @@ const char* parseOutputFile(const ArgsManager* manager);
 */
 bool parseUserInput(const ArgsManager* manager, QuadraticEquation* eq);
 
+/**
+    \brief parses coefficients from terminal arguments as exact rational numbers
+    \param[in] manager Manager that contains argc and argv
+    \param[out] eq equation with integer coefficients
+    \result was parse successful
+    \memberof ArgsManager
+*/
+bool parseUserInputExact(const ArgsManager* manager, IntegerQuadraticEquation* eq);
+
+/**
+    \brief checks if exact flag occurs in terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \result is exact solver needed
+    \memberof ArgsManager
+*/
+bool isExactModeNeeded(const ArgsManager* manager);
+
 /**
     \brief checks if help flag occurs in terminal arguments
     \param[in] manager Manager that contains argc and argv
@@ -77,4 +210,31 @@ bool isHelpNeeded(const ArgsManager* manager);
 */
 char* parseTestsArgs(const ArgsManager* manager, bool* isTest);
 
+/**
+    \brief parses batch flag and file from which records will be read (if stated) from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \param[out] isBatch does batch flag occur in arguments
+    \result heap allocated name of input file, NULL if records should be read from stdin
+    \memberof ArgsManager
+*/
+char* parseBatchArgs(const ArgsManager* manager, bool* isBatch);
+
+/**
+    \brief parses accuracy flag and file with tests (if stated) from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \param[out] isAccuracy does accuracy flag occur in arguments
+    \result heap allocated name of tests file, NULL if tests should be generated
+    \memberof ArgsManager
+*/
+char* parseAccuracyArgs(const ArgsManager* manager, bool* isAccuracy);
+
+/**
+    \brief parses maximum error in ULP for accuracy harness from terminal arguments
+    \param[in] manager Manager that contains argc and argv
+    \param[out] maxUlp maximum error, not changed if flag is not stated
+    \result false if number is incorrect
+    \memberof ArgsManager
+*/
+bool parseMaxUlpArg(const ArgsManager* manager, double* maxUlp);
+
 #endif
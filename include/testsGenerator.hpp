@@ -9,6 +9,7 @@
 */
 
 #include "quadraticEquation.hpp"
+#include "threadPool.hpp"
 
 
 // enum testsGeneratorErrors {
@@ -54,18 +55,9 @@ enum CheckOnTestsState {
 struct CheckOnTestsOutput {
     int testIndex; ///< test on which solution failed
     CheckOnTestsState state; ///< testing state
+    QuadEqErrors error; ///< error, that solution returned on test testIndex (QUAD_EQ_ERRORS_OK if answer is wrong)
 };
 
-/**
-    handy pointer to a solver function
-    \code
-    typedef void (*getSolutionsFuncPtr)(const struct QuadraticEquation*, struct QuadraticEquationAnswer*);
-    \endcode
-*/
-typedef QuadEqErrors (*getSolutionsFuncPtr)(const struct QuadraticEquation*, struct QuadraticEquationAnswer*);
-
-
-
 /**
     \brief Tester class, core of a lib
 
@@ -82,6 +74,8 @@ struct Tester {
     const struct Test* tests;
     /// pointer to a solver function
     getSolutionsFuncPtr GetSolutionsFunc; ///< \warning should not be NULL
+    struct ThreadPool* pool; ///< threads, that run solver on tests, NULL means calling thread only
+    bool isQuiet; ///< failed test and success message are not printed (only returned)
 };
 
 /**
@@ -0,0 +1,75 @@
+#ifndef TESTS_LOADER_HEADER
+#define TESTS_LOADER_HEADER
+
+/**
+    \file
+    \brief single pass loader of tests file into growable arena
+
+    Format of file: every test is several lines, one number per line, and line, that starts with '#', after them
+    \code
+    a
+    b
+    c
+    root_1      (only if equation has one or two roots)
+    root_2      (only if equation has two roots)
+    inf         (instead of roots, if equation has infinitely many roots)
+    #
+    \endcode
+    File is mapped and parsed directly into arena, there is no separate pass for counting of tests.
+    Big file is split into parts on '#' lines and parts are parsed in parallel, each into it's own arena.
+    Binary corpus, written by writeCorpus() (corpusGenerator.hpp), is loaded by loadTestsFile() too.
+*/
+
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+#include "testsGenerator.hpp"
+#include "threadPool.hpp"
+
+/// @brief files smaller than this are parsed by one thread, bigger are split into parts of at least this size
+const size_t TESTS_LOADER_MIN_PART_SIZE = (size_t)1 << 20;
+/// @brief maximum length of line in tests file (including '\\n')
+const size_t TESTS_LOADER_MAX_LINE_LEN  = 255;
+
+/// @brief growable array of tests, capacity is doubled, when it's full
+struct TestsArena {
+    struct Test* tests;
+    size_t       count;
+    size_t       capacity;
+};
+
+/**
+    \brief adds test to the end of arena
+    \memberof TestsArena
+*/
+QuadEqErrors pushTestToArena(struct TestsArena* arena, const struct Test* test);
+
+/**
+    \brief makes capacity of arena at least given
+    \memberof TestsArena
+*/
+QuadEqErrors reserveTestsArena(struct TestsArena* arena, size_t capacity);
+
+/**
+    \brief frees memory of arena
+    \memberof TestsArena
+*/
+void freeTestsArena(struct TestsArena* arena);
+
+/**
+    \brief parses tests from memory in one pass
+    \param[in] begin, end text in format, described in this file
+    \param[out] arena tests are added to the end of it
+    \result QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT or QUAD_EQ_ERRORS_INVALID_EQUATION if text has wrong format
+*/
+QuadEqErrors parseTestsText(const char* begin, const char* end, struct TestsArena* arena);
+
+/**
+    \brief loads all tests from file
+    \param[in] fileName tests file (text or binary corpus)
+    \param[in] pool threads, that parse parts of big file, NULL means calling thread only
+    \param[out] arena loaded tests, it should be freed by freeTestsArena()
+*/
+QuadEqErrors loadTestsFile(const char* fileName, struct ThreadPool* pool, struct TestsArena* arena);
+
+#endif
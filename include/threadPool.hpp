@@ -0,0 +1,94 @@
+#ifndef THREAD_POOL_HEADER
+#define THREAD_POOL_HEADER
+
+/**
+    \file
+    \brief pool of threads, that solves big arrays of equations in parallel
+
+    Pool can run only one job at a time, so it should be used from one thread.
+    Array is split into chunks of PARALLEL_CHUNK_SIZE elements (equations and answers of one chunk fit into L1 cache).
+    At the beginning every thread owns equal range of chunks, it takes chunks from the front of it's range.
+    Thread, that has finished it's range, steals back half of range of another thread,
+    so threads are busy until the very end even if chunks take different time.
+    Every element is written only to it's own index, so results don't depend on number of threads and scheduling.
+*/
+
+#include <stddef.h>
+
+#include "quadraticEquation.hpp"
+#include "quadraticEquationSimd.hpp"
+
+/// @brief number of elements in one chunk: 256 * (64 + 48) bytes = 28 KB
+const size_t PARALLEL_CHUNK_SIZE = 256;
+
+/// @brief pool of threads, created by createThreadPool()
+struct ThreadPool;
+
+/**
+    \brief function, that processes elements [begin, end) of array
+    \param[in] context pointer, that was given to runParallelFor()
+*/
+typedef void (*ParallelTaskFunc)(void* context, size_t begin, size_t end);
+
+/**
+    \brief creates pool of threads
+    \param[in] numOfThreads number of threads (including calling thread), 0 means number of CPUs
+    \param[out] pool created pool
+*/
+QuadEqErrors createThreadPool(size_t numOfThreads, struct ThreadPool** pool);
+
+/**
+    \brief stops all threads and frees pool
+    \memberof ThreadPool
+*/
+QuadEqErrors destroyThreadPool(struct ThreadPool* pool);
+
+/**
+    \brief returns number of threads in pool (including calling thread)
+    \memberof ThreadPool
+*/
+size_t getThreadPoolSize(const struct ThreadPool* pool);
+
+/**
+    \brief calls task for all chunks of range [0, count) in parallel, returns when all chunks are processed
+
+    Calling thread works too, so pool of 1 thread processes everything in calling thread.
+    \param[in] pool pool of threads, if NULL everything is done in calling thread
+    \param[in] chunkSize maximum number of elements, that are given to task at once
+    \memberof ThreadPool
+*/
+QuadEqErrors runParallelFor(struct ThreadPool* pool, size_t count, size_t chunkSize,
+                            ParallelTaskFunc task, void* context);
+
+/**
+    \brief solves every equation by given solver, in parallel
+
+    Result for every element is exactly the same as result of solver(&equations[i], &answers[i]).
+    \param[in] solver solver function, for example getSolutions
+    \param[out] errors error of every element, can be NULL
+    \result QUAD_EQ_ERRORS_OK if all equations are solved, otherwise error of the first failed equation
+    \memberof ThreadPool
+*/
+QuadEqErrors getSolutionsParallel(struct ThreadPool* pool, getSolutionsFuncPtr solver,
+                                  const struct QuadraticEquation* equations, struct QuadraticEquationAnswer* answers,
+                                  QuadEqErrors* errors, size_t count);
+
+/**
+    \brief same as getSolutionsBatch(), but chunks of batch are solved in parallel
+
+    All coefficients are validated before solving, so if any of them is invalid nothing is solved.
+    \memberof ThreadPool
+*/
+QuadEqErrors getSolutionsBatchParallel(struct ThreadPool* pool, const struct QuadraticEquationBatch* batch,
+                                       struct QuadraticEquationBatchAnswer* answer);
+
+/**
+    \brief same as getSolutionsBatchSimd(), but chunks of batch are solved in parallel
+
+    All coefficients are validated before solving, so if any of them is invalid nothing is solved.
+    \memberof ThreadPool
+*/
+QuadEqErrors getSolutionsBatchSimdParallel(struct ThreadPool* pool, const struct QuadraticEquationDoubleBatch* batch,
+                                           struct QuadraticEquationDoubleBatchAnswer* answer);
+
+#endif
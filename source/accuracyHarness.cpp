@@ -0,0 +1,268 @@
+/**
+    \file
+    \brief realization of differential accuracy and speed harness
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <float.h>
+
+#include "../include/accuracyHarness.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/solverTiming.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief number of bits of mantissa of long double, ULP of x is 2^(exponent of x - LONG_DOUBLE_MANTISSA_BITS + 1)
+const int LONG_DOUBLE_MANTISSA_BITS = LDBL_MANT_DIG;
+/// @brief upper bound of relative error of bucket 1 is 10^ACCURACY_MIN_REL_LOG
+const int ACCURACY_MIN_REL_LOG      = -19;
+
+/// @brief names of classes of equations, index is QuadEqRootState
+static const char* const ACCURACY_CLASS_NAMES[INFINITE_ROOTS + 1] = {"no roots", "one root", "two roots", "infinite roots"};
+
+#ifdef QUAD_SOLVER_HAS_FLOAT128
+    typedef __float128 ReferenceScalar;
+#else
+    typedef long double ReferenceScalar;
+#endif
+
+/// @brief answer of reference
+struct ReferenceAnswer {
+    ReferenceScalar root_1;
+    ReferenceScalar root_2;
+    QuadEqRootState numOfSols;
+};
+
+AccuracyGate getDefaultAccuracyGate() {
+    AccuracyGate gate = {};
+    gate.maxAbsError = EPSILON;
+    gate.maxUlp      = ACCURACY_NO_ULP_LIMIT;
+    return gate;
+}
+
+AccuracyReference getDefaultAccuracyReference() {
+#ifdef QUAD_SOLVER_HAS_FLOAT128
+    return ACCURACY_REFERENCE_FLOAT128;
+#else
+    return ACCURACY_REFERENCE_EXPECTED;
+#endif
+}
+
+// --------------------------   REFERENCE   ---------------------------------
+
+static void getExpectedReference(const Test* test, ReferenceAnswer* answer) {
+    answer->root_1    = test->answer.root_1;
+    answer->root_2    = test->answer.root_2;
+    answer->numOfSols = test->answer.numOfSols;
+    if (answer->numOfSols != ONE_ROOT && answer->numOfSols != TWO_ROOTS)
+        answer->root_1 = answer->root_2 = 0;
+}
+
+/**
+    \brief computes roots of equation in ReferenceScalar, number of roots is taken from expected answer of test
+
+    Classification is not computed: solver core compares discriminant with EPSILON, so reference, that is
+    classified in the same way, would accept the same misclassifications. Answers of generated corpora are
+    built from exact roots, so their number of roots is exact. Two roots are computed without cancellation
+    (bigger by absolute value root from -b -+ sqrt(disc), smaller one from root_1 * root_2 = c / a),
+    otherwise reference would lose precision on the same equations as tested solver.
+*/
+static void solveReference(const Test* test, ReferenceAnswer* answer) {
+    typedef SolverPrecisionTraits<ReferenceScalar> Traits;
+    ReferenceScalar a = test->equation.a;
+    ReferenceScalar b = test->equation.b;
+    ReferenceScalar c = test->equation.c;
+
+    getExpectedReference(test, answer);
+    // a is compared with EPSILON as in solver core: it decides, whether equation is linear, not number of roots
+    bool isLinear = signT<ReferenceScalar>(a) == 0;
+    if (answer->numOfSols == ONE_ROOT) {
+        answer->root_1 = answer->root_2 = isLinear ? -c / b : -b / (2 * a);
+        return;
+    }
+    // expected answer of broken test is left as is, solver is misclassified on it anyway
+    if (answer->numOfSols != TWO_ROOTS || isLinear)
+        return;
+
+    ReferenceScalar disc     = computeDiscriminantT<ReferenceScalar>(a, b, c);
+    ReferenceScalar discRoot = Traits::getSqrt(disc > 0 ? disc : 0);
+    ReferenceScalar q        = b >= 0 ? -(b + discRoot) / 2 : (discRoot - b) / 2;
+    if (q == 0)
+        return;
+    ReferenceScalar bigRoot   = q / a;
+    ReferenceScalar smallRoot = c / q;
+    // order is the same as order of roots of core: root_1 = (-b - sqrt(disc)) / (2 * a) = q / a, if b >= 0
+    bool isBigFirst = b >= 0;
+    answer->root_1 = isBigFirst ? bigRoot   : smallRoot;
+    answer->root_2 = isBigFirst ? smallRoot : bigRoot;
+}
+
+// --------------------------   ERRORS   ---------------------------------
+
+static int getUlpBucket(double ulp) {
+    if (ulp == 0)
+        return 0;
+    if (ulp <= 1)
+        return 1;
+    int exponent = 0;
+    // ulp = fraction * 2^exponent, fraction is from [0.5, 1), so ulp is from (2^(exponent - 1), 2^exponent]
+    // (exact powers of 2 are moved to previous bucket)
+    double fraction = frexp(ulp, &exponent);
+    int bucket = exponent + 1 - (fraction == 0.5);
+    return bucket < ACCURACY_NUM_OF_ULP_BUCKETS ? bucket : ACCURACY_NUM_OF_ULP_BUCKETS - 1;
+}
+
+static int getRelBucket(double relError) {
+    if (relError == 0)
+        return 0;
+    int bucket = 1;
+    double bound = pow(10, ACCURACY_MIN_REL_LOG);
+    while (relError > bound && bucket < ACCURACY_NUM_OF_REL_BUCKETS - 1) {
+        ++bucket;
+        bound *= 10;
+    }
+    return bucket;
+}
+
+/// @brief adds error of one root to class report, returns false if root doesn't pass gate
+static bool addRootError(AccuracyClassReport* report, const AccuracyGate* gate, long double root,
+                         ReferenceScalar reference) {
+    ReferenceScalar diff      = (ReferenceScalar)root - reference;
+    long double     absError  = (long double)(diff < 0 ? -diff : diff);
+    long double     refAbs    = fabsl((long double)reference);
+    // ULP of 1 is used for roots, that are 0, so they are measured by absolute error
+    int             exponent  = refAbs != 0 ? ilogbl(refAbs) : 0;
+    double          ulp       = (double)ldexpl(absError, LONG_DOUBLE_MANTISSA_BITS - 1 - exponent);
+    double          relError  = (double)(refAbs != 0 ? absError / refAbs : absError);
+
+    ++report->numOfRoots;
+    ++report->ulpHistogram[getUlpBucket(ulp)];
+    ++report->relHistogram[getRelBucket(relError)];
+    report->maxUlp      = ulp      > report->maxUlp      ? ulp      : report->maxUlp;
+    report->maxRelError = relError > report->maxRelError ? relError : report->maxRelError;
+    report->maxAbsError = absError > report->maxAbsError ? absError : report->maxAbsError;
+
+    bool isPassed = absError <= gate->maxAbsError && (gate->maxUlp == ACCURACY_NO_ULP_LIMIT || ulp <= gate->maxUlp);
+    report->numOfFailedRoots += !isPassed;
+    return isPassed;
+}
+
+QuadEqErrors runAccuracyHarness(getSolutionsFuncPtr solver, const struct Test* tests, size_t numOfTests,
+                                AccuracyReference reference, AccuracyGate gate, struct AccuracyReport* report) {
+    ///\throw solver should not be NULL
+    ///\throw tests should not be NULL
+    ///\throw report should not be NULL
+    assert(solver != NULL);
+    assert(tests != NULL);
+    assert(report != NULL);
+
+    if (solver == NULL || tests == NULL || report == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+#ifndef QUAD_SOLVER_HAS_FLOAT128
+    if (reference == ACCURACY_REFERENCE_FLOAT128)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+#endif
+
+    *report = {};
+    report->reference      = reference;
+    report->gate           = gate;
+    report->numOfEquations = numOfTests;
+    report->isPassed       = true;
+
+    for (size_t i = 0; i < numOfTests; ++i) {
+        ReferenceAnswer expected = {};
+        if (reference == ACCURACY_REFERENCE_FLOAT128)
+            solveReference(&tests[i], &expected);
+        else
+            getExpectedReference(&tests[i], &expected);
+
+        AccuracyClassReport* classReport = &report->classes[expected.numOfSols];
+        ++classReport->numOfEquations;
+
+        QuadraticEquationAnswer answer = {};
+        if (solver(&tests[i].equation, &answer) != QUAD_EQ_ERRORS_OK) {
+            ++report->numOfSolverErrors;
+            report->isPassed = false;
+            continue;
+        }
+        if (answer.numOfSols != expected.numOfSols) {
+            ++classReport->numOfMisclassified;
+            report->isPassed = false;
+            continue;
+        }
+
+        if (expected.numOfSols == ONE_ROOT || expected.numOfSols == TWO_ROOTS)
+            report->isPassed &= addRootError(classReport, &gate, answer.root_1, expected.root_1);
+        if (expected.numOfSols == TWO_ROOTS)
+            report->isPassed &= addRootError(classReport, &gate, answer.root_2, expected.root_2);
+    }
+
+    report->nsPerEquation = numOfTests > 0 ? measureSolverSpeed(solver, tests, numOfTests, ACCURACY_NUM_OF_RUNS) : 0;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+// --------------------------   OUTPUT   ---------------------------------
+
+static void printUlpBucket(int bucket, size_t count, size_t numOfRoots, FILE* stream) {
+    if (bucket == 0)
+        fprintf(stream, "        ulp  exact        ");
+    else if (bucket == ACCURACY_NUM_OF_ULP_BUCKETS - 1)
+        fprintf(stream, "        ulp  >  2^%-2d      ", bucket - 2);
+    else
+        fprintf(stream, "        ulp  <= 2^%-2d      ", bucket - 1);
+    fprintf(stream, "%12zu  %6.2f%%\n", count, 100.0 * (double)count / (double)numOfRoots);
+}
+
+static void printRelBucket(int bucket, size_t count, size_t numOfRoots, FILE* stream) {
+    if (bucket == 0)
+        fprintf(stream, "        rel  exact        ");
+    else if (bucket == ACCURACY_NUM_OF_REL_BUCKETS - 1)
+        fprintf(stream, "        rel  >  1e%-+4d    ", ACCURACY_MIN_REL_LOG + bucket - 2);
+    else
+        fprintf(stream, "        rel  <= 1e%-+4d    ", ACCURACY_MIN_REL_LOG + bucket - 1);
+    fprintf(stream, "%12zu  %6.2f%%\n", count, 100.0 * (double)count / (double)numOfRoots);
+}
+
+void printAccuracyReport(const struct AccuracyReport* report, FILE* stream) {
+    ///\throw report should not be NULL
+    ///\throw stream should not be NULL
+    assert(report != NULL);
+    assert(stream != NULL);
+
+    fprintf(stream, "%zu equations, reference: %s, %.2f ns/equation (%.2f M equations/s)\n",
+            report->numOfEquations, report->reference == ACCURACY_REFERENCE_FLOAT128 ? "__float128" : "expected answers",
+            report->nsPerEquation, report->nsPerEquation > 0 ? 1e3 / report->nsPerEquation : 0.0);
+    if (report->numOfSolverErrors > 0)
+        fprintf(stream, "solver returned error on %zu equations\n", report->numOfSolverErrors);
+
+    for (int state = 0; state <= INFINITE_ROOTS; ++state) {
+        const AccuracyClassReport* classReport = &report->classes[state];
+        if (classReport->numOfEquations == 0)
+            continue;
+
+        fprintf(stream, "%-15s %10zu equations, %zu misclassified", ACCURACY_CLASS_NAMES[state],
+                classReport->numOfEquations, classReport->numOfMisclassified);
+        if (classReport->numOfRoots == 0) {
+            fprintf(stream, "\n");
+            continue;
+        }
+        // all digits are printed, so maximum doesn't look smaller than bound of it's bucket or of gate
+        fprintf(stream, ", %zu failed roots, max error: %.*g ULP, %.*g relative, %.*Lg absolute\n",
+                classReport->numOfFailedRoots, DBL_DECIMAL_DIG, classReport->maxUlp, DBL_DECIMAL_DIG,
+                classReport->maxRelError, LDBL_DECIMAL_DIG, classReport->maxAbsError);
+
+        for (int bucket = 0; bucket < ACCURACY_NUM_OF_ULP_BUCKETS; ++bucket)
+            if (classReport->ulpHistogram[bucket] > 0)
+                printUlpBucket(bucket, classReport->ulpHistogram[bucket], classReport->numOfRoots, stream);
+        for (int bucket = 0; bucket < ACCURACY_NUM_OF_REL_BUCKETS; ++bucket)
+            if (classReport->relHistogram[bucket] > 0)
+                printRelBucket(bucket, classReport->relHistogram[bucket], classReport->numOfRoots, stream);
+    }
+
+    fprintf(stream, "gate (absolute error <= %.3Lg", report->gate.maxAbsError);
+    if (report->gate.maxUlp != ACCURACY_NO_ULP_LIMIT)
+        fprintf(stream, ", error <= %.3g ULP", report->gate.maxUlp);
+    fprintf(stream, ", same classification): %s\n", report->isPassed ? "passed" : "FAILED");
+}
@@ -0,0 +1,196 @@
+/**
+    \file
+    \brief realization of solver, that works in double and uses long double only when it's needed
+
+    Discriminant b ^ 2 - 4 * a * c is computed like this:
+    \code
+    b2 = b * b;      e1 = fma(b, b, -b2);       // b * b == b2 + e1 exactly
+    p2 = 4 * a * c;  e2 = fma(4 * a, c, -p2);  // 4 * a * c == p2 + e2 exactly
+    disc = (b2 - p2) + (e1 - e2);
+    \endcode
+    Only 3 last operations round, so error of disc is tiny and can be bounded.
+*/
+
+#include <stdio.h>
+#include <assert.h>
+#include <math.h>
+#include <float.h>
+#include <atomic>
+
+#include "../include/adaptiveSolver.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief returns smallest double, that is strictly bigger than x
+static double getDoubleAbove(long double x) {
+    double result = (double)x;
+    if ((long double)result <= x)
+        result = nextafter(result, INFINITY);
+    return result;
+}
+
+/**
+    for double x: x > EPSILON (long double) <=> x >= EPSILON_ABOVE, so signAdaptive() compares with the same
+    threshold as sign(). It doesn't make classification of equations equal: discriminant is computed differently.
+*/
+static const double EPSILON_ABOVE = getDoubleAbove(EPSILON);
+
+// only number of calls and escalations are counted, number of fast solved equations is computed from them
+static std::atomic<unsigned long long> numOfCalls        (0);
+static std::atomic<unsigned long long> numOfEscalations  (0);
+static std::atomic<unsigned long long> numOfInexactInputs(0);
+
+/// @brief sign() of double number (same EPSILON threshold), without conversion to long double
+static int signAdaptive(double x) {
+    if (x <= -EPSILON_ABOVE) return -1;
+    return x >= EPSILON_ABOVE;
+}
+
+/// @brief checks that long double coefficient has exactly the same value in double
+static bool isExactInDouble(long double coef, double* result) {
+    *result = (double)coef;
+    return (long double)*result == coef;
+}
+
+/**
+    \brief solves quadratic case (a != 0) in double
+    \result false if classification of equation is ambiguous and long double should be used
+*/
+__attribute__((always_inline))
+static inline bool solveQuadraticInDouble(double a, double b, double c, struct QuadraticEquationAnswer* answer) {
+    double b2 = b * b;
+    double e1 = fma(b, b, -b2);
+    double a4 = 4 * a; // exact, multiplication by power of 2
+    double p2 = a4 * c;
+    double e2 = fma(a4, c, -p2);
+
+    double high = b2 - p2;
+    double low  = e1 - e2;
+    double disc = high + low;
+
+    // each of 3 rounded operations adds at most half of ulp of it's result
+    double errorBound = DBL_EPSILON * (fabs(high) + fabs(low) + fabs(disc));
+    // EPSILON is rounded to double, so it's error is added too
+    double distToThreshold = fabs(fabs(disc) - EPSILON_ABOVE);
+    if (distToThreshold <= errorBound + EPSILON_ABOVE * DBL_EPSILON)
+        return false;
+
+    int discSign = signAdaptive(disc);
+    if (discSign < 0) {
+        answer->numOfSols = NO_ROOTS;
+        return true;
+    }
+
+    if (discSign == 0) {
+        answer->root_1 = answer->root_2 = -b / (2 * a);
+        answer->numOfSols = ONE_ROOT;
+        return true;
+    }
+
+    // numerically stable formulas: there is no subtraction of close numbers
+    double discRoot = sqrt(disc);
+    double q = b >= 0 ? -(b + discRoot) / 2 : (discRoot - b) / 2;
+    double first  = q / a;
+    double second = c / q;
+    // root_1 should be (-b - discRoot) / (2 * a), same as in getSolutions()
+    if (b >= 0) {
+        answer->root_1 = first;
+        answer->root_2 = second;
+    } else {
+        answer->root_1 = second;
+        answer->root_2 = first;
+    }
+    answer->numOfSols = TWO_ROOTS;
+    return true;
+}
+
+/// @brief same function, but fma() is compiled to one instruction instead of call to libm
+__attribute__((target("fma")))
+static bool solveQuadraticInDoubleFma(double a, double b, double c, struct QuadraticEquationAnswer* answer) {
+    return solveQuadraticInDouble(a, b, c, answer);
+}
+
+static bool solveQuadraticInDoubleNoFma(double a, double b, double c, struct QuadraticEquationAnswer* answer) {
+    return solveQuadraticInDouble(a, b, c, answer);
+}
+
+static bool hasHardwareFma() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("fma");
+}
+
+static const bool HAS_HARDWARE_FMA = hasHardwareFma();
+
+QuadEqErrors getSolutionsAdaptive(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer) {
+    ///\throw eq should not be NULL
+    ///\throw answer should not be NULL
+    assert(eq != NULL);
+    assert(answer != NULL);
+
+    if (eq == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    double a = 0, b = 0, c = 0;
+    if (!isExactInDouble(eq->a, &a) || !isExactInDouble(eq->b, &b) || !isExactInDouble(eq->c, &c)) {
+        if (!isCoefValidT<long double>(eq->a) || !isCoefValidT<long double>(eq->b) || !isCoefValidT<long double>(eq->c))
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+        numOfCalls        .fetch_add(1, std::memory_order_relaxed);
+        numOfInexactInputs.fetch_add(1, std::memory_order_relaxed);
+        return getSolutions(eq, answer);
+    }
+
+    // coefficients are exact, so checking them in double gives the same result
+    if (!isCoefValidT<double>(a) || !isCoefValidT<double>(b) || !isCoefValidT<double>(c))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    numOfCalls.fetch_add(1, std::memory_order_relaxed);
+
+    // linear case, coefficients are exact, so there is no need for escalation
+    if (signAdaptive(a) == 0) {
+        if (signAdaptive(b) == 0) {
+            answer->numOfSols = signAdaptive(c) ? NO_ROOTS : INFINITE_ROOTS;
+            return QUAD_EQ_ERRORS_OK;
+        }
+
+        answer->root_1 = answer->root_2 = -c / b;
+        answer->numOfSols = ONE_ROOT;
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    bool isSolved = HAS_HARDWARE_FMA ? solveQuadraticInDoubleFma  (a, b, c, answer) :
+                                       solveQuadraticInDoubleNoFma(a, b, c, answer);
+    if (isSolved)
+        return QUAD_EQ_ERRORS_OK;
+
+    numOfEscalations.fetch_add(1, std::memory_order_relaxed);
+    return getSolutions(eq, answer);
+}
+
+AdaptiveSolverStats getAdaptiveSolverStats() {
+    AdaptiveSolverStats stats = {};
+    stats.numOfCalls         = numOfCalls        .load(std::memory_order_relaxed);
+    stats.numOfEscalations   = numOfEscalations  .load(std::memory_order_relaxed);
+    stats.numOfInexactInputs = numOfInexactInputs.load(std::memory_order_relaxed);
+    stats.numOfFastSolved    = stats.numOfCalls - stats.numOfEscalations - stats.numOfInexactInputs;
+    return stats;
+}
+
+void resetAdaptiveSolverStats() {
+    numOfCalls        .store(0, std::memory_order_relaxed);
+    numOfEscalations  .store(0, std::memory_order_relaxed);
+    numOfInexactInputs.store(0, std::memory_order_relaxed);
+}
+
+void printAdaptiveSolverStats(FILE* stream) {
+    ///\throw stream should not be NULL
+    assert(stream != NULL);
+
+    AdaptiveSolverStats stats = getAdaptiveSolverStats();
+    double escalationShare = stats.numOfCalls == 0 ? 0 :
+        100.0 * (double)(stats.numOfEscalations + stats.numOfInexactInputs) / (double)stats.numOfCalls;
+    fprintf(stream, "Adaptive solver: %llu equations, %llu solved in double, "
+                    "%llu escalated (ambiguous discriminant), %llu escalated (inexact input), %.3f%% escalated\n",
+            stats.numOfCalls, stats.numOfFastSolved,
+            stats.numOfEscalations, stats.numOfInexactInputs, escalationShare);
+}
@@ -0,0 +1,299 @@
+/**
+    \file
+    \brief realization of asynchronous backend for logging
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+
+#include <new>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "../include/asyncLogger.hpp"
+
+const size_t CACHE_LINE_SIZE        = 64;
+const size_t ASYNC_LOG_LINE_SIZE    = 1024; ///< maximum length of formatted record
+const size_t ASYNC_LOG_SPEC_SIZE    = 32;   ///< maximum length of one conversion specification
+
+static_assert((ASYNC_LOG_RING_CAPACITY & (ASYNC_LOG_RING_CAPACITY - 1)) == 0, "capacity should be power of 2");
+
+/// @brief ring of one thread, head is written only by owner, tail only by background thread
+struct AsyncLogRing {
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head;  ///< number of committed records
+    uint64_t                                       cachedTail;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail;  ///< number of written records
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> dropped;
+    AsyncLogRecord                                 records[ASYNC_LOG_RING_CAPACITY];
+};
+
+static struct {
+    std::atomic<bool>     isRunning;
+    std::atomic<bool>     isStopping;
+    std::thread           writer;
+    std::mutex            registrationMutex;   ///< taken only once by every thread
+    std::atomic<size_t>   numOfRings;
+    AsyncLogRing*         rings[ASYNC_LOG_MAX_THREADS];
+    std::atomic<uint64_t> droppedWithoutRing;  ///< records of threads, that didn't get ring
+} asyncLogger = {};
+
+/// @brief ring of calling thread, rings live until end of program, so records of finished threads are not lost
+static thread_local AsyncLogRing* threadRing = NULL;
+/// @brief record, that is formatted synchronously (logger is not running or thread has no ring)
+static thread_local AsyncLogRecord syncRecord;
+
+static AsyncLogRing* getThreadRing() {
+    if (threadRing != NULL)
+        return threadRing;
+
+    std::lock_guard<std::mutex> lock(asyncLogger.registrationMutex);
+    size_t index = asyncLogger.numOfRings.load(std::memory_order_relaxed);
+    if (index >= ASYNC_LOG_MAX_THREADS)
+        return NULL;
+
+    AsyncLogRing* ring = new (std::nothrow) AsyncLogRing();
+    if (ring == NULL)
+        return NULL;
+    asyncLogger.rings[index] = ring;
+    asyncLogger.numOfRings.store(index + 1, std::memory_order_release);
+    threadRing = ring;
+    return ring;
+}
+
+AsyncLogRecord* beginAsyncLogRecord() {
+    if (!asyncLogger.isRunning.load(std::memory_order_acquire))
+        return &syncRecord;
+
+    AsyncLogRing* ring = getThreadRing();
+    if (ring == NULL) {
+        asyncLogger.droppedWithoutRing.fetch_add(1, std::memory_order_relaxed);
+        return NULL;
+    }
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    // tail is reloaded only when ring looks full, so producer rarely touches cache line of consumer
+    if (head - ring->cachedTail >= ASYNC_LOG_RING_CAPACITY) {
+        ring->cachedTail = ring->tail.load(std::memory_order_acquire);
+        if (head - ring->cachedTail >= ASYNC_LOG_RING_CAPACITY) {
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return NULL;
+        }
+    }
+    return &ring->records[head & (ASYNC_LOG_RING_CAPACITY - 1)];
+}
+
+void captureAsyncLogString(AsyncLogRecord* record, AsyncLogArg* arg, const char* string) {
+    arg->type         = ASYNC_LOG_ARG_STRING;
+    arg->stringOffset = record->stringsSize;
+    if (string == NULL)
+        string = "(null)";
+
+    // string is cut, if it doesn't fit, last byte of strings is always free for '\0'
+    size_t freeSize = ASYNC_LOG_STRING_BYTES - record->stringsSize;
+    size_t len      = strnlen(string, freeSize - 1);
+    memcpy(record->strings + record->stringsSize, string, len);
+    record->strings[record->stringsSize + len] = '\0';
+    record->stringsSize += len + 1;
+    if (record->stringsSize >= ASYNC_LOG_STRING_BYTES)
+        record->stringsSize = ASYNC_LOG_STRING_BYTES - 1;
+}
+
+/**
+    \brief prints one argument by one conversion specification
+    \param[in] spec like "%-10.3" without length modifier and conversion
+*/
+static int formatArg(char* buffer, size_t size, char* spec, size_t specLen, char conversion,
+                     const AsyncLogRecord* record, const AsyncLogArg* arg) {
+    #define FORMAT_WITH(MODIFIER, VALUE)                                \
+        do {                                                            \
+            snprintf(spec + specLen, ASYNC_LOG_SPEC_SIZE - specLen,     \
+                     "%s%c", MODIFIER, conversion);                     \
+            return snprintf(buffer, size, spec, VALUE);                 \
+        } while(0)
+
+    if (arg == NULL)
+        return snprintf(buffer, size, "?");
+
+    switch (conversion) {
+        case 'd': case 'i': case 'c':
+            if (conversion == 'c')
+                FORMAT_WITH("", (int)arg->i);
+            FORMAT_WITH("ll", arg->type == ASYNC_LOG_ARG_UINT ? (long long)arg->u : arg->i);
+        case 'u': case 'o': case 'x': case 'X':
+            FORMAT_WITH("ll", arg->type == ASYNC_LOG_ARG_INT ? (unsigned long long)arg->i : arg->u);
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            if (arg->type == ASYNC_LOG_ARG_LONG_DOUBLE)
+                FORMAT_WITH("L", arg->ld);
+            FORMAT_WITH("", arg->type == ASYNC_LOG_ARG_DOUBLE ? arg->d : (double)arg->ld);
+        case 's':
+            FORMAT_WITH("", arg->type == ASYNC_LOG_ARG_STRING ? record->strings + arg->stringOffset : "?");
+        case 'p':
+            FORMAT_WITH("", arg->p);
+        default:
+            return snprintf(buffer, size, "?");
+    }
+    #undef FORMAT_WITH
+}
+
+/// @brief formats record like vsnprintf() would, arguments are taken from record
+static void formatRecord(const AsyncLogRecord* record, char* line, size_t size) {
+    size_t pos      = 0;
+    size_t argIndex = 0;
+    const char* format = record->format;
+
+    #define NEXT_ARG() (argIndex < record->numOfArgs ? &record->args[argIndex++] : NULL)
+
+    while (*format != '\0' && pos + 1 < size) {
+        if (*format != '%') {
+            line[pos++] = *format++;
+            continue;
+        }
+        if (format[1] == '%') {
+            line[pos++] = '%';
+            format += 2;
+            continue;
+        }
+
+        // flags, width and precision are kept, '*' is replaced by value of argument, length modifiers are dropped
+        char spec[ASYNC_LOG_SPEC_SIZE] = "%";
+        size_t specLen = 1;
+        ++format;
+        while (*format != '\0' && strchr("-+ #0123456789.*", *format) != NULL) {
+            if (*format == '*') {
+                const AsyncLogArg* star = NEXT_ARG();
+                specLen += (size_t)snprintf(spec + specLen, ASYNC_LOG_SPEC_SIZE - specLen, "%d",
+                                            star != NULL ? (int)star->i : 0);
+                if (specLen + 4 > ASYNC_LOG_SPEC_SIZE)
+                    specLen = ASYNC_LOG_SPEC_SIZE - 4;
+            } else if (specLen + 4 < ASYNC_LOG_SPEC_SIZE) {
+                spec[specLen++] = *format;
+            }
+            ++format;
+        }
+        while (*format != '\0' && strchr("hlLqjzt", *format) != NULL)
+            ++format;
+        if (*format == '\0')
+            break;
+        spec[specLen] = '\0';
+
+        char conversion = *format++;
+        int written = formatArg(line + pos, size - pos, spec, specLen, conversion, record, NEXT_ARG());
+        if (written > 0)
+            pos += (size_t)written < size - pos ? (size_t)written : size - pos - 1;
+    }
+    line[pos] = '\0';
+
+    #undef NEXT_ARG
+}
+
+static void writeRecord(const AsyncLogRecord* record) {
+    char line[ASYNC_LOG_LINE_SIZE] = "";
+    formatRecord(record, line, sizeof(line));
+    printMessageToLog(record->level, record->file, record->function, record->line, "%s", line);
+}
+
+void commitAsyncLogRecord(AsyncLogRecord* record) {
+    assert(record != NULL);
+    if (record == &syncRecord) {
+        writeRecord(record);
+        return;
+    }
+
+    threadRing->head.fetch_add(1, std::memory_order_release);
+}
+
+/// @brief writes all records, that are in rings now, returns number of written records
+static size_t drainRings() {
+    size_t numOfWritten = 0;
+    size_t numOfRings = asyncLogger.numOfRings.load(std::memory_order_acquire);
+    for (size_t i = 0; i < numOfRings; ++i) {
+        AsyncLogRing* ring = asyncLogger.rings[i];
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail, ++numOfWritten)
+            writeRecord(&ring->records[tail & (ASYNC_LOG_RING_CAPACITY - 1)]);
+        ring->tail.store(tail, std::memory_order_release);
+    }
+    return numOfWritten;
+}
+
+static void runWriter() {
+    while (!asyncLogger.isStopping.load(std::memory_order_acquire)) {
+        if (drainRings() == 0) {
+            timespec idle = {0, ASYNC_LOG_IDLE_SLEEP_US * 1000};
+            nanosleep(&idle, NULL);
+        }
+    }
+    // records, committed before stop, are written
+    drainRings();
+}
+
+/// @brief writer thread is joined before static destructors, so exit() and any return from main() are safe
+static void stopAsyncLoggerAtExit() {
+    stopAsyncLogger();
+}
+
+bool startAsyncLogger() {
+    if (asyncLogger.isRunning.load())
+        return true;
+
+    // handler is registered once, after LoggerLib is initialized, so it runs before LoggerLib is destroyed
+    static const bool isAtExitRegistered = atexit(stopAsyncLoggerAtExit) == 0;
+    if (!isAtExitRegistered)
+        return false;
+
+    asyncLogger.isStopping.store(false);
+    try {
+        asyncLogger.writer = std::thread(runWriter);
+    } catch (...) {
+        return false;
+    }
+    asyncLogger.isRunning.store(true, std::memory_order_release);
+    return true;
+}
+
+void flushAsyncLogger() {
+    if (!asyncLogger.isRunning.load(std::memory_order_acquire))
+        return;
+
+    size_t numOfRings = asyncLogger.numOfRings.load(std::memory_order_acquire);
+    for (size_t i = 0; i < numOfRings; ++i) {
+        AsyncLogRing* ring = asyncLogger.rings[i];
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        while (ring->tail.load(std::memory_order_acquire) < head) {
+            timespec idle = {0, ASYNC_LOG_IDLE_SLEEP_US * 1000 / 4};
+            nanosleep(&idle, NULL);
+        }
+    }
+}
+
+uint64_t getAsyncLoggerDropped() {
+    uint64_t dropped = asyncLogger.droppedWithoutRing.load(std::memory_order_relaxed);
+    size_t numOfRings = asyncLogger.numOfRings.load(std::memory_order_acquire);
+    for (size_t i = 0; i < numOfRings; ++i)
+        dropped += asyncLogger.rings[i]->dropped.load(std::memory_order_relaxed);
+    return dropped;
+}
+
+void stopAsyncLogger() {
+    if (!asyncLogger.isRunning.load())
+        return;
+
+    asyncLogger.isRunning.store(false, std::memory_order_release);
+    asyncLogger.isStopping.store(true, std::memory_order_release);
+    asyncLogger.writer.join();
+
+    uint64_t dropped = getAsyncLoggerDropped();
+    if (dropped > 0)
+        printMessageToLog(WARNING, __FILE__, __FUNCTION__, __LINE__,
+                          "%lu records of log were dropped, because rings were full\n", (unsigned long)dropped);
+}
+
+void destructAsyncLogger() {
+    stopAsyncLogger();
+    destructLogger();
+}
@@ -0,0 +1,407 @@
+/**
+    \file
+    \brief realization of streaming solver of many equations
+
+    Records are parsed into chunk of BATCH_CHUNK_SIZE equations (structure of arrays),
+    then whole chunk is solved by getSolutionsBatchParallel() and results are printed in the same order.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "../include/batchMode.hpp"
+#include "../include/mappedInput.hpp"
+#include "../include/columnarFormat.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/solutionsCache.hpp"
+#include "../include/solutionsStore.hpp"
+#include "../include/errorReporting.hpp"
+
+const size_t BATCH_CHUNK_SIZE  = 16384; ///< number of records, that are solved at once (enough for all threads)
+const char*  RECORD_SEPARATORS = " \t\r\n,";
+
+/// @brief name of input in reports of malformed records, if stream is given without name
+const char*  STREAM_INPUT_NAME = "input";
+
+/// @brief equations from one chunk of input and their answers
+struct BatchChunk {
+    size_t count;          ///< number of records in chunk
+    size_t numOfEquations; ///< number of well-formed records, only they are stored in arrays of equations
+
+    long double a[BATCH_CHUNK_SIZE];
+    long double b[BATCH_CHUNK_SIZE];
+    long double c[BATCH_CHUNK_SIZE];
+
+    long double     root_1   [BATCH_CHUNK_SIZE];
+    long double     root_2   [BATCH_CHUNK_SIZE];
+    QuadEqRootState numOfSols[BATCH_CHUNK_SIZE];
+
+    bool isMalformed[BATCH_CHUNK_SIZE]; ///< for every record, malformed records are not solved, "error" is printed instead
+};
+
+/// @brief checks that symbol separates numbers in record
+static bool isSeparator(char symbol) {
+    return symbol != '\0' && strchr(RECORD_SEPARATORS, symbol) != NULL;
+}
+
+/**
+    \brief parses record "a b c" into coefs
+    \param[in] begin first symbol of record
+    \param[in] end symbol after last symbol of record
+    \result reason, if record is malformed (QUAD_EQ_ERRORS_INVALID_EQUATION if it doesn't contain exactly 3 numbers)
+*/
+static QuadEqErrors parseRecord(const char* begin, const char* end, long double coefs[3]) {
+    assert(begin != NULL);
+    assert(end != NULL);
+
+    int numOfCoefs = 0;
+    while (true) {
+        while (begin < end && isSeparator(*begin))
+            ++begin;
+        if (begin == end)
+            break;
+
+        const char* wordEnd = begin;
+        while (wordEnd < end && !isSeparator(*wordEnd))
+            ++wordEnd;
+
+        if (numOfCoefs == 3)
+            return QUAD_EQ_ERRORS_INVALID_EQUATION;
+
+        bool isOk = false;
+        parseNumberFast(begin, wordEnd, &coefs[numOfCoefs], &isOk);
+        if (!isOk)
+            return QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT;
+        // same check as solver does, so NaN becomes error of this record instead of error of whole chunk
+        if (!isCoefValidT<long double>(coefs[numOfCoefs]))
+            return QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG;
+        ++numOfCoefs;
+        begin = wordEnd;
+    }
+
+    return numOfCoefs == 3 ? QUAD_EQ_ERRORS_OK : QUAD_EQ_ERRORS_INVALID_EQUATION;
+}
+
+/// @brief checks that line contains only separators
+static bool isEmptyLine(const char* begin, const char* end) {
+    while (begin < end && isSeparator(*begin))
+        ++begin;
+    return begin == end;
+}
+
+void printBatchResult(struct ResultWriter* output, QuadEqRootState numOfSols, long double root_1, long double root_2,
+                      int outputPrecision) {
+    ///\throw output should not be NULL
+    assert(output != NULL);
+
+    switch (numOfSols) {
+        case NO_ROOTS:
+            writeResultChars(output, "0\n", 2);
+            break;
+        case ONE_ROOT:
+            writeResultChars(output, "1 ", 2);
+            writeResultNumber(output, root_1, outputPrecision);
+            writeResultChars(output, "\n", 1);
+            break;
+        case TWO_ROOTS:
+            writeResultChars(output, "2 ", 2);
+            writeResultNumber(output, root_1, outputPrecision);
+            writeResultChars(output, " ", 1);
+            writeResultNumber(output, root_2, outputPrecision);
+            writeResultChars(output, "\n", 1);
+            break;
+        case INFINITE_ROOTS:
+            writeResultChars(output, "inf\n", 4);
+            break;
+        default:
+            // number of solutions can come from binary file, so it's not an assert
+            writeResultChars(output, "error\n", 6);
+            break;
+    }
+}
+
+/**
+    \brief prints one result line
+    \param[in] record index of record in chunk
+    \param[in,out] equation index of next well-formed equation, it's moved forward if record is well-formed
+*/
+static void printRecordResult(ResultWriter* output, const BatchChunk* chunk, size_t record, size_t* equation,
+                              int outputPrecision) {
+    if (chunk->isMalformed[record]) {
+        writeResultChars(output, "error\n", 6);
+        return;
+    }
+
+    size_t index = (*equation)++;
+    printBatchResult(output, chunk->numOfSols[index], chunk->root_1[index], chunk->root_2[index], outputPrecision);
+}
+
+/// @brief solves equations [begin, end) of chunk through persistent store
+static void solveChunkStored(void* context, size_t begin, size_t end) {
+    BatchChunk* chunk = (BatchChunk*)context;
+    for (size_t i = begin; i < end; ++i) {
+        QuadraticEquation       eq       = {chunk->a[i], chunk->b[i], chunk->c[i], DEFAULT_PRECISION};
+        QuadraticEquationAnswer solution = {};
+        // coefficients are already checked by parseRecord(), so nothing can fail
+        getSolutionsStored(&eq, &solution);
+        chunk->root_1   [i] = solution.root_1;
+        chunk->root_2   [i] = solution.root_2;
+        chunk->numOfSols[i] = solution.numOfSols;
+    }
+}
+
+/// @brief solves equations [begin, end) of chunk through solutions cache
+static void solveChunkCached(void* context, size_t begin, size_t end) {
+    BatchChunk* chunk = (BatchChunk*)context;
+    QuadraticEquationBatch       batch  = {end - begin, chunk->a + begin, chunk->b + begin, chunk->c + begin};
+    QuadraticEquationBatchAnswer answer = {chunk->root_1 + begin, chunk->root_2 + begin, chunk->numOfSols + begin};
+    // coefficients are already checked by parseRecord(), so nothing can fail
+    getSolutionsBatchCached(&batch, &answer);
+}
+
+/// @brief solves all well-formed records of chunk and prints results
+static QuadEqErrors flushChunk(ResultWriter* output, BatchChunk* chunk, int outputPrecision, ThreadPool* pool) {
+    QuadraticEquationBatch       batch  = {chunk->numOfEquations, chunk->a, chunk->b, chunk->c};
+    QuadraticEquationBatchAnswer answer = {chunk->root_1, chunk->root_2, chunk->numOfSols};
+    // store misses are solved through cache (if it's enabled), see main.cpp
+    QuadEqErrors error = QUAD_EQ_ERRORS_OK;
+    if (isSolutionsStoreOpened())
+        error = runParallelFor(pool, chunk->numOfEquations, PARALLEL_CHUNK_SIZE, solveChunkStored, chunk);
+    else if (isSolutionsCacheEnabled())
+        error = runParallelFor(pool, chunk->numOfEquations, PARALLEL_CHUNK_SIZE, solveChunkCached, chunk);
+    else
+        error = getSolutionsBatchParallel(pool, &batch, &answer);
+    if (error != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(error);
+
+    size_t equation = 0;
+    for (size_t i = 0; i < chunk->count; ++i)
+        printRecordResult(output, chunk, i, &equation, outputPrecision);
+    chunk->count          = 0;
+    chunk->numOfEquations = 0;
+    // if output can't be written, there is no point to solve the rest
+    return output->error;
+}
+
+/// @brief adds one line of input to chunk, solves and prints chunk if it's full
+static QuadEqErrors addRecord(ResultWriter* output, BatchChunk* chunk, const char* begin, const char* end,
+                              const char* inputName, size_t lineNumber, int outputPrecision, ThreadPool* pool,
+                              struct BatchModeStats* stats) {
+    if (isEmptyLine(begin, end))
+        return QUAD_EQ_ERRORS_OK;
+
+    size_t record = chunk->count++;
+    long double coefs[3] = {};
+    QuadEqErrors recordError = parseRecord(begin, end, coefs);
+    chunk->isMalformed[record] = recordError != QUAD_EQ_ERRORS_OK;
+    ++stats->numOfRecords;
+    // malformed record gets only "error" in output, it doesn't reach solver, cache or store
+    if (chunk->isMalformed[record]) {
+        REPORT_INPUT_ERROR(recordError, inputName, lineNumber);
+        ++stats->numOfMalformed;
+    } else {
+        size_t index = chunk->numOfEquations++;
+        chunk->a[index] = coefs[0];
+        chunk->b[index] = coefs[1];
+        chunk->c[index] = coefs[2];
+    }
+
+    if (chunk->count == BATCH_CHUNK_SIZE)
+        return flushChunk(output, chunk, outputPrecision, pool);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief same as runBatchMode(), inputName is used in reports of malformed records
+static QuadEqErrors runBatchModeOnStream(FILE* input, const char* inputName, struct ResultWriter* output,
+                                         int outputPrecision, struct ThreadPool* pool, struct BatchModeStats* stats) {
+    BatchChunk* chunk = (BatchChunk*)calloc(1, sizeof(BatchChunk));
+    if (chunk == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+
+    *stats = {};
+    QuadEqErrors error = QUAD_EQ_ERRORS_OK;
+    char*   line       = NULL;
+    size_t  lineCap    = 0;
+    size_t  lineNumber = 0;
+    ssize_t lineLen    = 0;
+    while (error == QUAD_EQ_ERRORS_OK && (lineLen = getline(&line, &lineCap, input)) != -1)
+        error = addRecord(output, chunk, line, line + lineLen, inputName, ++lineNumber, outputPrecision, pool, stats);
+
+    if (error == QUAD_EQ_ERRORS_OK)
+        error = flushChunk(output, chunk, outputPrecision, pool);
+
+    free(line);
+    free(chunk);
+    return error;
+}
+
+QuadEqErrors runBatchMode(FILE* input, struct ResultWriter* output, int outputPrecision, struct ThreadPool* pool,
+                          struct BatchModeStats* stats) {
+    ///\throw input should not be NULL
+    ///\throw output should not be NULL
+    ///\throw stats should not be NULL
+    assert(input  != NULL);
+    assert(output != NULL);
+    assert(stats  != NULL);
+
+    if (input == NULL || output == NULL || stats == NULL || outputPrecision < 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    return runBatchModeOnStream(input, STREAM_INPUT_NAME, output, outputPrecision, pool, stats);
+}
+
+QuadEqErrors runBatchModeOnFile(const char* fileName, struct ResultWriter* output, int outputPrecision, struct ThreadPool* pool,
+                                struct BatchModeStats* stats) {
+    ///\throw fileName should not be NULL
+    ///\throw output should not be NULL
+    ///\throw stats should not be NULL
+    assert(fileName != NULL);
+    assert(output   != NULL);
+    assert(stats    != NULL);
+
+    if (fileName == NULL || output == NULL || stats == NULL || outputPrecision < 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    MappedInput input = {};
+    if (openMappedInput(fileName, &input) != QUAD_EQ_ERRORS_OK) {
+        // not a regular file (for example, named pipe), so it's read as stream
+        FILE* stream = fopen(fileName, "r");
+        if (stream == NULL)
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+        QuadEqErrors error = runBatchModeOnStream(stream, fileName, output, outputPrecision, pool, stats);
+        fclose(stream);
+        return error;
+    }
+
+    BatchChunk* chunk = (BatchChunk*)calloc(1, sizeof(BatchChunk));
+    if (chunk == NULL) {
+        closeMappedInput(&input);
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+    }
+
+    *stats = {};
+    QuadEqErrors error = QUAD_EQ_ERRORS_OK;
+    size_t lineNumber = 0;
+    while (error == QUAD_EQ_ERRORS_OK) {
+        const char* lineBegin = NULL;
+        const char* lineEnd   = NULL;
+        bool isEnd = false;
+        error = readMappedLine(&input, &lineBegin, &lineEnd, &isEnd);
+        if (error != QUAD_EQ_ERRORS_OK || isEnd)
+            break;
+
+        error = addRecord(output, chunk, lineBegin, lineEnd, fileName, ++lineNumber, outputPrecision, pool, stats);
+    }
+
+    if (error == QUAD_EQ_ERRORS_OK)
+        error = flushChunk(output, chunk, outputPrecision, pool);
+
+    closeMappedInput(&input);
+    free(chunk);
+    return error;
+}
+
+/// @brief returns number of lines in file, upper bound of number of records
+static QuadEqErrors countMappedLines(const char* fileName, size_t* numOfLines) {
+    assert(fileName != NULL);
+    assert(numOfLines != NULL);
+
+    MappedInput input = {};
+    QuadEqErrors error = openMappedInput(fileName, &input);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    *numOfLines = 0;
+    while (true) {
+        const char* lineBegin = NULL;
+        const char* lineEnd   = NULL;
+        bool isEnd = false;
+        error = readMappedLine(&input, &lineBegin, &lineEnd, &isEnd);
+        if (error != QUAD_EQ_ERRORS_OK || isEnd)
+            break;
+        ++*numOfLines;
+    }
+
+    closeMappedInput(&input);
+    return error;
+}
+
+QuadEqErrors runBatchModeToColumnar(const char* fileName, const char* columnarFileName, struct ThreadPool* pool,
+                                    struct BatchModeStats* stats) {
+    ///\throw fileName should not be NULL
+    ///\throw columnarFileName should not be NULL
+    ///\throw stats should not be NULL
+    assert(fileName         != NULL);
+    assert(columnarFileName != NULL);
+    assert(stats            != NULL);
+
+    // output is truncated, while input is mapped, so they can't be the same file
+    if (fileName == NULL || columnarFileName == NULL || stats == NULL || isSameFile(fileName, columnarFileName))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // first pass only counts lines, so file is created once and nothing is reallocated
+    size_t numOfLines = 0;
+    if (countMappedLines(fileName, &numOfLines) != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    ColumnarFile output = {};
+    QuadEqErrors error = createColumnarFile(columnarFileName, COLUMNAR_PRECISION_F64, numOfLines,
+                                            COLUMNAR_COEF_COLUMNS | COLUMNAR_ANSWER_COLUMNS, &output);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    MappedInput input = {};
+    error = openMappedInput(fileName, &input);
+    if (error != QUAD_EQ_ERRORS_OK) {
+        closeColumnarFile(&output);
+        LOG_AND_RETURN(error);
+    }
+
+    double* a = (double*)getColumnarColumn(&output, COLUMNAR_COLUMN_A);
+    double* b = (double*)getColumnarColumn(&output, COLUMNAR_COLUMN_B);
+    double* c = (double*)getColumnarColumn(&output, COLUMNAR_COLUMN_C);
+    *stats = {};
+    size_t numOfWritten = 0;
+    size_t lineNumber   = 0;
+    while (true) {
+        const char* lineBegin = NULL;
+        const char* lineEnd   = NULL;
+        bool isEnd = false;
+        error = readMappedLine(&input, &lineBegin, &lineEnd, &isEnd);
+        if (error != QUAD_EQ_ERRORS_OK || isEnd)
+            break;
+
+        ++lineNumber;
+        if (isEmptyLine(lineBegin, lineEnd))
+            continue;
+
+        ++stats->numOfRecords;
+        long double coefs[3] = {};
+        // binary file has no place for "error", so malformed records are skipped
+        QuadEqErrors recordError = parseRecord(lineBegin, lineEnd, coefs);
+        if (recordError != QUAD_EQ_ERRORS_OK) {
+            REPORT_INPUT_ERROR(recordError, fileName, lineNumber);
+            ++stats->numOfMalformed;
+            continue;
+        }
+
+        // parseNumberFast() parses numbers as double, so nothing is lost
+        a[numOfWritten] = (double)coefs[0];
+        b[numOfWritten] = (double)coefs[1];
+        c[numOfWritten] = (double)coefs[2];
+        ++numOfWritten;
+    }
+    closeMappedInput(&input);
+
+    if (error == QUAD_EQ_ERRORS_OK)
+        error = setColumnarCount(&output, numOfWritten);
+    if (error == QUAD_EQ_ERRORS_OK)
+        error = solveColumnarFile(&output, &output, pool);
+
+    closeColumnarFile(&output);
+    return error;
+}
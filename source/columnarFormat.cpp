@@ -0,0 +1,332 @@
+/**
+    \file
+    \brief realization of reader and writer of binary columnar format
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/columnarFormat.hpp"
+#include "../include/quadraticEquationSimd.hpp"
+#include "../include/batchMode.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief returns size of one element of column
+static size_t getColumnElementSize(ColumnarColumn column, size_t elementSize) {
+    return column == COLUMNAR_COLUMN_NUM_OF_SOLS ? sizeof(QuadEqRootState) : elementSize;
+}
+
+/// @brief returns size of coefficient (or root) of given precision, 0 if precision is unknown
+static size_t getPrecisionElementSize(uint32_t precision) {
+    switch (precision) {
+        case COLUMNAR_PRECISION_F64: return sizeof(double);
+        case COLUMNAR_PRECISION_F80: return sizeof(long double);
+        default:                     return 0;
+    }
+}
+
+/// @brief rounds offset up to COLUMNAR_ALIGNMENT
+static size_t alignOffset(size_t offset) {
+    return (offset + COLUMNAR_ALIGNMENT - 1) / COLUMNAR_ALIGNMENT * COLUMNAR_ALIGNMENT;
+}
+
+/// @brief checks that header describes file of given size
+static bool isHeaderValid(const ColumnarHeader* header, size_t fileSize) {
+    assert(header != NULL);
+
+    if (memcmp(header->magic, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC)) != 0 ||
+        header->version != COLUMNAR_VERSION)
+        return false;
+
+    size_t elementSize = getPrecisionElementSize(header->precision);
+    if (elementSize == 0 || header->elementSize != elementSize)
+        return false;
+    if ((header->columns & ~((1u << COLUMNAR_NUM_OF_COLUMNS) - 1)) != 0)
+        return false;
+    // column size should not overflow
+    if (header->count > fileSize / sizeof(QuadEqRootState))
+        return false;
+
+    for (int column = 0; column < COLUMNAR_NUM_OF_COLUMNS; ++column) {
+        if (!(header->columns & (1u << column)))
+            continue;
+
+        size_t offset     = header->columnOffsets[column];
+        size_t columnSize = header->count * getColumnElementSize((ColumnarColumn)column, elementSize);
+        if (offset % COLUMNAR_ALIGNMENT != 0 || offset < sizeof(ColumnarHeader) ||
+            offset > fileSize || columnSize > fileSize - offset)
+            return false;
+    }
+    return true;
+}
+
+/// @brief maps whole file
+static QuadEqErrors mapColumnarFile(struct ColumnarFile* file, size_t fileSize, bool isWritable) {
+    assert(file != NULL);
+
+    int protection = isWritable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* mapping = mmap(NULL, fileSize, protection, MAP_SHARED, file->fd, 0);
+    if (mapping == MAP_FAILED)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+
+    file->mapping     = (unsigned char*)mapping;
+    file->mappingSize = fileSize;
+    file->header      = (const ColumnarHeader*)mapping;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief fills header and computes offsets of columns, returns size of file
+static size_t buildColumnarHeader(ColumnarPrecision precision, size_t count, uint32_t columns, ColumnarHeader* header) {
+    assert(header != NULL);
+
+    size_t elementSize = getPrecisionElementSize(precision);
+    *header = {};
+    memcpy(header->magic, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+    header->version     = COLUMNAR_VERSION;
+    header->precision   = (uint32_t)precision;
+    header->count       = count;
+    header->columns     = columns;
+    header->elementSize = (uint32_t)elementSize;
+
+    size_t fileSize = sizeof(ColumnarHeader);
+    for (int column = 0; column < COLUMNAR_NUM_OF_COLUMNS; ++column) {
+        if (!(columns & (1u << column)))
+            continue;
+        header->columnOffsets[column] = fileSize;
+        fileSize = alignOffset(fileSize + count * getColumnElementSize((ColumnarColumn)column, elementSize));
+    }
+    return fileSize;
+}
+
+/// @brief checks arguments of create functions
+static bool isLayoutValid(ColumnarPrecision precision, uint32_t columns) {
+    return getPrecisionElementSize(precision) != 0 && (columns & ~((1u << COLUMNAR_NUM_OF_COLUMNS) - 1)) == 0;
+}
+
+bool isSameFile(const char* firstName, const char* secondName) {
+    ///\throw firstName should not be NULL
+    ///\throw secondName should not be NULL
+    assert(firstName != NULL);
+    assert(secondName != NULL);
+
+    // names can differ for the same file (links, relative paths), so files are compared by their inodes
+    struct stat firstInfo = {}, secondInfo = {};
+    if (firstName == NULL || secondName == NULL || stat(firstName, &firstInfo) == -1 || stat(secondName, &secondInfo) == -1)
+        return false;
+    return firstInfo.st_dev == secondInfo.st_dev && firstInfo.st_ino == secondInfo.st_ino;
+}
+
+QuadEqErrors createColumnarFile(const char* fileName, ColumnarPrecision precision, size_t count, uint32_t columns,
+                                struct ColumnarFile* file) {
+    ///\throw fileName should not be NULL
+    ///\throw file should not be NULL
+    assert(fileName != NULL);
+    assert(file != NULL);
+
+    if (fileName == NULL || file == NULL || !isLayoutValid(precision, columns))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    ColumnarHeader header = {};
+    size_t fileSize = buildColumnarHeader(precision, count, columns, &header);
+
+    *file = {};
+    file->fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file->fd == -1)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    // new file is filled with zeros, so only header has to be written
+    if (ftruncate(file->fd, (off_t)fileSize) == -1 ||
+        pwrite(file->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+        mapColumnarFile(file, fileSize, true) != QUAD_EQ_ERRORS_OK) {
+        close(file->fd);
+        file->fd = -1;
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    }
+
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors createColumnarBuffer(ColumnarPrecision precision, size_t count, uint32_t columns,
+                                  struct ColumnarFile* file) {
+    ///\throw file should not be NULL
+    assert(file != NULL);
+
+    if (file == NULL || !isLayoutValid(precision, columns))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    ColumnarHeader header = {};
+    size_t size = buildColumnarHeader(precision, count, columns, &header);
+
+    *file = {};
+    file->fd = -1;
+    void* mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+
+    memcpy(mapping, &header, sizeof(header));
+    file->mapping     = (unsigned char*)mapping;
+    file->mappingSize = size;
+    file->header      = (const ColumnarHeader*)mapping;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors openColumnarFile(const char* fileName, bool isWritable, struct ColumnarFile* file) {
+    ///\throw fileName should not be NULL
+    ///\throw file should not be NULL
+    assert(fileName != NULL);
+    assert(file != NULL);
+
+    if (fileName == NULL || file == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    *file = {};
+    file->fd = open(fileName, isWritable ? O_RDWR : O_RDONLY);
+    if (file->fd == -1)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    struct stat fileInfo = {};
+    if (fstat(file->fd, &fileInfo) == -1 || !S_ISREG(fileInfo.st_mode) ||
+        (size_t)fileInfo.st_size < sizeof(ColumnarHeader) ||
+        mapColumnarFile(file, (size_t)fileInfo.st_size, isWritable) != QUAD_EQ_ERRORS_OK) {
+        close(file->fd);
+        file->fd = -1;
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    }
+
+    if (!isHeaderValid(file->header, file->mappingSize)) {
+        closeColumnarFile(file);
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    }
+
+    madvise(file->mapping, file->mappingSize, MADV_SEQUENTIAL);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors closeColumnarFile(struct ColumnarFile* file) {
+    ///\throw file should not be NULL
+    assert(file != NULL);
+
+    if (file == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (file->mapping != NULL)
+        munmap(file->mapping, file->mappingSize);
+    if (file->fd != -1)
+        close(file->fd);
+    *file = {};
+    file->fd = -1;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors setColumnarCount(struct ColumnarFile* file, size_t count) {
+    ///\throw file should not be NULL
+    assert(file != NULL);
+
+    if (file == NULL || file->header == NULL || count > file->header->count)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // header is a part of mapping, so change goes directly to file
+    ((ColumnarHeader*)file->mapping)->count = count;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+void* getColumnarColumn(const struct ColumnarFile* file, ColumnarColumn column) {
+    ///\throw file should not be NULL
+    assert(file != NULL);
+    assert(file->header != NULL);
+
+    if (file == NULL || file->header == NULL || column < 0 || column >= COLUMNAR_NUM_OF_COLUMNS)
+        return NULL;
+    if (!(file->header->columns & (1u << column)))
+        return NULL;
+    return file->mapping + file->header->columnOffsets[column];
+}
+
+/// @brief checks that files contain needed columns and have the same precision and count
+static bool areFilesCompatible(const struct ColumnarFile* source, uint32_t sourceColumns,
+                               const struct ColumnarFile* destination, uint32_t destinationColumns) {
+    return (source->header->columns & sourceColumns) == sourceColumns &&
+           (destination->header->columns & destinationColumns) == destinationColumns &&
+           source->header->precision == destination->header->precision &&
+           source->header->count == destination->header->count;
+}
+
+QuadEqErrors solveColumnarFile(const struct ColumnarFile* input, struct ColumnarFile* output, struct ThreadPool* pool) {
+    ///\throw input should not be NULL
+    ///\throw output should not be NULL
+    assert(input != NULL);
+    assert(output != NULL);
+
+    if (input == NULL || output == NULL || input->header == NULL || output->header == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (!areFilesCompatible(input, COLUMNAR_COEF_COLUMNS, output, COLUMNAR_ANSWER_COLUMNS))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    size_t count = input->header->count;
+    QuadEqRootState* numOfSols = (QuadEqRootState*)getColumnarColumn(output, COLUMNAR_COLUMN_NUM_OF_SOLS);
+    if (input->header->precision == COLUMNAR_PRECISION_F64) {
+        QuadraticEquationDoubleBatch batch = {count,
+            (const double*)getColumnarColumn(input, COLUMNAR_COLUMN_A),
+            (const double*)getColumnarColumn(input, COLUMNAR_COLUMN_B),
+            (const double*)getColumnarColumn(input, COLUMNAR_COLUMN_C)};
+        QuadraticEquationDoubleBatchAnswer answer = {
+            (double*)getColumnarColumn(output, COLUMNAR_COLUMN_ROOT_1),
+            (double*)getColumnarColumn(output, COLUMNAR_COLUMN_ROOT_2), numOfSols};
+        return getSolutionsBatchSimdParallel(pool, &batch, &answer);
+    }
+
+    QuadraticEquationBatch batch = {count,
+        (const long double*)getColumnarColumn(input, COLUMNAR_COLUMN_A),
+        (const long double*)getColumnarColumn(input, COLUMNAR_COLUMN_B),
+        (const long double*)getColumnarColumn(input, COLUMNAR_COLUMN_C)};
+    QuadraticEquationBatchAnswer answer = {
+        (long double*)getColumnarColumn(output, COLUMNAR_COLUMN_ROOT_1),
+        (long double*)getColumnarColumn(output, COLUMNAR_COLUMN_ROOT_2), numOfSols};
+    return getSolutionsBatchParallel(pool, &batch, &answer);
+}
+
+QuadEqErrors copyColumnarCoefs(const struct ColumnarFile* source, struct ColumnarFile* destination) {
+    ///\throw source should not be NULL
+    ///\throw destination should not be NULL
+    assert(source != NULL);
+    assert(destination != NULL);
+
+    if (source == NULL || destination == NULL || source->header == NULL || destination->header == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (!areFilesCompatible(source, COLUMNAR_COEF_COLUMNS, destination, COLUMNAR_COEF_COLUMNS))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    size_t columnSize = source->header->count * source->header->elementSize;
+    for (int column = COLUMNAR_COLUMN_A; column <= COLUMNAR_COLUMN_C; ++column)
+        memcpy(getColumnarColumn(destination, (ColumnarColumn)column),
+               getColumnarColumn(source,      (ColumnarColumn)column), columnSize);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors printColumnarAnswers(const struct ColumnarFile* file, struct ResultWriter* output, int outputPrecision) {
+    ///\throw file should not be NULL
+    ///\throw output should not be NULL
+    assert(file != NULL);
+    assert(output != NULL);
+
+    if (file == NULL || output == NULL || file->header == NULL || outputPrecision < 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if ((file->header->columns & COLUMNAR_ANSWER_COLUMNS) != COLUMNAR_ANSWER_COLUMNS)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    bool isF64 = file->header->precision == COLUMNAR_PRECISION_F64;
+    const void*            root_1    = getColumnarColumn(file, COLUMNAR_COLUMN_ROOT_1);
+    const void*            root_2    = getColumnarColumn(file, COLUMNAR_COLUMN_ROOT_2);
+    const QuadEqRootState* numOfSols = (const QuadEqRootState*)getColumnarColumn(file, COLUMNAR_COLUMN_NUM_OF_SOLS);
+    for (size_t i = 0; i < file->header->count; ++i) {
+        long double first  = isF64 ? ((const double*)root_1)[i] : ((const long double*)root_1)[i];
+        long double second = isF64 ? ((const double*)root_2)[i] : ((const long double*)root_2)[i];
+        printBatchResult(output, numOfSols[i], first, second, outputPrecision);
+    }
+    return output->error;
+}
@@ -0,0 +1,472 @@
+/**
+    \file
+    \brief realization of generator of tests corpora
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include <charconv>
+
+#include "../include/corpusGenerator.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief roots of usual equations are m / 2^p with p from [0, CORPUS_MAX_ROOT_POWER]
+const int CORPUS_MAX_ROOT_POWER         = 8;
+/// @brief roots of near degenerate equations are m / 2^p with p from this range,
+///        discriminant is at least 2^(-2 * CORPUS_MAX_NEAR_ROOT_POWER), that is still bigger than EPSILON
+const int CORPUS_MIN_NEAR_ROOT_POWER    = 10;
+const int CORPUS_MAX_NEAR_ROOT_POWER    = 14;
+/// @brief distance between roots (and height of vertex) of near degenerate equation in units of 2^(-p)
+const int CORPUS_MAX_NEAR_GAP           = 4;
+/// @brief extreme equations are scaled down by random power of 2 from [0, CORPUS_MAX_EXTREME_SPREAD]
+const int CORPUS_MAX_EXTREME_SPREAD     = 3;
+/// @brief linear equation has b = 0 (and no roots) with probability 1 / CORPUS_LINEAR_NO_ROOTS_RATE
+const int CORPUS_LINEAR_NO_ROOTS_RATE   = 8;
+/// @brief number of binary records, that are generated before one write to output
+const size_t CORPUS_BLOCK_SIZE          = 1024;
+/// @brief enough for one test in text format: 5 shortest doubles (at most 24 chars each) and 6 short lines
+const size_t CORPUS_TEXT_TEST_MAX_LEN   = 256;
+
+static_assert(CORPUS_FACTOR_BITS + CORPUS_ROOT_BITS + 2 <= 32, "b should be squared exactly in long double");
+static_assert(CORPUS_FACTOR_BITS + 2 * CORPUS_ROOT_BITS + 1 <= 53, "c should fit into double exactly");
+
+// --------------------------   RANDOM   ---------------------------------
+
+/// @brief xorshift64*, fast and good enough for sampling of tests
+static inline uint64_t getNextCorpusRandom(CorpusGenerator* generator) {
+    uint64_t state = generator->randomState;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    generator->randomState = state;
+    return state * 2685821657736338717ULL;
+}
+
+/// @brief returns random integer from [from, to], without division
+static inline int64_t getCorpusRandomInRange(CorpusGenerator* generator, int64_t from, int64_t to) {
+    uint64_t rangeSize = (uint64_t)(to - from) + 1;
+    return from + (int64_t)(((unsigned __int128)getNextCorpusRandom(generator) * rangeSize) >> 64);
+}
+
+static inline int64_t getCorpusRandomSign(CorpusGenerator* generator) {
+    return (getNextCorpusRandom(generator) >> 63) ? -1 : 1;
+}
+
+/// @brief random numerator of root, it's bit width is uniform too, so small and big roots are equally often
+static inline int64_t getCorpusRandomNumerator(CorpusGenerator* generator, int minBits) {
+    int     numOfBits = (int)getCorpusRandomInRange(generator, minBits, CORPUS_ROOT_BITS);
+    int64_t value     = getCorpusRandomInRange(generator, 0, ((int64_t)1 << numOfBits) - 1);
+    return getCorpusRandomSign(generator) * value;
+}
+
+/// @brief random leading coefficient, it's never 0
+static inline int64_t getCorpusRandomFactor(CorpusGenerator* generator, bool canBeNegative) {
+    int64_t factor = getCorpusRandomInRange(generator, 1, ((int64_t)1 << CORPUS_FACTOR_BITS) - 1);
+    return canBeNegative ? getCorpusRandomSign(generator) * factor : factor;
+}
+
+/// @brief splitmix64, spreads bits of seed, so close seeds give different sequences
+static uint64_t mixCorpusSeed(uint64_t seed) {
+    seed += 0x9E3779B97F4A7C15ULL;
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+    seed ^= seed >> 31;
+    // xorshift never leaves zero state
+    return seed != 0 ? seed : 0x9E3779B97F4A7C15ULL;
+}
+
+// --------------------------   CONFIG   ---------------------------------
+
+void setDefaultCorpusConfig(struct CorpusGeneratorConfig* config) {
+    ///\throw config should not be NULL
+    assert(config != NULL);
+
+    config->seed = CORPUS_DEFAULT_SEED;
+    for (int kind = 0; kind < CORPUS_NUM_OF_KINDS; ++kind)
+        config->weights[kind] = CORPUS_DEFAULT_WEIGHTS[kind];
+}
+
+/// @brief returns kind with name [begin, end), -1 if there is no such kind
+static int findCorpusKind(const char* begin, const char* end) {
+    size_t len = (size_t)(end - begin);
+    for (int kind = 0; kind < CORPUS_NUM_OF_KINDS; ++kind)
+        if (strlen(CORPUS_KIND_NAMES[kind]) == len && memcmp(CORPUS_KIND_NAMES[kind], begin, len) == 0)
+            return kind;
+    return -1;
+}
+
+QuadEqErrors parseCorpusMix(const char* mix, struct CorpusGeneratorConfig* config) {
+    ///\throw mix should not be NULL
+    ///\throw config should not be NULL
+    assert(mix != NULL);
+    assert(config != NULL);
+
+    if (mix == NULL || config == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    uint32_t weights[CORPUS_NUM_OF_KINDS] = {};
+    uint64_t totalWeight = 0;
+    const char* position = mix;
+    while (true) {
+        const char* nameEnd = strchr(position, '=');
+        int kind = nameEnd != NULL ? findCorpusKind(position, nameEnd) : -1;
+        if (kind == -1 || (unsigned)(nameEnd[1] - '0') >= 10)
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT);
+
+        char* weightEnd = NULL;
+        unsigned long weight = strtoul(nameEnd + 1, &weightEnd, 10);
+        if (weight > CORPUS_MAX_WEIGHT || (*weightEnd != ',' && *weightEnd != '\0'))
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT);
+        weights[kind] = (uint32_t)weight;
+        totalWeight  += weight;
+
+        if (*weightEnd == '\0')
+            break;
+        position = weightEnd + 1;
+    }
+
+    if (totalWeight == 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT);
+    memcpy(config->weights, weights, sizeof(weights));
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors initCorpusGenerator(struct CorpusGenerator* generator, const struct CorpusGeneratorConfig* config) {
+    ///\throw generator should not be NULL
+    ///\throw config should not be NULL
+    assert(generator != NULL);
+    assert(config != NULL);
+
+    if (generator == NULL || config == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    uint64_t totalWeight = 0;
+    for (int kind = 0; kind < CORPUS_NUM_OF_KINDS; ++kind) {
+        if (config->weights[kind] > CORPUS_MAX_WEIGHT)
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+        totalWeight += config->weights[kind];
+        generator->weightBounds[kind] = (uint32_t)totalWeight;
+    }
+    if (totalWeight == 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    generator->totalWeight = (uint32_t)totalWeight;
+    generator->randomState = mixCorpusSeed(config->seed);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+// --------------------------   GENERATION   ---------------------------------
+
+/// @brief returns numerator * 2^(-power), it's exact, because numerator has less than 53 bits
+static inline double makeDyadic(int64_t numerator, int power) {
+    return ldexp((double)numerator, -power);
+}
+
+/// @brief a = k, b = -k * (root_1 + root_2), c = k * root_1 * root_2, roots are numerator_1,2 * 2^(-power)
+static void buildFromRoots(CorpusRecord* record, int64_t factor, int64_t numerator_1, int64_t numerator_2, int power) {
+    assert(numerator_1 != numerator_2);
+    assert(factor > 0);
+
+    if (numerator_1 > numerator_2) {
+        int64_t tmp = numerator_1;
+        numerator_1 = numerator_2;
+        numerator_2 = tmp;
+    }
+    record->a         = (double)factor;
+    record->b         = makeDyadic(-factor * (numerator_1 + numerator_2), power);
+    record->c         = makeDyadic(factor * numerator_1 * numerator_2, 2 * power);
+    record->root_1    = makeDyadic(numerator_1, power);
+    record->root_2    = makeDyadic(numerator_2, power);
+    record->numOfSols = TWO_ROOTS;
+}
+
+/// @brief a * (x - vertex)^2 + height, vertex is numerator * 2^(-power), height is sign(a) * lift * 2^(-2 * power)
+static void buildFromVertex(CorpusRecord* record, int64_t factor, int64_t numerator, int64_t lift, int power) {
+    assert(factor != 0);
+    assert(lift >= 0);
+
+    int64_t height    = factor > 0 ? lift : -lift;
+    record->a         = (double)factor;
+    record->b         = makeDyadic(-2 * factor * numerator, power);
+    record->c         = makeDyadic(factor * numerator * numerator + height, 2 * power);
+    record->root_1    = lift == 0 ? makeDyadic(numerator, power) : 0;
+    record->root_2    = record->root_1;
+    record->numOfSols = lift == 0 ? ONE_ROOT : NO_ROOTS;
+}
+
+static void generateTwoRoots(CorpusGenerator* generator, CorpusRecord* record) {
+    int64_t numerator_1 = getCorpusRandomNumerator(generator, 0);
+    int64_t numerator_2 = numerator_1;
+    while (numerator_2 == numerator_1)
+        numerator_2 = getCorpusRandomNumerator(generator, 0);
+
+    int power = (int)getCorpusRandomInRange(generator, 0, CORPUS_MAX_ROOT_POWER);
+    buildFromRoots(record, getCorpusRandomFactor(generator, false), numerator_1, numerator_2, power);
+}
+
+static void generateOneRoot(CorpusGenerator* generator, CorpusRecord* record) {
+    int power = (int)getCorpusRandomInRange(generator, 0, CORPUS_MAX_ROOT_POWER);
+    buildFromVertex(record, getCorpusRandomFactor(generator, true), getCorpusRandomNumerator(generator, 0), 0, power);
+}
+
+static void generateNoRoots(CorpusGenerator* generator, CorpusRecord* record) {
+    int     power = (int)getCorpusRandomInRange(generator, 0, CORPUS_MAX_ROOT_POWER);
+    int64_t lift  = getCorpusRandomInRange(generator, 1, ((int64_t)1 << CORPUS_ROOT_BITS) - 1);
+    buildFromVertex(record, getCorpusRandomFactor(generator, true), getCorpusRandomNumerator(generator, 0), lift, power);
+}
+
+static void generateLinear(CorpusGenerator* generator, CorpusRecord* record) {
+    int64_t factor = getCorpusRandomFactor(generator, true);
+    record->a = 0;
+    if (getCorpusRandomInRange(generator, 1, CORPUS_LINEAR_NO_ROOTS_RATE) == 1) {
+        record->b         = 0;
+        record->c         = (double)factor;
+        record->root_1    = record->root_2 = 0;
+        record->numOfSols = NO_ROOTS;
+        return;
+    }
+
+    // -c / b is exactly the root, so solver gets it without rounding
+    int64_t numerator = getCorpusRandomNumerator(generator, 0);
+    int     power     = (int)getCorpusRandomInRange(generator, 0, CORPUS_MAX_ROOT_POWER);
+    record->b         = (double)factor;
+    record->c         = makeDyadic(-factor * numerator, power);
+    record->root_1    = record->root_2 = makeDyadic(numerator, power);
+    record->numOfSols = ONE_ROOT;
+}
+
+static void generateInfiniteRoots(CorpusRecord* record) {
+    record->a = record->b = record->c = 0;
+    record->root_1 = record->root_2 = 0;
+    record->numOfSols = INFINITE_ROOTS;
+}
+
+/// @brief big roots, that differ by few units of 2^(-power), or vertex, that is very close to axis
+static void generateNearDegenerate(CorpusGenerator* generator, CorpusRecord* record) {
+    int     power  = (int)getCorpusRandomInRange(generator, CORPUS_MIN_NEAR_ROOT_POWER, CORPUS_MAX_NEAR_ROOT_POWER);
+    int64_t gap    = getCorpusRandomInRange(generator, 1, CORPUS_MAX_NEAR_GAP);
+    // numerator is big, so discriminant is tiny relative to b^2, but it's still computed exactly
+    int64_t numerator = getCorpusRandomNumerator(generator, CORPUS_ROOT_BITS / 2);
+    if (numerator + gap >= ((int64_t)1 << CORPUS_ROOT_BITS))
+        numerator -= gap;
+
+    if (getNextCorpusRandom(generator) >> 63)
+        buildFromRoots(record, getCorpusRandomFactor(generator, false), numerator, numerator + gap, power);
+    else
+        buildFromVertex(record, getCorpusRandomFactor(generator, true), numerator, gap, power);
+}
+
+/// @brief equation of other kind, multiplied by power of 2 (exactly), so that biggest coefficient is close to maximum
+static void generateExtreme(CorpusGenerator* generator, CorpusRecord* record) {
+    switch (getCorpusRandomInRange(generator, 0, 4)) {
+        case 0:  generateTwoRoots      (generator, record); break;
+        case 1:  generateOneRoot       (generator, record); break;
+        case 2:  generateNoRoots       (generator, record); break;
+        case 3:  generateLinear        (generator, record); break;
+        default: generateNearDegenerate(generator, record); break;
+    }
+
+    double maxCoef = fmax(fabs(record->a), fmax(fabs(record->b), fabs(record->c)));
+    // maximum / maxCoef = fraction * 2^exponent, fraction is from [0.5, 1), so maxCoef * 2^(exponent - 1) <= maximum
+    int exponent = 0;
+    frexp((double)MAX_COEF_ABS_VALUE / maxCoef, &exponent);
+    int scale = exponent - 1 - (int)getCorpusRandomInRange(generator, 0, CORPUS_MAX_EXTREME_SPREAD);
+    record->a = ldexp(record->a, scale);
+    record->b = ldexp(record->b, scale);
+    record->c = ldexp(record->c, scale);
+}
+
+void generateCorpusRecord(struct CorpusGenerator* generator, struct CorpusRecord* record) {
+    ///\throw generator should not be NULL
+    ///\throw record should not be NULL
+    assert(generator != NULL);
+    assert(record != NULL);
+
+    uint32_t choice = (uint32_t)getCorpusRandomInRange(generator, 0, (int64_t)generator->totalWeight - 1);
+    int kind = 0;
+    while (choice >= generator->weightBounds[kind])
+        ++kind;
+
+    *record = {};
+    record->kind = (uint8_t)kind;
+    switch ((CorpusTestKind)kind) {
+        case CORPUS_TWO_ROOTS:       generateTwoRoots      (generator, record); break;
+        case CORPUS_ONE_ROOT:        generateOneRoot       (generator, record); break;
+        case CORPUS_NO_ROOTS:        generateNoRoots       (generator, record); break;
+        case CORPUS_LINEAR:          generateLinear        (generator, record); break;
+        case CORPUS_INFINITE_ROOTS:  generateInfiniteRoots (record);            break;
+        case CORPUS_NEAR_DEGENERATE: generateNearDegenerate(generator, record); break;
+        case CORPUS_EXTREME:         generateExtreme       (generator, record); break;
+        case CORPUS_NUM_OF_KINDS:
+        default:
+            assert(false);
+            break;
+    }
+}
+
+void corpusRecordToTest(const struct CorpusRecord* record, struct Test* test) {
+    ///\throw record should not be NULL
+    ///\throw test should not be NULL
+    assert(record != NULL);
+    assert(test != NULL);
+
+    test->equation = {record->a, record->b, record->c, DEFAULT_PRECISION};
+    test->answer   = {record->root_1, record->root_2, (QuadEqRootState)record->numOfSols};
+}
+
+// --------------------------   OUTPUT   ---------------------------------
+
+/// @brief appends shortest representation of number, that is parsed back to the same double, and '\\n'
+static inline char* appendCorpusNumber(char* position, char* end, double number) {
+    std::to_chars_result result = std::to_chars(position, end, number);
+    assert(result.ec == std::errc());
+    *result.ptr = '\n';
+    return result.ptr + 1;
+}
+
+/// @brief formats test as lines of tests file, returns pointer after last written char
+static char* formatCorpusTest(const CorpusRecord* record, char* text) {
+    char* end = text + CORPUS_TEXT_TEST_MAX_LEN;
+    char* position = text;
+    position = appendCorpusNumber(position, end, record->a);
+    position = appendCorpusNumber(position, end, record->b);
+    position = appendCorpusNumber(position, end, record->c);
+    switch ((QuadEqRootState)record->numOfSols) {
+        case TWO_ROOTS:
+            position = appendCorpusNumber(position, end, record->root_1);
+            position = appendCorpusNumber(position, end, record->root_2);
+            break;
+        case ONE_ROOT:
+            position = appendCorpusNumber(position, end, record->root_1);
+            break;
+        case INFINITE_ROOTS:
+            memcpy(position, "inf\n", 4);
+            position += 4;
+            break;
+        case NO_ROOTS:
+        default:
+            break;
+    }
+    memcpy(position, "#\n", 2);
+    return position + 2;
+}
+
+static void writeCorpusHeader(size_t numOfTests, struct ResultWriter* output) {
+    CorpusHeader header = {};
+    memcpy(header.magic, CORPUS_MAGIC, sizeof(CORPUS_MAGIC));
+    header.version    = CORPUS_VERSION;
+    header.recordSize = (uint32_t)sizeof(CorpusRecord);
+    header.count      = numOfTests;
+    writeResultChars(output, (const char*)&header, sizeof(header));
+}
+
+QuadEqErrors writeCorpus(const struct CorpusGeneratorConfig* config, size_t numOfTests, CorpusFormat format,
+                         struct ResultWriter* output, struct CorpusStats* stats) {
+    ///\throw config should not be NULL
+    ///\throw output should not be NULL
+    assert(config != NULL);
+    assert(output != NULL);
+
+    if (config == NULL || output == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    CorpusGenerator generator = {};
+    QuadEqErrors error = initCorpusGenerator(&generator, config);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    CorpusStats corpusStats = {};
+    corpusStats.numOfTests = numOfTests;
+    if (format == CORPUS_FORMAT_BINARY) {
+        writeCorpusHeader(numOfTests, output);
+        // records are generated by blocks, so writer copies big pieces
+        CorpusRecord block[CORPUS_BLOCK_SIZE] = {};
+        for (size_t blockBegin = 0; blockBegin < numOfTests; blockBegin += CORPUS_BLOCK_SIZE) {
+            size_t blockSize = numOfTests - blockBegin < CORPUS_BLOCK_SIZE ? numOfTests - blockBegin : CORPUS_BLOCK_SIZE;
+            for (size_t i = 0; i < blockSize; ++i) {
+                generateCorpusRecord(&generator, &block[i]);
+                ++corpusStats.numOfKind[block[i].kind];
+            }
+            writeResultChars(output, (const char*)block, blockSize * sizeof(CorpusRecord));
+        }
+    } else {
+        char text[CORPUS_TEXT_TEST_MAX_LEN] = {};
+        for (size_t i = 0; i < numOfTests; ++i) {
+            CorpusRecord record = {};
+            generateCorpusRecord(&generator, &record);
+            ++corpusStats.numOfKind[record.kind];
+            writeResultChars(output, text, (size_t)(formatCorpusTest(&record, text) - text));
+        }
+    }
+
+    if (stats != NULL)
+        *stats = corpusStats;
+    return flushResultWriter(output);
+}
+
+QuadEqErrors generateCorpusTests(const struct CorpusGeneratorConfig* config, size_t numOfTests,
+                                 struct TestsArena* arena) {
+    ///\throw config should not be NULL
+    ///\throw arena should not be NULL
+    assert(config != NULL);
+    assert(arena != NULL);
+
+    if (config == NULL || arena == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    CorpusGenerator generator = {};
+    QuadEqErrors error = initCorpusGenerator(&generator, config);
+    if (error == QUAD_EQ_ERRORS_OK)
+        error = reserveTestsArena(arena, arena->count + numOfTests);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    for (size_t i = 0; i < numOfTests; ++i) {
+        CorpusRecord record = {};
+        generateCorpusRecord(&generator, &record);
+        corpusRecordToTest(&record, &arena->tests[arena->count++]);
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
+
+// --------------------------   BINARY INPUT   ---------------------------------
+
+bool isCorpusBinary(const void* data, size_t size) {
+    return data != NULL && size >= sizeof(CORPUS_MAGIC) && memcmp(data, CORPUS_MAGIC, sizeof(CORPUS_MAGIC)) == 0;
+}
+
+QuadEqErrors parseCorpusBinary(const void* data, size_t size, struct TestsArena* arena) {
+    ///\throw data should not be NULL
+    ///\throw arena should not be NULL
+    assert(data != NULL);
+    assert(arena != NULL);
+
+    if (data == NULL || arena == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (size < sizeof(CorpusHeader) || !isCorpusBinary(data, size))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    CorpusHeader header = {};
+    memcpy(&header, data, sizeof(header));
+    if (header.version != CORPUS_VERSION || header.recordSize != sizeof(CorpusRecord) ||
+        (size - sizeof(CorpusHeader)) / sizeof(CorpusRecord) != header.count ||
+        (size - sizeof(CorpusHeader)) % sizeof(CorpusRecord) != 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    QuadEqErrors error = reserveTestsArena(arena, arena->count + header.count);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    const unsigned char* records = (const unsigned char*)data + sizeof(CorpusHeader);
+    for (size_t i = 0; i < header.count; ++i) {
+        CorpusRecord record = {};
+        memcpy(&record, records + i * sizeof(CorpusRecord), sizeof(record));
+        if (record.numOfSols > INFINITE_ROOTS)
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+        corpusRecordToTest(&record, &arena->tests[arena->count++]);
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
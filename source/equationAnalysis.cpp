@@ -0,0 +1,210 @@
+/**
+    \file
+    \brief realization of one-pass and lazy analysis of equation
+*/
+
+#include <stdio.h>
+#include <assert.h>
+#include <math.h>
+
+#include "../include/equationAnalysis.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+// every part is computed from equation and parts, that are already computed
+
+static void computeDiscriminant(const QuadraticEquation* eq, QuadraticEquationAnalysis* analysis) {
+    analysis->isQuadratic  = sign(eq->a) != 0;
+    analysis->discriminant = computeDiscriminantT<long double>(eq->a, eq->b, eq->c);
+}
+
+/// @brief needs discriminant
+static void computeVertex(const QuadraticEquation* eq, QuadraticEquationAnalysis* analysis) {
+    // same formulas as getVertX() and getVertY()
+    analysis->vertX = analysis->isQuadratic ? -eq->b / (2 * eq->a)                 : 0;
+    analysis->vertY = analysis->isQuadratic ? -analysis->discriminant / (4 * eq->a) : 0;
+}
+
+/// @brief needs discriminant
+static void computeSolutions(const QuadraticEquation* eq, QuadraticEquationAnalysis* analysis) {
+    QuadraticEquationAnswer* answer = &analysis->answer;
+    answer->root_1 = answer->root_2 = 0;
+    if (analysis->isQuadratic)
+        solveQuadraticWithDiscriminantT<long double>(eq->a, eq->b, analysis->discriminant,
+                                                     &answer->root_1, &answer->root_2, &answer->numOfSols);
+    else
+        solveValidatedEquationT<long double>(eq->a, eq->b, eq->c, &answer->root_1, &answer->root_2, &answer->numOfSols);
+}
+
+static void addInterval(QuadraticEquationAnalysis* analysis, long double from, long double to, int intervalSign) {
+    assert(analysis->numOfIntervals < MAX_NUM_OF_SIGN_INTERVALS);
+    analysis->intervals[analysis->numOfIntervals++] = {from, to, intervalSign};
+}
+
+/// @brief needs solutions
+static void computeIntervals(const QuadraticEquation* eq, QuadraticEquationAnalysis* analysis) {
+    const QuadraticEquationAnswer* answer = &analysis->answer;
+    // far from roots quadratic has sign of a, linear has sign of b
+    int leadSign = analysis->isQuadratic ? sign(eq->a) : sign(eq->b);
+    analysis->numOfIntervals = 0;
+
+    switch (answer->numOfSols) {
+        case INFINITE_ROOTS:
+            addInterval(analysis, -HUGE_VALL, HUGE_VALL, 0);
+            break;
+        case NO_ROOTS:
+            addInterval(analysis, -HUGE_VALL, HUGE_VALL, analysis->isQuadratic ? leadSign : sign(eq->c));
+            break;
+        case ONE_ROOT:
+            // root of quadratic is vertex, sign doesn't change; root of linear equation changes it
+            addInterval(analysis, -HUGE_VALL, answer->root_1, analysis->isQuadratic ? leadSign : -leadSign);
+            addInterval(analysis, answer->root_1, HUGE_VALL, leadSign);
+            break;
+        case TWO_ROOTS: {
+            // with a < 0 first root is bigger
+            bool isReversed = answer->root_1 > answer->root_2;
+            long double left  = isReversed ? answer->root_2 : answer->root_1;
+            long double right = isReversed ? answer->root_1 : answer->root_2;
+            addInterval(analysis, -HUGE_VALL, left, leadSign);
+            addInterval(analysis, left, right, -leadSign);
+            addInterval(analysis, right, HUGE_VALL, leadSign);
+            break;
+        }
+        default:
+            assert(false);
+            break;
+    }
+}
+
+/// @brief computes part of lazy analysis (and parts, it depends on), if it's not computed yet
+static void computeLazyPart(LazyEquationAnalysis* lazy, LazyAnalysisParts part) {
+    if (lazy->computedParts & (unsigned)part)
+        return;
+
+    switch (part) {
+        case LAZY_ANALYSIS_DISCRIMINANT:
+            computeDiscriminant(&lazy->eq, &lazy->analysis);
+            break;
+        case LAZY_ANALYSIS_VERTEX:
+            computeLazyPart(lazy, LAZY_ANALYSIS_DISCRIMINANT);
+            computeVertex(&lazy->eq, &lazy->analysis);
+            break;
+        case LAZY_ANALYSIS_SOLUTIONS:
+            computeLazyPart(lazy, LAZY_ANALYSIS_DISCRIMINANT);
+            computeSolutions(&lazy->eq, &lazy->analysis);
+            break;
+        case LAZY_ANALYSIS_INTERVALS:
+            computeLazyPart(lazy, LAZY_ANALYSIS_SOLUTIONS);
+            computeIntervals(&lazy->eq, &lazy->analysis);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+    lazy->computedParts |= (unsigned)part;
+}
+
+QuadEqErrors initLazyAnalysis(struct LazyEquationAnalysis* lazy, const struct QuadraticEquation* eq) {
+    ///\throw lazy should not be NULL
+    ///\throw eq should not be NULL
+    assert(lazy != NULL);
+    assert(eq != NULL);
+
+    if (lazy == NULL || eq == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    *lazy = {};
+    lazy->eq = *eq;
+    lazy->validationError = isCoefValidT<long double>(eq->a) && isCoefValidT<long double>(eq->b) &&
+                            isCoefValidT<long double>(eq->c) ? QUAD_EQ_ERRORS_OK : QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG;
+    if (lazy->validationError != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(lazy->validationError);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief getters report error of validation on every call, but log it only once (in initLazyAnalysis())
+#define CHECK_LAZY_ANALYSIS(lazy)                               \
+    do {                                                        \
+        assert(lazy != NULL);                                   \
+        if (lazy == NULL)                                       \
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);         \
+        if (lazy->validationError != QUAD_EQ_ERRORS_OK)         \
+            return lazy->validationError;                       \
+    } while(0)
+
+QuadEqErrors getLazyDiscriminant(struct LazyEquationAnalysis* lazy, long double* discriminant) {
+    ///\throw discriminant should not be NULL
+    assert(discriminant != NULL);
+    CHECK_LAZY_ANALYSIS(lazy);
+    if (discriminant == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    computeLazyPart(lazy, LAZY_ANALYSIS_DISCRIMINANT);
+    *discriminant = lazy->analysis.discriminant;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors getLazyVertex(struct LazyEquationAnalysis* lazy, long double* vertX, long double* vertY) {
+    ///\throw vertX and vertY should not be NULL
+    assert(vertX != NULL);
+    assert(vertY != NULL);
+    CHECK_LAZY_ANALYSIS(lazy);
+    if (vertX == NULL || vertY == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    computeLazyPart(lazy, LAZY_ANALYSIS_VERTEX);
+    ///\warning eq->a should not be 0
+    if (!lazy->analysis.isQuadratic)
+        return QUAD_EQ_ERRORS_LINEAR_EQ;
+
+    *vertX = lazy->analysis.vertX;
+    *vertY = lazy->analysis.vertY;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors getLazySolutions(struct LazyEquationAnalysis* lazy, struct QuadraticEquationAnswer* answer) {
+    ///\throw answer should not be NULL
+    assert(answer != NULL);
+    CHECK_LAZY_ANALYSIS(lazy);
+    if (answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    computeLazyPart(lazy, LAZY_ANALYSIS_SOLUTIONS);
+    *answer = lazy->analysis.answer;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors getLazySignIntervals(struct LazyEquationAnalysis* lazy, struct SignInterval* intervals, size_t* numOfIntervals) {
+    ///\throw intervals and numOfIntervals should not be NULL
+    assert(intervals != NULL);
+    assert(numOfIntervals != NULL);
+    CHECK_LAZY_ANALYSIS(lazy);
+    if (intervals == NULL || numOfIntervals == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    computeLazyPart(lazy, LAZY_ANALYSIS_INTERVALS);
+    *numOfIntervals = lazy->analysis.numOfIntervals;
+    for (size_t i = 0; i < lazy->analysis.numOfIntervals; ++i)
+        intervals[i] = lazy->analysis.intervals[i];
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors analyzeEquation(const struct QuadraticEquation* eq, struct QuadraticEquationAnalysis* analysis) {
+    ///\throw eq should not be NULL
+    ///\throw analysis should not be NULL
+    assert(eq != NULL);
+    assert(analysis != NULL);
+
+    if (eq == NULL || analysis == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (!isCoefValidT<long double>(eq->a) || !isCoefValidT<long double>(eq->b) || !isCoefValidT<long double>(eq->c))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    // all parts are written directly to result, discriminant is shared by vertex and roots
+    computeDiscriminant(eq, analysis);
+    computeVertex      (eq, analysis);
+    computeSolutions   (eq, analysis);
+    computeIntervals   (eq, analysis);
+    return QUAD_EQ_ERRORS_OK;
+}
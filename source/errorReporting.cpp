@@ -0,0 +1,47 @@
+/**
+    \file
+    \brief realization of error sink
+*/
+
+#include <stdio.h>
+
+#include "../LoggerLib/include/colourfullPrint.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief installed sink, it's changed only before threads are started
+static struct {
+    QuadEqErrorSink sink;
+    void*           userData;
+} errorSink = {NULL, NULL};
+
+void setErrorSink(QuadEqErrorSink sink, void* userData) {
+    errorSink.sink     = sink;
+    errorSink.userData = userData;
+}
+
+void getErrorSink(QuadEqErrorSink* sink, void** userData) {
+    if (sink != NULL)
+        *sink = errorSink.sink;
+    if (userData != NULL)
+        *userData = errorSink.userData;
+}
+
+void printErrorSink(QuadEqErrors error, const char* file, const char* function, int line, void* userData) {
+    (void)userData;
+    // error of input data: user needs to know, where it is
+    if (function == NULL) {
+        QUAD_EQ_LOG_WARNING("%s:%d: %s", file, line, getErrorMessage(error));
+        printError("%s:%d: %s", file, line, getErrorMessage(error));
+        return;
+    }
+
+    // LOG_ERROR would show place of this function, so place of error is printed by hand
+    QUAD_EQ_LOG_ERROR("%s:%s:%d: %s", file, function, line, getErrorMessage(error));
+    (void)file; (void)function; (void)line;
+    printError("%s", getErrorMessage(error));
+}
+
+void reportError(QuadEqErrors error, const char* file, const char* function, int line) {
+    if (errorSink.sink != NULL)
+        errorSink.sink(error, file, function, line, errorSink.userData);
+}
@@ -0,0 +1,332 @@
+/**
+    \file
+    \brief realization of exact solver for equations with integer (or rational) coefficients
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <ctype.h>
+
+#include "../include/exactSolver.hpp"
+#include "../include/errorReporting.hpp"
+
+const long long MAX_EXACT_COEF_ABS_VALUE = (long long)MAX_COEF_ABS_VALUE; ///< 1e18 fits into long long
+const int       MAX_NUM_OF_DECIMALS      = 18; ///< 10 ^ 18 still fits into long long
+const int       INT128_STRING_LEN        = 42; ///< enough for any __int128 with sign and '\0'
+
+// ------------------------ HELPER FUNCTIONS ---------------------------------------
+
+static __int128 getAbs(__int128 x) {
+    return x < 0 ? -x : x;
+}
+
+static __int128 getGcd(__int128 x, __int128 y) {
+    x = getAbs(x);
+    y = getAbs(y);
+    while (y != 0) {
+        __int128 rest = x % y;
+        x = y;
+        y = rest;
+    }
+    return x;
+}
+
+/// @brief builds reduced fraction with positive denominator
+static ExactRational makeRational(__int128 numerator, __int128 denominator) {
+    assert(denominator != 0);
+
+    if (denominator < 0) {
+        numerator   = -numerator;
+        denominator = -denominator;
+    }
+    __int128 gcd = getGcd(numerator, denominator);
+    if (gcd > 1) {
+        numerator   /= gcd;
+        denominator /= gcd;
+    }
+
+    ExactRational result = {(long long)numerator, (long long)denominator};
+    return result;
+}
+
+static long double getRationalValue(ExactRational x) {
+    return (long double)x.numerator / (long double)x.denominator;
+}
+
+/**
+    \brief finds integer square root of value
+    \result true if value is perfect square
+*/
+static bool getIntegerSqrt(__int128 value, long long* root) {
+    assert(value >= 0);
+    assert(root != NULL);
+
+    // long double root is correct up to 1, so at most few corrections are needed
+    __int128 result = (__int128)sqrtl((long double)value);
+    while (result * result > value)
+        --result;
+    while ((result + 1) * (result + 1) <= value)
+        ++result;
+
+    *root = (long long)result;
+    return result * result == value;
+}
+
+/// @brief converts __int128 to string, printf can't do it
+static const char* int128ToString(__int128 value, char buffer[INT128_STRING_LEN]) {
+    char* ptr = buffer + INT128_STRING_LEN - 1;
+    *ptr = '\0';
+
+    bool isNegative = value < 0;
+    unsigned __int128 absValue = isNegative ? -(unsigned __int128)value : (unsigned __int128)value;
+    do {
+        *--ptr = (char)('0' + (int)(absValue % 10));
+        absValue /= 10;
+    } while (absValue != 0);
+
+    if (isNegative)
+        *--ptr = '-';
+    return ptr;
+}
+
+/**
+    \brief parses unsigned integer, that fits into long long
+    \result pointer to first not parsed char, NULL if there are no digits or number is too big
+*/
+static const char* parseUnsigned(const char* ptr, const char* end, __int128* number, int* numOfDigits) {
+    *number = 0;
+    *numOfDigits = 0;
+    while (ptr < end && isdigit(*ptr)) {
+        *number = *number * 10 + (*ptr - '0');
+        ++*numOfDigits;
+        if (*number > (__int128)__LONG_LONG_MAX__)
+            return NULL;
+        ++ptr;
+    }
+    return ptr;
+}
+
+// -------------------- FUNCTIONS REALIZATIONS -------------------------------
+
+QuadEqErrors parseExactCoef(const char* line, struct ExactRational* coef, bool* result) {
+    ///\throw line should not be NULL
+    ///\throw coef should not be NULL
+    ///\throw result should not be NULL
+    assert(line != NULL);
+    assert(coef != NULL);
+    assert(result != NULL);
+
+    if (line == NULL || coef == NULL || result == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    *result = false;
+    const char* ptr = line;
+    const char* end = line + strlen(line);
+    while (end > ptr && (isblank(end[-1]) || end[-1] == '\n'))
+        --end;
+
+    bool isNegative = false;
+    if (ptr < end && (*ptr == '-' || *ptr == '+'))
+        isNegative = *ptr++ == '-';
+
+    __int128 numerator = 0;
+    int numOfDigits = 0;
+    ptr = parseUnsigned(ptr, end, &numerator, &numOfDigits);
+    if (ptr == NULL)
+        return QUAD_EQ_ERRORS_OK;
+
+    __int128 denominator = 1;
+    if (ptr < end && *ptr == '.') {
+        // decimal fraction: digits after point are appended to numerator
+        ++ptr;
+        int numOfDecimals = 0;
+        for (; ptr < end && isdigit(*ptr); ++ptr, ++numOfDecimals, ++numOfDigits) {
+            if (numOfDecimals == MAX_NUM_OF_DECIMALS)
+                return QUAD_EQ_ERRORS_OK;
+            numerator   = numerator * 10 + (*ptr - '0');
+            denominator *= 10;
+            if (numerator > (__int128)__LONG_LONG_MAX__)
+                return QUAD_EQ_ERRORS_OK;
+        }
+    } else if (ptr < end && *ptr == '/' && numOfDigits > 0) {
+        int numOfDenomDigits = 0;
+        ptr = parseUnsigned(ptr + 1, end, &denominator, &numOfDenomDigits);
+        if (ptr == NULL || numOfDenomDigits == 0 || denominator == 0)
+            return QUAD_EQ_ERRORS_OK;
+    }
+
+    if (numOfDigits == 0 || ptr != end)
+        return QUAD_EQ_ERRORS_OK;
+
+    *coef = makeRational(isNegative ? -numerator : numerator, denominator);
+    *result = true;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors buildIntegerEquation(const struct ExactRational coefs[3], struct IntegerQuadraticEquation* eq, bool* result) {
+    ///\throw coefs should not be NULL
+    ///\throw eq should not be NULL
+    ///\throw result should not be NULL
+    assert(coefs != NULL);
+    assert(eq != NULL);
+    assert(result != NULL);
+
+    if (coefs == NULL || eq == NULL || result == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    *result = false;
+    __int128 commonDenominator = 1;
+    for (int i = 0; i < 3; ++i) {
+        if (coefs[i].denominator <= 0)
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+        // least common multiple
+        commonDenominator = commonDenominator / getGcd(commonDenominator, coefs[i].denominator) * coefs[i].denominator;
+        if (commonDenominator > (__int128)__LONG_LONG_MAX__)
+            return QUAD_EQ_ERRORS_OK;
+    }
+
+    long long* const integerCoefs[3] = {&eq->a, &eq->b, &eq->c};
+    for (int i = 0; i < 3; ++i) {
+        __int128 scaled = (__int128)coefs[i].numerator * (commonDenominator / coefs[i].denominator);
+        if (getAbs(scaled) > MAX_EXACT_COEF_ABS_VALUE)
+            return QUAD_EQ_ERRORS_OK;
+        *integerCoefs[i] = (long long)scaled;
+    }
+
+    eq->denominator = (long long)commonDenominator;
+    *result = true;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief roots are irrational, so they are computed from exact discriminant in long double
+static void solveIrrational(const IntegerQuadraticEquation* eq, __int128 disc, QuadraticEquationAnswer* answer) {
+    long double a = (long double)eq->a;
+    long double b = (long double)eq->b;
+    long double c = (long double)eq->c;
+    long double discRoot = sqrtl((long double)disc);
+
+    // numerically stable formulas: there is no subtraction of close numbers
+    long double q = b >= 0 ? -(b + discRoot) / 2 : (discRoot - b) / 2;
+    long double first  = q / a;
+    long double second = c / q;
+    // root_1 should be (-b - discRoot) / (2 * a), same as in getSolutions()
+    answer->root_1 = b >= 0 ? first  : second;
+    answer->root_2 = b >= 0 ? second : first;
+    answer->numOfSols = TWO_ROOTS;
+}
+
+QuadEqErrors getSolutionsExact(const struct IntegerQuadraticEquation* eq, struct ExactQuadraticEquationAnswer* answer) {
+    ///\throw eq should not be NULL
+    ///\throw answer should not be NULL
+    assert(eq != NULL);
+    assert(answer != NULL);
+
+    if (eq == NULL || answer == NULL || eq->denominator <= 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (getAbs(eq->a) > MAX_EXACT_COEF_ABS_VALUE ||
+        getAbs(eq->b) > MAX_EXACT_COEF_ABS_VALUE ||
+        getAbs(eq->c) > MAX_EXACT_COEF_ABS_VALUE)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    *answer = {};
+    QuadraticEquationAnswer* approx = &answer->answer;
+
+    // linear case
+    if (eq->a == 0) {
+        if (eq->b == 0) {
+            approx->numOfSols = eq->c != 0 ? NO_ROOTS : INFINITE_ROOTS;
+            return QUAD_EQ_ERRORS_OK;
+        }
+
+        answer->exactRoot_1 = answer->exactRoot_2 = makeRational(-(__int128)eq->c, eq->b);
+        answer->areRootsRational = true;
+        approx->root_1 = approx->root_2 = getRationalValue(answer->exactRoot_1);
+        approx->numOfSols = ONE_ROOT;
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    // |b ^ 2| <= 1e36 and |4 * a * c| <= 4e36, so everything fits into __int128 (max is ~1.7e38)
+    __int128 disc = (__int128)eq->b * eq->b - (__int128)4 * eq->a * eq->c;
+    answer->discriminant = disc;
+    if (disc < 0) {
+        approx->numOfSols = NO_ROOTS;
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    long long discRoot = 0;
+    if (!getIntegerSqrt(disc, &discRoot)) {
+        solveIrrational(eq, disc, approx);
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    __int128 denom = (__int128)2 * eq->a;
+    answer->areRootsRational = true;
+    answer->exactRoot_1 = makeRational(-(__int128)eq->b - discRoot, denom);
+    answer->exactRoot_2 = makeRational(-(__int128)eq->b + discRoot, denom);
+    approx->root_1 = getRationalValue(answer->exactRoot_1);
+    approx->root_2 = getRationalValue(answer->exactRoot_2);
+    approx->numOfSols = disc == 0 ? ONE_ROOT : TWO_ROOTS;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief prints fraction, or just numerator if denominator is 1
+static void printRational(ExactRational x) {
+    if (x.denominator == 1)
+        printf("%lld", x.numerator);
+    else
+        printf("%lld/%lld", x.numerator, x.denominator);
+}
+
+/// @brief prints irrational root as formula (-b +- sqrt(D)) / (2 * a) and it's approximate value
+static void printIrrationalRoot(const IntegerQuadraticEquation* eq, __int128 disc,
+                                char sqrtSign, long double value, int outputPrecision) {
+    char discBuffer[INT128_STRING_LEN] = {};
+    printf("(%lld %c sqrt(%s)) / %lld ~ %.*Lg",
+           -eq->b, sqrtSign, int128ToString(disc, discBuffer), 2 * eq->a, outputPrecision, value);
+}
+
+QuadEqErrors printExactSolutions(const struct IntegerQuadraticEquation* eq,
+                                 const struct ExactQuadraticEquationAnswer* answer, int outputPrecision) {
+    ///\throw eq should not be NULL
+    ///\throw answer should not be NULL
+    assert(eq != NULL);
+    assert(answer != NULL);
+    if (eq == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    const QuadraticEquationAnswer* approx = &answer->answer;
+    switch (approx->numOfSols) {
+        case INFINITE_ROOTS:
+            printf("Infinitely many solutions\n");
+            return QUAD_EQ_ERRORS_OK;
+        case NO_ROOTS:
+            printf("Number of solutions: 0, solutions of equation : {  }\n");
+            return QUAD_EQ_ERRORS_OK;
+        case ONE_ROOT:
+        case TWO_ROOTS:
+            break;
+        default:
+            assert(false);
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    }
+
+    printf("Number of solutions: %d, solutions of equation : { ", approx->numOfSols);
+    if (answer->areRootsRational) {
+        if (approx->numOfSols == TWO_ROOTS) {
+            printRational(answer->exactRoot_1);
+            printf(", ");
+        }
+        printRational(answer->exactRoot_2);
+    } else {
+        printIrrationalRoot(eq, answer->discriminant, '-', approx->root_1, outputPrecision);
+        printf(", ");
+        printIrrationalRoot(eq, answer->discriminant, '+', approx->root_2, outputPrecision);
+    }
+    printf(" }\n");
+
+    return QUAD_EQ_ERRORS_OK;
+}
@@ -13,6 +13,22 @@
 #include "../include/testsGenerator.hpp"
 #include "../include/quadraticEquation.hpp"
 #include "../include/terminalArgs.hpp"
+#include "../include/exactSolver.hpp"
+#include "../include/batchMode.hpp"
+#include "../include/columnarFormat.hpp"
+#include "../include/threadPool.hpp"
+#include "../include/resultWriter.hpp"
+#include "../include/solutionsCache.hpp"
+#include "../include/solutionsStore.hpp"
+#include "../include/solverServer.hpp"
+#include "../include/sharedChannel.hpp"
+#include "../include/equationAnalysis.hpp"
+#include "../include/corpusGenerator.hpp"
+#include "../include/accuracyHarness.hpp"
+#include "../include/solverRegistry.hpp"
+#include "../include/testsLoader.hpp"
+#include "../include/moduleTests.hpp"
+#include "../include/errorReporting.hpp"
 
 //#define NO_LOG
 //extern "C" {
@@ -24,28 +40,38 @@
 
 
 void quadraticEquationShowcase(struct QuadraticEquation* equation, const char* outputFile);
-int runOnTests(char* testsFileSource);
+int runOnTests(char* testsFileSource, ThreadPool* pool, getSolutionsFuncPtr solver);
+int runExactMode(const ArgsManager* manager);
+int runBatch(const char* inputFile, const char* outputFile, const char* binOutputFile, ThreadPool* pool);
+int runColumnar(const char* binInputFile, const char* binOutputFile, const char* outputFile, ThreadPool* pool);
+int runStoreCompaction(const char* storeFile);
+int runChannelSolver(const char* channelName, ThreadPool* pool);
+int runGenerator(const ArgsManager* manager, const char* outputFile);
+int runAccuracy(const ArgsManager* manager, getSolutionsFuncPtr solver);
+ThreadPool* createPoolFromArgs(const ArgsManager* manager, bool* isOk);
+bool isSolverUsedByMode(const ArgsManager* manager);
+const SolverImplementation* createSolverFromArgs(const ArgsManager* manager, bool isUsed, bool* isOk);
+bool createCachesFromArgs(const ArgsManager* manager, const SolverImplementation* solver);
+void finishCaches();
 
 int main(int argc, const char* const argv[]) {
 #ifdef RUN_ON_TESTS
-    return runOnTests(NULL);
+    // solver is checked on myTests first, then behaviour of modules is checked
+    if (runOnTests(NULL, NULL, &getSolutions) != ALL_TESTS_PASSED)
+        return FAILED_ON_SOME_TEST;
+    return runModuleTests();
 #endif
 
     // ----------------------     LOGGER INIT      ----------------------------------
 
     setLoggingLevel(DEBUG);
     //stateLogFile("../loggingFile.txt");
-    LOG_DEBUG("i am debug\n");
-    LOG_INFO("i am info\n");
-    LOG_WARNING("i am warning\n");
-    LOG_ERROR("i am error\n");
-
-    int a = 10;
-    bool f = true;
-    long double pie = 3.141592;
-    DEBUG_("i am debug macros", a, f, pie);
-
-    // DEBUG("fdas");
+    // logs are formatted and written by background thread, destructAsyncLogger() writes what is left
+    startAsyncLogger();
+    // logger is stopped at any exit from main(), so early returns don't need to do it
+    atexit(destructAsyncLogger);
+    // library only returns errors, libRun shows them to user
+    setErrorSink(printErrorSink, NULL);
 
 
 
@@ -68,27 +94,102 @@ int main(int argc, const char* const argv[]) {
         return 0;
     }
 
+    const char* compactStoreFile = parseCompactStoreFile(&manager);
+    if (compactStoreFile != NULL)
+        return runStoreCompaction(compactStoreFile);
+
     const char* outputFile = parseOutputFile(&manager);
 
+    // solver is chosen once, auto mode checks and measures all implementations only if mode uses solver
+    bool isSolverOk = false;
+    const SolverImplementation* solver = createSolverFromArgs(&manager, isSolverUsedByMode(&manager), &isSolverOk);
+    if (!isSolverOk)
+        return 1;
+
+    // accuracy harness takes --generate flags too, as description of corpus
+    bool isAccuracyRun = false;
+    char* accuracyTestsFile = parseAccuracyArgs(&manager, &isAccuracyRun);
+    free(accuracyTestsFile);
+    if (isAccuracyRun)
+        return runAccuracy(&manager, solver->solver);
+
+    if (isGenerateNeeded(&manager))
+        return runGenerator(&manager, outputFile);
+
+    bool isPoolOk = false;
+    ThreadPool* pool = createPoolFromArgs(&manager, &isPoolOk);
+    if (!isPoolOk)
+        return 1;
+    if (!createCachesFromArgs(&manager, solver)) {
+        destroyThreadPool(pool);
+        return 1;
+    }
+
+    // server solves by vectorized double solver, caches of long double answers are not used
+    const char* serveSocket = parseServeSocket(&manager);
+    if (serveSocket != NULL) {
+        int code = runSolverServer(serveSocket, pool) == QUAD_EQ_ERRORS_OK ? 0 : 1;
+        finishCaches();
+        destroyThreadPool(pool);
+        return code;
+    }
+
+    const char* channelName = parseChannelName(&manager);
+    if (channelName != NULL) {
+        int code = runChannelSolver(channelName, pool);
+        finishCaches();
+        destroyThreadPool(pool);
+        return code;
+    }
+
     bool isTestRun = false;
     char* testsFileSource = parseTestsArgs(&manager, &isTestRun);
     //printf("isTest : %d, TestSource : %s\n", isTestRun, testsFileSource);
     if (isTestRun) {
-        int code = runOnTests(testsFileSource);
+        int code = runOnTests(testsFileSource, pool, solver->solver);
         free(testsFileSource);
         testsFileSource = NULL;
 
-        destructLogger();
+        finishCaches();
+        destroyThreadPool(pool);
         return code;
     }
     free(testsFileSource);
     testsFileSource = NULL;
 
+    const char* binInputFile  = parseBinInputFile (&manager);
+    const char* binOutputFile = parseBinOutputFile(&manager);
+    if (binInputFile != NULL) {
+        int code = runColumnar(binInputFile, binOutputFile, outputFile, pool);
+        finishCaches();
+        destroyThreadPool(pool);
+        return code;
+    }
+
+    bool isBatchRun = false;
+    char* batchInputFile = parseBatchArgs(&manager, &isBatchRun);
+    if (isBatchRun) {
+        int code = runBatch(batchInputFile, outputFile, binOutputFile, pool);
+        free(batchInputFile);
+        batchInputFile = NULL;
+
+        finishCaches();
+        destroyThreadPool(pool);
+        return code;
+    }
+
+    // other modes solve only one equation
+    finishCaches();
+    destroyThreadPool(pool);
+    pool = NULL;
+
+    if (isExactModeNeeded(&manager))
+        return runExactMode(&manager);
+
     if (!parseUserInput(&manager, &equation))
         readEquation(&equation);
     quadraticEquationShowcase(&equation, outputFile);
 
-    destructLogger();
     return 0;
 }
 
@@ -97,31 +198,347 @@ void quadraticEquationShowcase(struct QuadraticEquation* equation, const char* o
     assert(equation != NULL);
 
     printEquation(equation);
-    // these two functions works only if it's quadratic equation (a != 0), otherwise error will occur
-    long double vertX = 0.0, vertY = 0.0, pointValue = 0.0;
-    getVertX(equation, &vertX);
-    printf("Coordinate X of top of parabola: %.10Lg\n", vertX);
-
-    getVertY(equation, &vertY);
-    printf("Coordinate Y of top of parabola: %.10Lg\n", vertY);
+    // equation is validated and discriminant is computed once for vertex and roots
+    QuadraticEquationAnalysis analysis = {};
+    if (analyzeEquation(equation, &analysis) != QUAD_EQ_ERRORS_OK)
+        return;
+
+    // vertex exists only if it's quadratic equation (a != 0)
+    if (analysis.isQuadratic) {
+        printf("Coordinate X of top of parabola: %.10Lg\n", analysis.vertX);
+        printf("Coordinate Y of top of parabola: %.10Lg\n", analysis.vertY);
+    } else {
+        printError("%s", getErrorMessage(QUAD_EQ_ERRORS_LINEAR_EQ));
+    }
 
+    long double pointValue = 0.0;
     getPointValue(equation, 5, &pointValue);
     printf("Value at point 5: %.10Lg\n", pointValue);
 
-    solveAndPrintEquation(equation, outputFile);
+    ResultWriter output = {};
+    if (openResultWriter(outputFile, &output) != QUAD_EQ_ERRORS_OK)
+        return;
+    printSolutions(&analysis.answer, equation->outputPrecision, &output);
+    closeResultWriter(&output);
 }
 
-int runOnTests(char* testsFileSource) {
+int runOnTests(char* testsFileSource, ThreadPool* pool, getSolutionsFuncPtr solver) {
+    assert(solver != NULL);
+
     // checking if solution works on custsom tests
     printf("Running on tests: \n");
 
     Tester tester = {}; // init
+    tester.pool = pool; // big tests file is parsed in parallel too
     validateTester(&tester, testsFileSource);
-
-    tester.GetSolutionsFunc = &getSolutions;
+    if (tester.tests == NULL)
+        return FAILED_ON_SOME_TEST;
+
+    // store misses go to cache, cache misses go to chosen solver
+    if (isSolutionsStoreOpened())
+        tester.GetSolutionsFunc = &getSolutionsStored;
+    else
+        tester.GetSolutionsFunc = isSolutionsCacheEnabled() ? &getSolutionsCached : solver;
     CheckOnTestsOutput result = checkOnTests(&tester);
     free(tester.membuffer);
     tester.membuffer = NULL;
 
     return result.state;
 }
+
+
+int runExactMode(const ArgsManager* manager) {
+    assert(manager != NULL);
+
+    IntegerQuadraticEquation equation = {};
+    if (!parseUserInputExact(manager, &equation))
+        return 1;
+
+    printf("Your equation is: %lld * x ^ 2 + (%lld) * x + (%lld)", equation.a, equation.b, equation.c);
+    if (equation.denominator != 1)
+        printf(", divided by %lld", equation.denominator);
+    printf("\n");
+
+    ExactQuadraticEquationAnswer answer = {};
+    if (getSolutionsExact(&equation, &answer) != QUAD_EQ_ERRORS_OK)
+        return 1;
+    printExactSolutions(&equation, &answer, DEFAULT_PRECISION);
+    return 0;
+}
+
+int runBatch(const char* inputFile, const char* outputFile, const char* binOutputFile, ThreadPool* pool) {
+    BatchModeStats stats = {};
+    if (binOutputFile != NULL) {
+        if (inputFile == NULL) {
+            printError("Error: binary output needs input file, stdin can't be used\n");
+            return 1;
+        }
+        if (isSameFile(inputFile, binOutputFile)) {
+            printError("Error: binary output can't be the same file as input\n");
+            return 1;
+        }
+
+        QuadEqErrors error = runBatchModeToColumnar(inputFile, binOutputFile, pool, &stats);
+        fprintf(stderr, "Batch: %zu records, %zu malformed\n", stats.numOfRecords, stats.numOfMalformed);
+        return error == QUAD_EQ_ERRORS_OK ? 0 : 1;
+    }
+
+    // output file is opened once for whole run
+    ResultWriter output = {};
+    if (openResultWriter(outputFile, &output) != QUAD_EQ_ERRORS_OK)
+        return 1;
+
+    // regular files are read through mmap, stdin is read as stream
+    QuadEqErrors error = inputFile == NULL ? runBatchMode(stdin, &output, DEFAULT_PRECISION, pool, &stats) :
+                                             runBatchModeOnFile(inputFile, &output, DEFAULT_PRECISION, pool, &stats);
+    QuadEqErrors closeError = closeResultWriter(&output);
+    fprintf(stderr, "Batch: %zu records, %zu malformed\n", stats.numOfRecords, stats.numOfMalformed);
+
+    return error == QUAD_EQ_ERRORS_OK && closeError == QUAD_EQ_ERRORS_OK ? 0 : 1;
+}
+
+int runColumnar(const char* binInputFile, const char* binOutputFile, const char* outputFile, ThreadPool* pool) {
+    assert(binInputFile != NULL);
+
+    // output is truncated, so mapped input would be lost
+    if (binOutputFile != NULL && isSameFile(binInputFile, binOutputFile)) {
+        printError("Error: binary output can't be the same file as binary input\n");
+        return 1;
+    }
+
+    ColumnarFile input = {};
+    if (openColumnarFile(binInputFile, false, &input) != QUAD_EQ_ERRORS_OK)
+        return 1;
+
+    // answers are written directly to mapping of output file (or to buffer, if they are printed as text)
+    ColumnarFile answers = {};
+    ColumnarPrecision precision = (ColumnarPrecision)input.header->precision;
+    size_t count = input.header->count;
+    QuadEqErrors error = binOutputFile != NULL ?
+        createColumnarFile(binOutputFile, precision, count, COLUMNAR_COEF_COLUMNS | COLUMNAR_ANSWER_COLUMNS, &answers) :
+        createColumnarBuffer(precision, count, COLUMNAR_ANSWER_COLUMNS, &answers);
+    if (error != QUAD_EQ_ERRORS_OK) {
+        closeColumnarFile(&input);
+        return 1;
+    }
+
+    if (binOutputFile != NULL)
+        error = copyColumnarCoefs(&input, &answers);
+    if (error == QUAD_EQ_ERRORS_OK)
+        error = solveColumnarFile(&input, &answers, pool);
+
+    if (error == QUAD_EQ_ERRORS_OK && binOutputFile == NULL) {
+        ResultWriter output = {};
+        error = openResultWriter(outputFile, &output);
+        if (error == QUAD_EQ_ERRORS_OK) {
+            error = printColumnarAnswers(&answers, &output, DEFAULT_PRECISION);
+            QuadEqErrors closeError = closeResultWriter(&output);
+            if (error == QUAD_EQ_ERRORS_OK)
+                error = closeError;
+        }
+    }
+
+    closeColumnarFile(&answers);
+    closeColumnarFile(&input);
+    return error == QUAD_EQ_ERRORS_OK ? 0 : 1;
+}
+
+ThreadPool* createPoolFromArgs(const ArgsManager* manager, bool* isOk) {
+    assert(manager != NULL);
+    assert(isOk != NULL);
+
+    size_t numOfThreads = 1;
+    *isOk = parseThreadsArg(manager, &numOfThreads);
+    // one thread doesn't need pool, everything is done in main thread
+    if (!*isOk || numOfThreads == 1)
+        return NULL;
+
+    ThreadPool* pool = NULL;
+    *isOk = createThreadPool(numOfThreads, &pool) == QUAD_EQ_ERRORS_OK;
+    return pool;
+}
+
+/// @brief mirrors order of modes in main(): only --accuracy and --test solve by implementation from registry
+bool isSolverUsedByMode(const ArgsManager* manager) {
+    assert(manager != NULL);
+
+    bool isRun = false;
+    free(parseAccuracyArgs(manager, &isRun));
+    if (isRun)
+        return true;
+    if (isGenerateNeeded(manager) || parseServeSocket(manager) != NULL || parseChannelName(manager) != NULL)
+        return false;
+
+    free(parseTestsArgs(manager, &isRun));
+    return isRun;
+}
+
+const SolverImplementation* createSolverFromArgs(const ArgsManager* manager, bool isUsed, bool* isOk) {
+    assert(manager != NULL);
+    assert(isOk != NULL);
+
+    *isOk = true;
+    const char* name = parseSolverName(manager);
+    // other modes have their own solvers, so choice would be silently ignored
+    if (name != NULL && !isUsed) {
+        printError("Error: --solver is used only by --test and --accuracy\n");
+        *isOk = false;
+        return NULL;
+    }
+    if (name == NULL)
+        name = SOLVER_DEFAULT_NAME;
+
+    if (strcmp(name, SOLVER_AUTO_NAME) != 0) {
+        const SolverImplementation* implementation = findSolver(name);
+        if (implementation != NULL)
+            return implementation;
+
+        printError("Error: unknown solver %s, possible solvers:\n", name);
+        printSolverNames(stderr);
+        *isOk = false;
+        return NULL;
+    }
+
+    // every implementation is checked and measured on the same generated corpus
+    CorpusGeneratorConfig config = {};
+    setDefaultCorpusConfig(&config);
+    TestsArena tests = {};
+    SolverCalibration results[SOLVER_REGISTRY_CAPACITY] = {};
+    const SolverImplementation* fastest = NULL;
+    *isOk = generateCorpusTests(&config, SOLVER_CALIBRATION_NUM_OF_TESTS, &tests) == QUAD_EQ_ERRORS_OK &&
+            calibrateSolvers(tests.tests, tests.count, results, &fastest) == QUAD_EQ_ERRORS_OK;
+    size_t numOfTests = tests.count;
+    freeTestsArena(&tests);
+    if (!*isOk)
+        return NULL;
+
+    // calibration goes to stderr, so it doesn't mix with results
+    fprintf(stderr, "Solver autotuning on %zu generated tests:\n", numOfTests);
+    printSolverCalibration(results, getNumOfSolvers(), fastest, stderr);
+    if (fastest == NULL) {
+        printError("Error: no solver passed calibration tests\n");
+        *isOk = false;
+        return NULL;
+    }
+    return fastest;
+}
+
+bool createCachesFromArgs(const ArgsManager* manager, const SolverImplementation* solver) {
+    assert(manager != NULL);
+    assert(solver != NULL);
+
+    size_t capacity = 0;
+    if (!parseCacheArg(manager, &capacity) || createSolutionsCache(capacity) != QUAD_EQ_ERRORS_OK)
+        return false;
+
+    // getSolutionsCached() works as solver, if cache is disabled
+    setSolutionsCacheSolver(solver->solver);
+    const char* storeFile = parseStoreFile(manager);
+    if (storeFile == NULL)
+        return true;
+
+    // answers in store are answers of solver, that filled it, so they are used only with the same solver
+    QuadEqErrors error = openSolutionsStore(storeFile, solver->name, &getSolutionsCached);
+    if (error == QUAD_EQ_ERRORS_ILLEGAL_ARG)
+        printError("Error: store %s was filled by other solver than %s, use the same --solver or other store\n",
+                   storeFile, solver->name);
+    if (error != QUAD_EQ_ERRORS_OK) {
+        destroySolutionsCache();
+        return false;
+    }
+    return true;
+}
+
+void finishCaches() {
+    // hit rate is printed to stderr, so it doesn't mix with results
+    if (isSolutionsStoreOpened())
+        printSolutionsStoreStats(stderr);
+    closeSolutionsStore();
+
+    if (isSolutionsCacheEnabled())
+        printSolutionsCacheStats(stderr);
+    destroySolutionsCache();
+}
+
+int runStoreCompaction(const char* storeFile) {
+    assert(storeFile != NULL);
+
+    size_t numOfEntries = 0;
+    if (compactSolutionsStore(storeFile, &numOfEntries) != QUAD_EQ_ERRORS_OK)
+        return 1;
+    fprintf(stderr, "Solutions store %s is compacted, %zu entries\n", storeFile, numOfEntries);
+    return 0;
+}
+
+int runChannelSolver(const char* channelName, ThreadPool* pool) {
+    assert(channelName != NULL);
+
+    SharedChannel channel = {};
+    if (createSharedChannel(channelName, SHARED_CHANNEL_DEFAULT_CAPACITY, &channel) != QUAD_EQ_ERRORS_OK)
+        return 1;
+    QuadEqErrors error = runSharedChannelSolver(&channel, pool);
+    closeSharedChannel(&channel);
+    return error == QUAD_EQ_ERRORS_OK ? 0 : 1;
+}
+
+int runGenerator(const ArgsManager* manager, const char* outputFile) {
+    assert(manager != NULL);
+
+    size_t numOfTests = 0;
+    CorpusGeneratorConfig config = {};
+    CorpusFormat format = CORPUS_FORMAT_TEXT;
+    if (!parseGenerateArgs(manager, &numOfTests, &config, &format))
+        return 1;
+
+    // corpus is streamed, so it can go to stdout (and to other program) too
+    ResultWriter output = {};
+    if (openResultWriter(outputFile, &output) != QUAD_EQ_ERRORS_OK)
+        return 1;
+    CorpusStats stats = {};
+    QuadEqErrors error = writeCorpus(&config, numOfTests, format, &output, &stats);
+    QuadEqErrors closeError = closeResultWriter(&output);
+    if (error != QUAD_EQ_ERRORS_OK || closeError != QUAD_EQ_ERRORS_OK)
+        return 1;
+
+    // statistics goes to stderr, so it doesn't mix with corpus
+    fprintf(stderr, "Generated %zu tests:", stats.numOfTests);
+    for (int kind = 0; kind < CORPUS_NUM_OF_KINDS; ++kind)
+        fprintf(stderr, " %s %zu", CORPUS_KIND_NAMES[kind], stats.numOfKind[kind]);
+    fprintf(stderr, "\n");
+    return 0;
+}
+
+int runAccuracy(const ArgsManager* manager, getSolutionsFuncPtr solver) {
+    assert(manager != NULL);
+    assert(solver != NULL);
+
+    AccuracyGate gate = getDefaultAccuracyGate();
+    if (!parseMaxUlpArg(manager, &gate.maxUlp))
+        return 1;
+
+    bool isAccuracyRun = false;
+    char* testsFile = parseAccuracyArgs(manager, &isAccuracyRun);
+    TestsArena tests = {};
+    QuadEqErrors error = QUAD_EQ_ERRORS_OK;
+    if (testsFile != NULL) {
+        error = loadTestsFile(testsFile, NULL, &tests);
+        free(testsFile);
+    } else {
+        size_t numOfTests = 0;
+        CorpusGeneratorConfig config = {};
+        CorpusFormat format = CORPUS_FORMAT_TEXT;
+        if (!parseGenerateArgs(manager, &numOfTests, &config, &format))
+            return 1;
+        error = generateCorpusTests(&config, numOfTests != 0 ? numOfTests : ACCURACY_DEFAULT_NUM_OF_TESTS, &tests);
+    }
+
+    AccuracyReport report = {};
+    if (error == QUAD_EQ_ERRORS_OK)
+        error = runAccuracyHarness(solver, tests.tests, tests.count, getDefaultAccuracyReference(), gate, &report);
+    freeTestsArena(&tests);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return 1;
+
+    printAccuracyReport(&report, stdout);
+    return report.isPassed ? 0 : 1;
+}
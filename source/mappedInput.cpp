@@ -0,0 +1,174 @@
+/**
+    \file
+    \brief realization of mmap reader and fast number parser
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <charconv>
+
+#include "../include/mappedInput.hpp"
+#include "../include/errorReporting.hpp"
+
+QuadEqErrors openMappedInput(const char* fileName, struct MappedInput* input) {
+    ///\throw fileName should not be NULL
+    ///\throw input should not be NULL
+    assert(fileName != NULL);
+    assert(input != NULL);
+
+    if (fileName == NULL || input == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    *input = {};
+    input->fd = open(fileName, O_RDONLY);
+    if (input->fd == -1)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+
+    struct stat fileInfo = {};
+    // pipes and terminals can't be mapped, caller should read them as stream
+    if (fstat(input->fd, &fileInfo) == -1 || !S_ISREG(fileInfo.st_mode)) {
+        close(input->fd);
+        input->fd = -1;
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+
+    input->fileSize = (size_t)fileInfo.st_size;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors closeMappedInput(struct MappedInput* input) {
+    ///\throw input should not be NULL
+    assert(input != NULL);
+
+    if (input == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (input->window != NULL)
+        munmap((void*)input->window, input->windowSize);
+    if (input->fd != -1)
+        close(input->fd);
+    *input = {};
+    input->fd = -1;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief maps part of file, that starts at position (rounded down to page size) and has at least minSize bytes
+static QuadEqErrors mapWindow(struct MappedInput* input, size_t minSize) {
+    assert(input != NULL);
+
+    static const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+
+    if (input->window != NULL)
+        munmap((void*)input->window, input->windowSize);
+    input->window = NULL;
+
+    size_t offset = input->position - input->position % pageSize;
+    size_t size   = MAPPED_INPUT_WINDOW_SIZE;
+    // line is longer than window, so window grows
+    while (size < minSize + (input->position - offset))
+        size *= 2;
+    if (size > input->fileSize - offset)
+        size = input->fileSize - offset;
+
+    void* window = mmap(NULL, size, PROT_READ, MAP_PRIVATE, input->fd, (off_t)offset);
+    if (window == MAP_FAILED)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    madvise(window, size, MADV_SEQUENTIAL);
+
+    input->window       = (const char*)window;
+    input->windowOffset = offset;
+    input->windowSize   = size;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors readMappedLine(struct MappedInput* input, const char** lineBegin, const char** lineEnd, bool* isEnd) {
+    ///\throw input should not be NULL
+    ///\throw lineBegin should not be NULL
+    ///\throw lineEnd should not be NULL
+    ///\throw isEnd should not be NULL
+    assert(input != NULL);
+    assert(lineBegin != NULL);
+    assert(lineEnd != NULL);
+    assert(isEnd != NULL);
+
+    if (input == NULL || lineBegin == NULL || lineEnd == NULL || isEnd == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (input->position >= input->fileSize) {
+        *isEnd = true;
+        return QUAD_EQ_ERRORS_OK;
+    }
+    *isEnd = false;
+
+    size_t minSize = 0;
+    while (true) {
+        size_t windowEnd = input->windowOffset + input->windowSize;
+        if (input->window == NULL || input->position >= windowEnd) {
+            QuadEqErrors error = mapWindow(input, minSize);
+            if (error != QUAD_EQ_ERRORS_OK)
+                return error;
+            windowEnd = input->windowOffset + input->windowSize;
+        }
+
+        const char* begin = input->window + (input->position - input->windowOffset);
+        const char* end   = input->window + input->windowSize;
+        const char* newLine = (const char*)memchr(begin, '\n', (size_t)(end - begin));
+        if (newLine != NULL) {
+            *lineBegin = begin;
+            *lineEnd   = newLine;
+            input->position += (size_t)(newLine - begin) + 1;
+            return QUAD_EQ_ERRORS_OK;
+        }
+
+        // last line of file without '\n'
+        if (windowEnd == input->fileSize) {
+            *lineBegin = begin;
+            *lineEnd   = end;
+            input->position = input->fileSize;
+            return QUAD_EQ_ERRORS_OK;
+        }
+
+        // line is cut by end of window, so window slides to the beginning of line
+        minSize = 2 * (size_t)(end - begin);
+        QuadEqErrors error = mapWindow(input, minSize);
+        if (error != QUAD_EQ_ERRORS_OK)
+            return error;
+    }
+}
+
+QuadEqErrors parseNumberFast(const char* begin, const char* end, long double* coef, bool* result) {
+    ///\throw begin should not be NULL
+    ///\throw end should not be NULL
+    ///\throw coef should not be NULL
+    ///\throw result should not be NULL
+    assert(begin != NULL);
+    assert(end != NULL);
+    assert(coef != NULL);
+    assert(result != NULL);
+
+    if (begin == NULL || end == NULL || coef == NULL || result == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // from_chars doesn't accept plus sign, but strtod() did
+    if (begin < end && *begin == '+') {
+        ++begin;
+        if (begin < end && *begin == '-') {
+            *result = false;
+            return QUAD_EQ_ERRORS_OK;
+        }
+    }
+
+    double number = 0;
+    std::from_chars_result parsed = std::from_chars(begin, end, number);
+    // from_chars accepts "nan", "inf" and "infinity", but they are not coefficients
+    *result = begin < end && parsed.ec == std::errc() && parsed.ptr == end && isfinite(number);
+    if (*result)
+        *coef = number;
+    return QUAD_EQ_ERRORS_OK;
+}
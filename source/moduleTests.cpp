@@ -0,0 +1,1092 @@
+/**
+    \file
+    \brief realization of behaviour tests of modules, every test checks one module
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <thread>
+
+#include "../include/moduleTests.hpp"
+#include "../include/quadraticEquation.hpp"
+#include "../include/solutionsStore.hpp"
+#include "../include/solutionsCache.hpp"
+#include "../include/columnarFormat.hpp"
+#include "../include/quadSolver.h"
+#include "../include/testsLoader.hpp"
+#include "../include/batchMode.hpp"
+#include "../include/resultWriter.hpp"
+#include "../include/errorReporting.hpp"
+#include "../include/solverRegistry.hpp"
+#include "../include/mappedInput.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/quadraticEquationSimd.hpp"
+#include "../include/adaptiveSolver.hpp"
+#include "../include/exactSolver.hpp"
+#include "../include/solverServer.hpp"
+#include "../include/parabolaTabulation.hpp"
+#include "../include/sharedChannel.hpp"
+#include "../include/equationAnalysis.hpp"
+#include "../include/asyncLogger.hpp"
+#include "../include/corpusGenerator.hpp"
+#include "../include/accuracyHarness.hpp"
+
+/// @brief roots, that passed through text or double, are compared with this tolerance
+const long double MODULE_TESTS_ROOT_TOLERANCE = 1e-9L;
+/// @brief number of digits of roots in batch output, it's enough to print small integer roots exactly
+const int         MODULE_TESTS_PRECISION      = 6;
+const size_t      MODULE_TESTS_MAX_PATH_LEN   = 128;
+const size_t      MODULE_TESTS_MAX_TEXT_LEN   = 256;
+/// @brief how long server test waits for socket of server (in milliseconds)
+const int         MODULE_TESTS_MAX_CONNECT_ATTEMPTS = 1000;
+
+/// @brief number of failed checks of all tests
+static int numOfFailedChecks = 0;
+
+/// check does not stop test, so temporary files and global state are cleaned up even after failure
+#define MODULE_TEST_CHECK(CONDITION)                                                            \
+    do {                                                                                        \
+        if (!(CONDITION)) {                                                                     \
+            printf("Module check failed: %s (%s:%d)\n", #CONDITION, __FUNCTION__, __LINE__);    \
+            ++numOfFailedChecks;                                                                \
+        }                                                                                       \
+    } while(0)
+
+// ---------------------------------   HELPERS   -----------------------------------------
+
+static bool isSameRoot(long double first, long double second) {
+    return fabsl(first - second) <= MODULE_TESTS_ROOT_TOLERANCE;
+}
+
+/// @brief compares number of solutions and roots, that are meaningful for this number
+static bool isSameAnswer(const QuadraticEquationAnswer* first, const QuadraticEquationAnswer* second) {
+    ///\throw first should not be NULL
+    ///\throw second should not be NULL
+    assert(first != NULL);
+    assert(second != NULL);
+
+    if (first->numOfSols != second->numOfSols)
+        return false;
+    if (first->numOfSols == ONE_ROOT)
+        return isSameRoot(first->root_1, second->root_1);
+    if (first->numOfSols == TWO_ROOTS)
+        return isSameRoot(first->root_1, second->root_1) && isSameRoot(first->root_2, second->root_2);
+    return true;
+}
+
+static QuadraticEquationAnswer solveDirectly(long double a, long double b, long double c) {
+    QuadraticEquation eq = {a, b, c, 0};
+    QuadraticEquationAnswer answer = {};
+    getSolutions(&eq, &answer);
+    return answer;
+}
+
+/// @brief solver, that counts it's calls, so tests know, when cache or store called solver
+static size_t numOfCountedCalls = 0;
+
+static QuadEqErrors getSolutionsCounted(const QuadraticEquation* eq, QuadraticEquationAnswer* answer) {
+    ++numOfCountedCalls;
+    return getSolutions(eq, answer);
+}
+
+/// @brief writes text to file without any additions (for example trailing '\\n')
+static bool writeTextFile(const char* fileName, const char* text) {
+    ///\throw fileName should not be NULL
+    ///\throw text should not be NULL
+    assert(fileName != NULL);
+    assert(text != NULL);
+
+    FILE* file = fopen(fileName, "w");
+    if (file == NULL)
+        return false;
+    size_t len = strlen(text);
+    bool isWritten = fwrite(text, 1, len, file) == len;
+    return fclose(file) == 0 && isWritten;
+}
+
+/// @brief sink, that remembers input errors, so tests can check, that malformed records were reported
+struct InputErrorsCounter {
+    int          numOfErrors;
+    int          firstLine;
+    QuadEqErrors firstError;
+    int          lastLine;
+};
+
+static void countInputErrorsSink(QuadEqErrors error, const char* file, const char* function, int line, void* userData) {
+    (void)file;
+    InputErrorsCounter* counter = (InputErrorsCounter*)userData;
+    if (function != NULL)
+        return;
+    if (counter->numOfErrors++ == 0) {
+        counter->firstLine  = line;
+        counter->firstError = error;
+    }
+    counter->lastLine = line;
+}
+
+// ---------------------------------   TESTS   -----------------------------------------
+
+/// @brief solves equations through store, then checks, that reopened and compacted file gives the same answers
+static void testSolutionsStore(const char* directory) {
+    char storeFile[MODULE_TESTS_MAX_PATH_LEN] = {};
+    snprintf(storeFile, sizeof(storeFile), "%s/store.bin", directory);
+
+    const QuadraticEquation equations[] = {{1, -3, 2, 0}, {2, 0, -8, 0}, {1, 0, 1, 0}, {0, 5, -10, 0}};
+    const size_t numOfEquations = sizeof(equations) / sizeof(*equations);
+
+    numOfCountedCalls = 0;
+    MODULE_TEST_CHECK(openSolutionsStore(storeFile, "counted", &getSolutionsCounted) == QUAD_EQ_ERRORS_OK);
+    resetSolutionsStoreStats();
+    for (size_t i = 0; i < numOfEquations; ++i) {
+        QuadraticEquationAnswer answer = {};
+        MODULE_TEST_CHECK(getSolutionsStored(&equations[i], &answer) == QUAD_EQ_ERRORS_OK);
+    }
+    SolutionsStoreStats stats = getSolutionsStoreStats();
+    MODULE_TEST_CHECK(stats.numOfMisses   == numOfEquations);
+    MODULE_TEST_CHECK(stats.numOfAppended == numOfEquations);
+    closeSolutionsStore();
+
+    size_t numOfEntries = 0;
+    MODULE_TEST_CHECK(compactSolutionsStore(storeFile, &numOfEntries) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(numOfEntries == numOfEquations);
+
+    // answers of reopened (and compacted) file are taken from file, solver is not called
+    numOfCountedCalls = 0;
+    MODULE_TEST_CHECK(openSolutionsStore(storeFile, "counted", &getSolutionsCounted) == QUAD_EQ_ERRORS_OK);
+    resetSolutionsStoreStats();
+    for (size_t i = 0; i < numOfEquations; ++i) {
+        QuadraticEquationAnswer stored = {};
+        MODULE_TEST_CHECK(getSolutionsStored(&equations[i], &stored) == QUAD_EQ_ERRORS_OK);
+        QuadraticEquationAnswer expected = solveDirectly(equations[i].a, equations[i].b, equations[i].c);
+        MODULE_TEST_CHECK(isSameAnswer(&stored, &expected));
+    }
+    MODULE_TEST_CHECK(getSolutionsStoreStats().numOfHits == numOfEquations);
+    MODULE_TEST_CHECK(numOfCountedCalls == 0);
+    closeSolutionsStore();
+
+    // answers of one solver are not returned as answers of other one
+    MODULE_TEST_CHECK(openSolutionsStore(storeFile, "long-double", &getSolutions) == QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    MODULE_TEST_CHECK(!isSolutionsStoreOpened());
+
+    unlink(storeFile);
+}
+
+/// @brief proportional equations with the same scale are taken from cache, misses and uncached go to chosen solver
+static void testSolutionsCache() {
+    MODULE_TEST_CHECK(createSolutionsCache(64) == QUAD_EQ_ERRORS_OK);
+    setSolutionsCacheSolver(&getSolutionsCounted);
+    resetSolutionsCacheStats();
+    numOfCountedCalls = 0;
+
+    //                                       a    b     c
+    const QuadraticEquation equations[] = {{1,   -3,    2,  0},  // miss
+                                           {1.5, -4.5,  3,  0},  // hit: same key and same exponent of a
+                                           {0,    2,   -4,  0},  // miss
+                                           {0,    4,   -8,  0},  // hit: linear key is c / b
+                                           {1,   -2,    1,  0},  // uncached: discriminant is 0
+                                           {2,   -6,    4,  0}}; // miss: same key, but other exponent of a
+    const size_t numOfEquations = sizeof(equations) / sizeof(*equations);
+
+    for (size_t i = 0; i < numOfEquations; ++i) {
+        QuadraticEquationAnswer cached = {};
+        MODULE_TEST_CHECK(getSolutionsCached(&equations[i], &cached) == QUAD_EQ_ERRORS_OK);
+        QuadraticEquationAnswer expected = solveDirectly(equations[i].a, equations[i].b, equations[i].c);
+        MODULE_TEST_CHECK(isSameAnswer(&cached, &expected));
+    }
+
+    SolutionsCacheStats stats = getSolutionsCacheStats();
+    MODULE_TEST_CHECK(stats.numOfHits     == 2);
+    MODULE_TEST_CHECK(stats.numOfMisses   == 3);
+    MODULE_TEST_CHECK(stats.numOfUncached == 1);
+    MODULE_TEST_CHECK(numOfCountedCalls   == 4);
+
+    destroySolutionsCache();
+    setSolutionsCacheSolver(NULL);
+}
+
+/// @brief answers, written into mapped columnar file, are read back after reopening
+static void testColumnarFormat(const char* directory) {
+    char columnarFile[MODULE_TESTS_MAX_PATH_LEN] = {};
+    snprintf(columnarFile, sizeof(columnarFile), "%s/equations.col", directory);
+
+    const long double a[] = {1, 0, 1,  0};
+    const long double b[] = {-3, 2, 0, 0};
+    const long double c[] = {2, -4, 1, 0};
+    const size_t count = sizeof(a) / sizeof(*a);
+
+    ColumnarFile file = {};
+    MODULE_TEST_CHECK(createColumnarFile(columnarFile, COLUMNAR_PRECISION_F80, count,
+                                         COLUMNAR_COEF_COLUMNS | COLUMNAR_ANSWER_COLUMNS, &file) == QUAD_EQ_ERRORS_OK);
+    if (file.mapping != NULL) {
+        memcpy(getColumnarColumn(&file, COLUMNAR_COLUMN_A), a, sizeof(a));
+        memcpy(getColumnarColumn(&file, COLUMNAR_COLUMN_B), b, sizeof(b));
+        memcpy(getColumnarColumn(&file, COLUMNAR_COLUMN_C), c, sizeof(c));
+        MODULE_TEST_CHECK(solveColumnarFile(&file, &file, NULL) == QUAD_EQ_ERRORS_OK);
+        closeColumnarFile(&file);
+    }
+
+    MODULE_TEST_CHECK(isSameFile(columnarFile, columnarFile));
+    MODULE_TEST_CHECK(openColumnarFile(columnarFile, false, &file) == QUAD_EQ_ERRORS_OK);
+    if (file.mapping != NULL) {
+        MODULE_TEST_CHECK(file.header->count     == count);
+        MODULE_TEST_CHECK(file.header->precision == COLUMNAR_PRECISION_F80);
+
+        const long double*     root_1    = (const long double*)    getColumnarColumn(&file, COLUMNAR_COLUMN_ROOT_1);
+        const long double*     root_2    = (const long double*)    getColumnarColumn(&file, COLUMNAR_COLUMN_ROOT_2);
+        const QuadEqRootState* numOfSols = (const QuadEqRootState*)getColumnarColumn(&file, COLUMNAR_COLUMN_NUM_OF_SOLS);
+        for (size_t i = 0; i < count; ++i) {
+            QuadraticEquationAnswer stored   = {root_1[i], root_2[i], numOfSols[i]};
+            QuadraticEquationAnswer expected = solveDirectly(a[i], b[i], c[i]);
+            MODULE_TEST_CHECK(isSameAnswer(&stored, &expected));
+        }
+        closeColumnarFile(&file);
+    }
+
+    unlink(columnarFile);
+}
+
+/// @brief functions of C ABI give the same answers as C++ API and reject the same coefficients
+static void testCAbi() {
+    MODULE_TEST_CHECK(qsGetVersion() == QUAD_SOLVER_VERSION);
+    MODULE_TEST_CHECK(qsGetErrorMessage(QS_ERROR_VALUE_IS_TOO_BIG) != NULL);
+
+    const double a[] = {1, 0, 1, 0, 1};
+    const double b[] = {-3, 2, 0, 0, -4};
+    const double c[] = {2, -4, 1, 0, 4};
+    const size_t count = sizeof(a) / sizeof(*a);
+
+    double root_1[count]    = {};
+    double root_2[count]    = {};
+    int    numOfSols[count] = {};
+    MODULE_TEST_CHECK(qsGetSolutionsArrayDouble(count, a, b, c, root_1, root_2, numOfSols) == QS_ERROR_OK);
+
+    for (size_t i = 0; i < count; ++i) {
+        QsEquation eq = {a[i], b[i], c[i]};
+        QsAnswer answer = {};
+        MODULE_TEST_CHECK(qsGetSolutions(&eq, &answer) == QS_ERROR_OK);
+
+        QuadraticEquationAnswer expected  = solveDirectly(a[i], b[i], c[i]);
+        QuadraticEquationAnswer fromAbi   = {answer.root_1, answer.root_2, (QuadEqRootState)answer.numOfSols};
+        QuadraticEquationAnswer fromArray = {root_1[i], root_2[i], (QuadEqRootState)numOfSols[i]};
+        MODULE_TEST_CHECK(isSameAnswer(&fromAbi,   &expected));
+        MODULE_TEST_CHECK(isSameAnswer(&fromArray, &expected));
+    }
+
+    QsEquation eq = {1, -3, 2};
+    long double disc = 0;
+    MODULE_TEST_CHECK(qsGetDiscriminant(&eq, &disc) == QS_ERROR_OK);
+    MODULE_TEST_CHECK(isSameRoot(disc, 1));
+
+    QsEquation tooBig = {1e19L, 1, 1};
+    QsAnswer answer = {};
+    MODULE_TEST_CHECK(qsGetSolutions(&tooBig, &answer)  == QS_ERROR_VALUE_IS_TOO_BIG);
+    MODULE_TEST_CHECK(qsGetDiscriminant(&tooBig, &disc) == QS_ERROR_VALUE_IS_TOO_BIG);
+}
+
+/// @brief checks tests, parsed from TESTS_LOADER_TEXT
+static void checkLoadedTests(const TestsArena* arena) {
+    const Test expected[] = {{{1, -3,  2, 0}, {1, 2, TWO_ROOTS}},
+                             {{0,  0,  0, 0}, {0, 0, INFINITE_ROOTS}},
+                             {{1,  0,  1, 0}, {0, 0, NO_ROOTS}},
+                             {{0,  2, -4, 0}, {2, 2, ONE_ROOT}}};
+    const size_t numOfTests = sizeof(expected) / sizeof(*expected);
+
+    MODULE_TEST_CHECK(arena->count == numOfTests);
+    for (size_t i = 0; i < numOfTests && i < arena->count; ++i) {
+        const QuadraticEquation* eq = &arena->tests[i].equation;
+        MODULE_TEST_CHECK(isSameRoot(eq->a, expected[i].equation.a) && isSameRoot(eq->b, expected[i].equation.b) &&
+                          isSameRoot(eq->c, expected[i].equation.c));
+        MODULE_TEST_CHECK(isSameAnswer(&arena->tests[i].answer, &expected[i].answer));
+    }
+}
+
+/// @brief last line has no '\\n', loader should accept it as fgets() did
+const char* const TESTS_LOADER_TEXT = "1\n-3\n2\n1\n2\n#\n"
+                                      "0\n0\n0\ninf\n#\n"
+                                      "1\n0\n1\n#\n"
+                                      "0\n2\n-4\n2\n#";
+
+/// @brief tests text is parsed from memory and from file without trailing newline
+static void testTestsLoader(const char* directory) {
+    TestsArena arena = {};
+    MODULE_TEST_CHECK(parseTestsText(TESTS_LOADER_TEXT, TESTS_LOADER_TEXT + strlen(TESTS_LOADER_TEXT), &arena) ==
+                      QUAD_EQ_ERRORS_OK);
+    checkLoadedTests(&arena);
+    freeTestsArena(&arena);
+
+    char testsFile[MODULE_TESTS_MAX_PATH_LEN] = {};
+    snprintf(testsFile, sizeof(testsFile), "%s/tests.txt", directory);
+    MODULE_TEST_CHECK(writeTextFile(testsFile, TESTS_LOADER_TEXT));
+
+    arena = {};
+    MODULE_TEST_CHECK(loadTestsFile(testsFile, NULL, &arena) == QUAD_EQ_ERRORS_OK);
+    checkLoadedTests(&arena);
+    freeTestsArena(&arena);
+
+    unlink(testsFile);
+}
+
+/// @brief records of batch: blank line is skipped, malformed ones give "error", last line has no '\\n'
+const char* const BATCH_INPUT_TEXT     = "1 -3 2\n"
+                                         "0 0 1\n"
+                                         "1 x 2\n"
+                                         "\n"
+                                         "0,0,0\n"
+                                         "nan 1 1\n"
+                                         "1 -2 1";
+const char* const BATCH_EXPECTED_TEXT  = "2 1 2\n"
+                                         "0\n"
+                                         "error\n"
+                                         "inf\n"
+                                         "error\n"
+                                         "1 1\n";
+/// @brief lines of malformed records in BATCH_INPUT_TEXT
+const int         BATCH_MALFORMED_LINE = 3;
+const int         BATCH_NAN_LINE       = 6;
+
+/// @brief batch results are printed in order of records, malformed record is reported and skipped by columnar output
+static void testBatchMode(const char* directory) {
+    char inputFile   [MODULE_TESTS_MAX_PATH_LEN] = {};
+    char columnarFile[MODULE_TESTS_MAX_PATH_LEN] = {};
+    snprintf(inputFile,    sizeof(inputFile),    "%s/batch.txt", directory);
+    snprintf(columnarFile, sizeof(columnarFile), "%s/batch.col", directory);
+    MODULE_TEST_CHECK(writeTextFile(inputFile, BATCH_INPUT_TEXT));
+
+    QuadEqErrorSink previousSink = NULL;
+    void* previousUserData = NULL;
+    getErrorSink(&previousSink, &previousUserData);
+    InputErrorsCounter counter = {};
+    setErrorSink(countInputErrorsSink, &counter);
+
+    FILE* outputStream = tmpfile();
+    MODULE_TEST_CHECK(outputStream != NULL);
+    if (outputStream != NULL) {
+        ResultWriter output = {};
+        BatchModeStats stats = {};
+        MODULE_TEST_CHECK(openResultWriterOnStream(outputStream, &output) == QUAD_EQ_ERRORS_OK);
+        MODULE_TEST_CHECK(runBatchModeOnFile(inputFile, &output, MODULE_TESTS_PRECISION, NULL, &stats) ==
+                          QUAD_EQ_ERRORS_OK);
+        MODULE_TEST_CHECK(closeResultWriter(&output) == QUAD_EQ_ERRORS_OK);
+        MODULE_TEST_CHECK(stats.numOfRecords   == 6);
+        MODULE_TEST_CHECK(stats.numOfMalformed == 2);
+
+        char text[MODULE_TESTS_MAX_TEXT_LEN] = {};
+        rewind(outputStream);
+        size_t len = fread(text, 1, sizeof(text) - 1, outputStream);
+        text[len] = '\0';
+        MODULE_TEST_CHECK(strcmp(text, BATCH_EXPECTED_TEXT) == 0);
+        fclose(outputStream);
+    }
+
+#if QUAD_EQ_LOG_LEVEL >= QUAD_EQ_LOG_LEVEL_ERROR
+    MODULE_TEST_CHECK(counter.numOfErrors == 2);
+    MODULE_TEST_CHECK(counter.firstLine   == BATCH_MALFORMED_LINE);
+    MODULE_TEST_CHECK(counter.firstError  == QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT);
+    MODULE_TEST_CHECK(counter.lastLine    == BATCH_NAN_LINE);
+#endif
+
+    // the same records through columnar file: only well-formed records are stored
+    BatchModeStats stats = {};
+    MODULE_TEST_CHECK(runBatchModeToColumnar(inputFile, columnarFile, NULL, &stats) == QUAD_EQ_ERRORS_OK);
+    ColumnarFile file = {};
+    MODULE_TEST_CHECK(openColumnarFile(columnarFile, false, &file) == QUAD_EQ_ERRORS_OK);
+    if (file.mapping != NULL) {
+        MODULE_TEST_CHECK(file.header->count == 4);
+        const double*          a         = (const double*)         getColumnarColumn(&file, COLUMNAR_COLUMN_A);
+        const double*          b         = (const double*)         getColumnarColumn(&file, COLUMNAR_COLUMN_B);
+        const double*          c         = (const double*)         getColumnarColumn(&file, COLUMNAR_COLUMN_C);
+        const double*          root_1    = (const double*)         getColumnarColumn(&file, COLUMNAR_COLUMN_ROOT_1);
+        const double*          root_2    = (const double*)         getColumnarColumn(&file, COLUMNAR_COLUMN_ROOT_2);
+        const QuadEqRootState* numOfSols = (const QuadEqRootState*)getColumnarColumn(&file, COLUMNAR_COLUMN_NUM_OF_SOLS);
+        for (size_t i = 0; i < file.header->count; ++i) {
+            QuadraticEquationAnswer stored   = {root_1[i], root_2[i], numOfSols[i]};
+            QuadraticEquationAnswer expected = solveDirectly(a[i], b[i], c[i]);
+            MODULE_TEST_CHECK(isSameAnswer(&stored, &expected));
+        }
+        closeColumnarFile(&file);
+    }
+
+    // output can't truncate mapped input
+    MODULE_TEST_CHECK(runBatchModeToColumnar(inputFile, inputFile, NULL, &stats) == QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    setErrorSink(previousSink, previousUserData);
+
+    unlink(inputFile);
+    unlink(columnarFile);
+}
+
+/// @brief every built-in implementation passes myTests, registration rejects taken names
+static void testSolverRegistry() {
+    Tester tester = {};
+    const Test* tests = getMyTests(&tester);
+    tester.tests   = tests;
+    tester.isQuiet = true;
+
+    const char* const builtinNames[] = {"long-double", "double", "branch-free", "adaptive"};
+    for (size_t i = 0; i < sizeof(builtinNames) / sizeof(*builtinNames); ++i) {
+        const SolverImplementation* implementation = findSolver(builtinNames[i]);
+        MODULE_TEST_CHECK(implementation != NULL);
+        if (implementation == NULL)
+            continue;
+
+        tester.GetSolutionsFunc = implementation->solver;
+        MODULE_TEST_CHECK(checkOnTests(&tester).state == ALL_TESTS_PASSED);
+    }
+    MODULE_TEST_CHECK(findSolver("no-such-solver") == NULL);
+
+    size_t numOfSolvers = getNumOfSolvers();
+    MODULE_TEST_CHECK(registerSolver("double",         "", &getSolutionsCounted) == QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    MODULE_TEST_CHECK(registerSolver(SOLVER_AUTO_NAME, "", &getSolutionsCounted) == QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    MODULE_TEST_CHECK(registerSolver("counted", "getSolutions() with counter", &getSolutionsCounted) ==
+                      QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(getNumOfSolvers() == numOfSolvers + 1);
+
+    const SolverImplementation* counted = findSolver("counted");
+    MODULE_TEST_CHECK(counted != NULL && counted->solver == &getSolutionsCounted);
+    MODULE_TEST_CHECK(getSolverImplementation(numOfSolvers) == counted);
+
+    SolverCalibration results[SOLVER_REGISTRY_CAPACITY] = {};
+    const SolverImplementation* fastest = NULL;
+    MODULE_TEST_CHECK(calibrateSolvers(tests, (size_t)tester.cntOfTests, results, &fastest) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(fastest != NULL);
+    for (size_t i = 0; i < getNumOfSolvers(); ++i)
+        if (results[i].implementation == fastest)
+            MODULE_TEST_CHECK(results[i].isPassed);
+}
+
+/// @brief parser accepts finite numbers only, non-finite values can't pass magnitude checks of callers
+static void testNumberParser() {
+    const char* const correct[]   = {"1.5", "+2", "-0.25", "1e18"};
+    const char* const incorrect[] = {"nan", "inf", "-infinity", "1e400", "+-1", "1x", ""};
+
+    for (size_t i = 0; i < sizeof(correct) / sizeof(*correct); ++i) {
+        long double number = 0;
+        bool isOk = false;
+        parseNumberFast(correct[i], correct[i] + strlen(correct[i]), &number, &isOk);
+        MODULE_TEST_CHECK(isOk && isSameRoot(number, strtold(correct[i], NULL)));
+    }
+    for (size_t i = 0; i < sizeof(incorrect) / sizeof(*incorrect); ++i) {
+        long double number = 0;
+        bool isOk = true;
+        parseNumberFast(incorrect[i], incorrect[i] + strlen(incorrect[i]), &number, &isOk);
+        MODULE_TEST_CHECK(!isOk);
+    }
+}
+
+/// @brief float root is compared with relative tolerance, it has only ~7 significant digits
+static bool isSameFloatRoot(float root, long double expected, long double tolerance) {
+    return fabsl((long double)root - expected) <= tolerance * fmaxl(1, fabsl(expected));
+}
+
+/// @brief float solver core classifies equations as long double one, even if coefficients are big
+static void testFloatSolver() {
+    // coefficients are small integers multiplied by power of 2, so they and discriminant are exact in float
+    const int exponents[] = {0, 30, 50};
+    for (size_t e = 0; e < sizeof(exponents) / sizeof(*exponents); ++e)
+        for (int a = 1; a <= 3; ++a)
+            for (int b = -6; b <= 6; ++b)
+                for (int c = -6; c <= 6; ++c) {
+                    long double scale = ldexpl(1, exponents[e]);
+                    QuadraticEquationAnswer expected = solveDirectly(a * scale, b * scale, c * scale);
+
+                    float root_1 = 0, root_2 = 0;
+                    QuadEqRootState numOfSols = NO_ROOTS;
+                    solveValidatedEquationT<float>((float)(a * scale), (float)(b * scale), (float)(c * scale),
+                                                   &root_1, &root_2, &numOfSols);
+                    MODULE_TEST_CHECK(numOfSols == expected.numOfSols);
+                    if (numOfSols == expected.numOfSols && numOfSols != NO_ROOTS)
+                        MODULE_TEST_CHECK(isSameFloatRoot(root_1, expected.root_1, 1e-5L) &&
+                                          isSameFloatRoot(root_2, expected.root_2, 1e-5L));
+                }
+
+    // (3x - 1) ^ 2: discriminant of big float coefficients is rounding noise, much bigger than EPSILON,
+    // root of multiplicity 2 is ill-conditioned, so it's precision is only ~sqrt(FLT_EPSILON)
+    for (int exponent = 0; exponent <= 15; exponent += 3) {
+        long double scale = powl(10, exponent);
+        QuadraticEquationAnswer expected = solveDirectly(9 * scale, -6 * scale, scale);
+
+        float root_1 = 0, root_2 = 0;
+        QuadEqRootState numOfSols = NO_ROOTS;
+        solveValidatedEquationT<float>((float)(9 * scale), (float)(-6 * scale), (float)scale,
+                                       &root_1, &root_2, &numOfSols);
+        MODULE_TEST_CHECK(expected.numOfSols == ONE_ROOT && numOfSols == ONE_ROOT);
+        MODULE_TEST_CHECK(isSameFloatRoot(root_1, expected.root_1, 1e-3L));
+    }
+}
+
+/// @brief vectorized solver on every supported instruction set gives the same answers as getSolutions()
+static void testSimdSolver() {
+    // grid is not multiple of vector width, so tail of batch is checked too
+    const int MAX_COEF = 4;
+    const size_t NUM_OF_EQUATIONS = (2 * MAX_COEF + 1) * (2 * MAX_COEF + 1) * (2 * MAX_COEF + 1);
+    double a[NUM_OF_EQUATIONS] = {}, b[NUM_OF_EQUATIONS] = {}, c[NUM_OF_EQUATIONS] = {};
+    size_t count = 0;
+    for (int ai = -MAX_COEF; ai <= MAX_COEF; ++ai)
+        for (int bi = -MAX_COEF; bi <= MAX_COEF; ++bi)
+            for (int ci = -MAX_COEF; ci <= MAX_COEF; ++ci, ++count) {
+                a[count] = ai;
+                b[count] = bi;
+                c[count] = ci;
+            }
+
+    SimdLevel previousLevel = getSimdLevel();
+    for (int level = SIMD_LEVEL_SCALAR; level <= getSupportedSimdLevel(); ++level) {
+        MODULE_TEST_CHECK(setSimdLevel((SimdLevel)level) == QUAD_EQ_ERRORS_OK);
+
+        double root_1[NUM_OF_EQUATIONS] = {}, root_2[NUM_OF_EQUATIONS] = {};
+        QuadEqRootState numOfSols[NUM_OF_EQUATIONS] = {};
+        QuadraticEquationDoubleBatch       batch  = {count, a, b, c};
+        QuadraticEquationDoubleBatchAnswer answer = {root_1, root_2, numOfSols};
+        MODULE_TEST_CHECK(getSolutionsBatchSimd(&batch, &answer) == QUAD_EQ_ERRORS_OK);
+        for (size_t i = 0; i < count; ++i) {
+            QuadraticEquationAnswer simdAnswer = {root_1[i], root_2[i], numOfSols[i]};
+            QuadraticEquationAnswer expected   = solveDirectly(a[i], b[i], c[i]);
+            MODULE_TEST_CHECK(isSameAnswer(&simdAnswer, &expected));
+        }
+    }
+    setSimdLevel(previousLevel);
+
+    // one invalid coefficient rejects whole batch
+    double nan[] = {1, NAN, 1};
+    double root_1[3] = {}, root_2[3] = {};
+    QuadEqRootState numOfSols[3] = {};
+    QuadraticEquationDoubleBatch       batch  = {3, a, nan, c};
+    QuadraticEquationDoubleBatchAnswer answer = {root_1, root_2, numOfSols};
+    MODULE_TEST_CHECK(getSolutionsBatchSimd(&batch, &answer) != QUAD_EQ_ERRORS_OK);
+}
+
+/// @brief adaptive solver gives the same answers as getSolutions() and counts every equation once
+static void testAdaptiveSolver() {
+    const int MAX_COEF = 4;
+    resetAdaptiveSolverStats();
+    unsigned long long numOfEquations = 0;
+    for (int a = -MAX_COEF; a <= MAX_COEF; ++a)
+        for (int b = -MAX_COEF; b <= MAX_COEF; ++b)
+            for (int c = -MAX_COEF; c <= MAX_COEF; ++c, ++numOfEquations) {
+                QuadraticEquation eq = {(long double)a, (long double)b, (long double)c, 0};
+                QuadraticEquationAnswer answer = {};
+                MODULE_TEST_CHECK(getSolutionsAdaptive(&eq, &answer) == QUAD_EQ_ERRORS_OK);
+                QuadraticEquationAnswer expected = solveDirectly(a, b, c);
+                MODULE_TEST_CHECK(isSameAnswer(&answer, &expected));
+            }
+
+    // 0.1 has no exact double, so equation goes to long double path
+    QuadraticEquation inexact = {0.1L, -0.3L, 0.2L, 0};
+    QuadraticEquationAnswer answer = {};
+    MODULE_TEST_CHECK(getSolutionsAdaptive(&inexact, &answer) == QUAD_EQ_ERRORS_OK);
+    QuadraticEquationAnswer expected = solveDirectly(inexact.a, inexact.b, inexact.c);
+    MODULE_TEST_CHECK(isSameAnswer(&answer, &expected));
+    ++numOfEquations;
+
+    AdaptiveSolverStats stats = getAdaptiveSolverStats();
+    MODULE_TEST_CHECK(stats.numOfCalls == numOfEquations);
+    MODULE_TEST_CHECK(stats.numOfInexactInputs == 1);
+    MODULE_TEST_CHECK(stats.numOfFastSolved + stats.numOfEscalations + stats.numOfInexactInputs == stats.numOfCalls);
+    resetAdaptiveSolverStats();
+}
+
+static bool isSameRational(ExactRational number, long long numerator, long long denominator) {
+    return number.numerator == numerator && number.denominator == denominator;
+}
+
+/// @brief exact solver parses fractions, brings them to common denominator and finds rational roots exactly
+static void testExactSolver() {
+    const char* const lines[] = {"1/2", "-0.5\n", "-5/6", "1/3", "7/x"};
+    ExactRational coefs[sizeof(lines) / sizeof(*lines)] = {};
+    bool results[sizeof(lines) / sizeof(*lines)] = {};
+    for (size_t i = 0; i < sizeof(lines) / sizeof(*lines); ++i)
+        MODULE_TEST_CHECK(parseExactCoef(lines[i], &coefs[i], &results[i]) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(results[0] && isSameRational(coefs[0],  1, 2));
+    MODULE_TEST_CHECK(results[1] && isSameRational(coefs[1], -1, 2));
+    MODULE_TEST_CHECK(results[2] && isSameRational(coefs[2], -5, 6));
+    MODULE_TEST_CHECK(results[3] && isSameRational(coefs[3],  1, 3));
+    MODULE_TEST_CHECK(!results[4]);
+
+    // x^2 / 2 - 5x / 6 + 1 / 3 = (3x^2 - 5x + 2) / 6, roots are 2/3 and 1
+    const ExactRational equationCoefs[3] = {coefs[0], coefs[2], coefs[3]};
+    IntegerQuadraticEquation eq = {};
+    bool isBuilt = false;
+    MODULE_TEST_CHECK(buildIntegerEquation(equationCoefs, &eq, &isBuilt) == QUAD_EQ_ERRORS_OK && isBuilt);
+    MODULE_TEST_CHECK(eq.a == 3 && eq.b == -5 && eq.c == 2 && eq.denominator == 6);
+
+    ExactQuadraticEquationAnswer answer = {};
+    MODULE_TEST_CHECK(getSolutionsExact(&eq, &answer) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(answer.answer.numOfSols == TWO_ROOTS && answer.discriminant == 1 && answer.areRootsRational);
+    MODULE_TEST_CHECK((isSameRational(answer.exactRoot_1, 2, 3) && isSameRational(answer.exactRoot_2, 1, 1)) ||
+                      (isSameRational(answer.exactRoot_1, 1, 1) && isSameRational(answer.exactRoot_2, 2, 3)));
+
+    // (x - 1e9) ^ 2: discriminant 4e18 - 4e18 is exactly 0
+    IntegerQuadraticEquation doubleRoot = {1, -2000000000LL, 1000000000000000000LL, 1};
+    MODULE_TEST_CHECK(getSolutionsExact(&doubleRoot, &answer) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(answer.answer.numOfSols == ONE_ROOT && answer.discriminant == 0 && answer.areRootsRational);
+    MODULE_TEST_CHECK(isSameRational(answer.exactRoot_1, 1000000000LL, 1));
+
+    // x^2 - 2: roots are irrational, only approximate values are filled
+    IntegerQuadraticEquation irrational = {1, 0, -2, 1};
+    MODULE_TEST_CHECK(getSolutionsExact(&irrational, &answer) == QUAD_EQ_ERRORS_OK);
+    QuadraticEquationAnswer expected = solveDirectly(1, 0, -2);
+    MODULE_TEST_CHECK(!answer.areRootsRational && answer.discriminant == 8 && isSameAnswer(&answer.answer, &expected));
+}
+
+/// @brief solves batch on server and compares answers with getSolutions()
+static void checkServerAnswers(int fd, const double* a, const double* b, const double* c, size_t count) {
+    double* root_1 = (double*)calloc(count, sizeof(double));
+    double* root_2 = (double*)calloc(count, sizeof(double));
+    QuadEqRootState* numOfSols = (QuadEqRootState*)calloc(count, sizeof(QuadEqRootState));
+    MODULE_TEST_CHECK(root_1 != NULL && root_2 != NULL && numOfSols != NULL);
+
+    QuadraticEquationDoubleBatch       batch  = {count, a, b, c};
+    QuadraticEquationDoubleBatchAnswer answer = {root_1, root_2, numOfSols};
+    if (root_1 != NULL && root_2 != NULL && numOfSols != NULL) {
+        MODULE_TEST_CHECK(solveOnSolverServer(fd, &batch, &answer) == QUAD_EQ_ERRORS_OK);
+        for (size_t i = 0; i < count; ++i) {
+            QuadraticEquationAnswer serverAnswer = {root_1[i], root_2[i], numOfSols[i]};
+            QuadraticEquationAnswer expected     = solveDirectly(a[i], b[i], c[i]);
+            MODULE_TEST_CHECK(isSameAnswer(&serverAnswer, &expected));
+        }
+    }
+    free(root_1);
+    free(root_2);
+    free(numOfSols);
+}
+
+/// @brief server in child process answers requests, rejects invalid one without breaking connection, stops on SIGTERM
+static void testSolverServer(const char* directory) {
+    char socketPath[MODULE_TESTS_MAX_PATH_LEN] = {};
+    snprintf(socketPath, sizeof(socketPath), "%s/server.sock", directory);
+
+    // buffered output would be printed by both processes
+    fflush(stdout);
+    pid_t server = fork();
+    if (server == 0)
+        _exit(runSolverServer(socketPath, NULL) == QUAD_EQ_ERRORS_OK ? 0 : 1);
+    MODULE_TEST_CHECK(server != -1);
+    if (server == -1)
+        return;
+
+    int fd = -1;
+    for (int attempt = 0; attempt < MODULE_TESTS_MAX_CONNECT_ATTEMPTS && fd == -1; ++attempt) {
+        if (access(socketPath, F_OK) != 0 || connectToSolverServer(socketPath, &fd) != QUAD_EQ_ERRORS_OK)
+            usleep(1000);
+    }
+    MODULE_TEST_CHECK(fd != -1);
+
+    if (fd != -1) {
+        const int MAX_COEF = 4;
+        const size_t NUM_OF_EQUATIONS = (2 * MAX_COEF + 1) * (2 * MAX_COEF + 1) * (2 * MAX_COEF + 1);
+        double a[NUM_OF_EQUATIONS] = {}, b[NUM_OF_EQUATIONS] = {}, c[NUM_OF_EQUATIONS] = {};
+        size_t count = 0;
+        for (int ai = -MAX_COEF; ai <= MAX_COEF; ++ai)
+            for (int bi = -MAX_COEF; bi <= MAX_COEF; ++bi)
+                for (int ci = -MAX_COEF; ci <= MAX_COEF; ++ci, ++count) {
+                    a[count] = ai;
+                    b[count] = bi;
+                    c[count] = ci;
+                }
+        checkServerAnswers(fd, a, b, c, count);
+
+        double nan[] = {1, NAN, 1};
+        double root_1[3] = {}, root_2[3] = {};
+        QuadEqRootState numOfSols[3] = {};
+        QuadraticEquationDoubleBatch       batch  = {3, a, nan, c};
+        QuadraticEquationDoubleBatchAnswer answer = {root_1, root_2, numOfSols};
+        MODULE_TEST_CHECK(solveOnSolverServer(fd, &batch, &answer) == QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+        // connection stays in sync after rejected request
+        checkServerAnswers(fd, a, b, c, 3);
+        disconnectFromSolverServer(fd);
+    }
+
+    int status = 0;
+    kill(server, SIGTERM);
+    MODULE_TEST_CHECK(waitpid(server, &status, 0) == server && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    MODULE_TEST_CHECK(access(socketPath, F_OK) != 0);
+}
+
+/// @brief tabulated values are the same as getPointValue() on every supported instruction set
+static void testParabolaTabulation() {
+    // points and coefficients are small multiples of 1/2, so all values are exact in double
+    const size_t NUM_OF_POINTS = 13;
+    const double START = -3, STEP = 0.5;
+    double x[NUM_OF_POINTS] = {};
+    for (size_t i = 0; i < NUM_OF_POINTS; ++i)
+        x[i] = START + (double)i * STEP;
+
+    const double a[] = {1, -0.5, 0}, b[] = {-2, 3, 1.5}, c[] = {0.5, 4, -1};
+    const size_t NUM_OF_EQUATIONS = sizeof(a) / sizeof(*a);
+
+    SimdLevel previousLevel = getSimdLevel();
+    for (int level = SIMD_LEVEL_SCALAR; level <= getSupportedSimdLevel(); ++level) {
+        MODULE_TEST_CHECK(setSimdLevel((SimdLevel)level) == QUAD_EQ_ERRORS_OK);
+
+        double matrix[NUM_OF_EQUATIONS * NUM_OF_POINTS] = {};
+        QuadraticEquationDoubleBatch batch = {NUM_OF_EQUATIONS, a, b, c};
+        MODULE_TEST_CHECK(tabulateParabolas(&batch, x, NUM_OF_POINTS, matrix) == QUAD_EQ_ERRORS_OK);
+
+        for (size_t e = 0; e < NUM_OF_EQUATIONS; ++e) {
+            QuadraticEquation eq = {a[e], b[e], c[e], 0};
+            double values[NUM_OF_POINTS] = {}, rangeValues[NUM_OF_POINTS] = {};
+            MODULE_TEST_CHECK(tabulateParabola(&eq, x, NUM_OF_POINTS, values) == QUAD_EQ_ERRORS_OK);
+            MODULE_TEST_CHECK(tabulateParabolaRange(&eq, START, STEP, NUM_OF_POINTS, rangeValues) ==
+                              QUAD_EQ_ERRORS_OK);
+
+            for (size_t i = 0; i < NUM_OF_POINTS; ++i) {
+                long double expected = 0;
+                MODULE_TEST_CHECK(getPointValue(&eq, x[i], &expected) == QUAD_EQ_ERRORS_OK);
+                MODULE_TEST_CHECK(values[i] == expected && rangeValues[i] == expected &&
+                                  matrix[e * NUM_OF_POINTS + i] == expected);
+            }
+        }
+    }
+    setSimdLevel(previousLevel);
+
+    // too big point rejects whole call
+    QuadraticEquation eq = {1, 0, 0, 0};
+    const double bigPoints[] = {1, 1e300};
+    double values[sizeof(bigPoints) / sizeof(*bigPoints)] = {};
+    MODULE_TEST_CHECK(tabulateParabola(&eq, bigPoints, sizeof(bigPoints) / sizeof(*bigPoints), values) !=
+                      QUAD_EQ_ERRORS_OK);
+}
+
+/// @brief solver in child process answers equations of shared channel, producers get error after it's stopped
+static void testSharedChannel() {
+    char name[MODULE_TESTS_MAX_PATH_LEN] = {};
+    snprintf(name, sizeof(name), "/quadModuleTests%d", (int)getpid());
+
+    SharedChannel solverChannel = {};
+    MODULE_TEST_CHECK(createSharedChannel(name, 0, &solverChannel) == QUAD_EQ_ERRORS_OK);
+    if (solverChannel.header == NULL)
+        return;
+
+    // buffered output would be printed by both processes
+    fflush(stdout);
+    pid_t solver = fork();
+    if (solver == 0)
+        _exit(runSharedChannelSolver(&solverChannel, NULL) == QUAD_EQ_ERRORS_OK ? 0 : 1);
+    MODULE_TEST_CHECK(solver != -1);
+
+    SharedChannel channel = {};
+    MODULE_TEST_CHECK(openSharedChannel(name, &channel) == QUAD_EQ_ERRORS_OK);
+    if (solver != -1 && channel.header != NULL) {
+        // all equations are submitted before first answer is waited, so solver gets groups of them
+        const int MAX_COEF = 2;
+        const size_t NUM_OF_EQUATIONS = (2 * MAX_COEF + 1) * (2 * MAX_COEF + 1) * (2 * MAX_COEF + 1);
+        QuadraticEquation equations[NUM_OF_EQUATIONS] = {};
+        uint64_t tickets[NUM_OF_EQUATIONS] = {};
+        size_t count = 0;
+        for (int a = -MAX_COEF; a <= MAX_COEF; ++a)
+            for (int b = -MAX_COEF; b <= MAX_COEF; ++b)
+                for (int c = -MAX_COEF; c <= MAX_COEF; ++c, ++count) {
+                    equations[count] = {(long double)a, (long double)b, (long double)c, 0};
+                    MODULE_TEST_CHECK(submitToSharedChannel(&channel, &equations[count], &tickets[count]) ==
+                                      QUAD_EQ_ERRORS_OK);
+                }
+        for (size_t i = 0; i < count; ++i) {
+            QuadraticEquationAnswer answer = {};
+            MODULE_TEST_CHECK(waitSharedChannelAnswer(&channel, tickets[i], &answer) == QUAD_EQ_ERRORS_OK);
+            QuadraticEquationAnswer expected = solveDirectly(equations[i].a, equations[i].b, equations[i].c);
+            MODULE_TEST_CHECK(isSameAnswer(&answer, &expected));
+        }
+
+        // error of getSolutions() is passed to producer
+        QuadraticEquation invalid = {1, NAN, 1, 0};
+        QuadraticEquationAnswer answer = {}, expected = {};
+        MODULE_TEST_CHECK(solveOnSharedChannel(&channel, &invalid, &answer) == getSolutions(&invalid, &expected));
+        MODULE_TEST_CHECK(channel.header->numOfSolved == count + 1);
+    }
+
+    if (solver != -1) {
+        int status = 0;
+        kill(solver, SIGTERM);
+        MODULE_TEST_CHECK(waitpid(solver, &status, 0) == solver && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+    if (channel.header != NULL) {
+        QuadraticEquation eq = {1, -3, 2, 0};
+        QuadraticEquationAnswer answer = {};
+        MODULE_TEST_CHECK(solveOnSharedChannel(&channel, &eq, &answer) == QUAD_EQ_ERRORS_INVALID_FILE);
+    }
+    closeSharedChannel(&channel);
+    closeSharedChannel(&solverChannel);
+    MODULE_TEST_CHECK(openSharedChannel(name, &channel) != QUAD_EQ_ERRORS_OK);
+}
+
+/// @brief point inside of interval, where it's sign is checked
+static long double getIntervalPoint(const SignInterval* interval) {
+    if (isinf(interval->from) && isinf(interval->to))
+        return 0;
+    if (isinf(interval->from))
+        return interval->to - 1;
+    if (isinf(interval->to))
+        return interval->from + 1;
+    return (interval->from + interval->to) / 2;
+}
+
+/// @brief analysis of equation agrees with separate functions, intervals cover whole line and have correct signs
+static void testEquationAnalysis() {
+    const int MAX_COEF = 3;
+    for (int a = -MAX_COEF; a <= MAX_COEF; ++a)
+        for (int b = -MAX_COEF; b <= MAX_COEF; ++b)
+            for (int c = -MAX_COEF; c <= MAX_COEF; ++c) {
+                QuadraticEquation eq = {(long double)a, (long double)b, (long double)c, 0};
+                QuadraticEquationAnalysis analysis = {};
+                MODULE_TEST_CHECK(analyzeEquation(&eq, &analysis) == QUAD_EQ_ERRORS_OK);
+
+                long double discriminant = 0;
+                MODULE_TEST_CHECK(getDiscriminant(&eq, &discriminant) == QUAD_EQ_ERRORS_OK);
+                MODULE_TEST_CHECK(isSameRoot(analysis.discriminant, discriminant));
+                QuadraticEquationAnswer expected = solveDirectly(a, b, c);
+                MODULE_TEST_CHECK(isSameAnswer(&analysis.answer, &expected));
+
+                MODULE_TEST_CHECK(analysis.isQuadratic == (a != 0));
+                if (a != 0) {
+                    long double vertX = 0, vertY = 0;
+                    MODULE_TEST_CHECK(getVertX(&eq, &vertX) == QUAD_EQ_ERRORS_OK);
+                    MODULE_TEST_CHECK(getVertY(&eq, &vertY) == QUAD_EQ_ERRORS_OK);
+                    MODULE_TEST_CHECK(isSameRoot(analysis.vertX, vertX) && isSameRoot(analysis.vertY, vertY));
+                }
+
+                MODULE_TEST_CHECK(analysis.numOfIntervals >= 1 && analysis.numOfIntervals <= MAX_NUM_OF_SIGN_INTERVALS);
+                MODULE_TEST_CHECK(isinf(analysis.intervals[0].from) && analysis.intervals[0].from < 0);
+                MODULE_TEST_CHECK(isinf(analysis.intervals[analysis.numOfIntervals - 1].to) &&
+                                  analysis.intervals[analysis.numOfIntervals - 1].to > 0);
+                for (size_t i = 0; i < analysis.numOfIntervals; ++i) {
+                    if (i > 0)
+                        MODULE_TEST_CHECK(analysis.intervals[i].from == analysis.intervals[i - 1].to);
+                    long double value = 0;
+                    getPointValue(&eq, getIntervalPoint(&analysis.intervals[i]), &value);
+                    MODULE_TEST_CHECK((value > 0) - (value < 0) == analysis.intervals[i].sign);
+                }
+            }
+
+    // lazy analysis computes only requested parts
+    QuadraticEquation linear = {0, 2, -4, 0};
+    LazyEquationAnalysis lazy = {};
+    MODULE_TEST_CHECK(initLazyAnalysis(&lazy, &linear) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(lazy.computedParts == 0);
+
+    QuadraticEquationAnswer answer = {};
+    MODULE_TEST_CHECK(getLazySolutions(&lazy, &answer) == QUAD_EQ_ERRORS_OK);
+    QuadraticEquationAnswer expected = solveDirectly(0, 2, -4);
+    MODULE_TEST_CHECK(isSameAnswer(&answer, &expected));
+    MODULE_TEST_CHECK((lazy.computedParts & LAZY_ANALYSIS_SOLUTIONS) &&
+                      !(lazy.computedParts & LAZY_ANALYSIS_INTERVALS));
+
+    long double vertX = 0, vertY = 0;
+    MODULE_TEST_CHECK(getLazyVertex(&lazy, &vertX, &vertY) == QUAD_EQ_ERRORS_LINEAR_EQ);
+}
+
+/// @brief number of records, that every thread writes to it's ring in async logger test, ring never becomes full
+const int MODULE_TESTS_NUM_OF_LOG_RECORDS = (int)ASYNC_LOG_RING_CAPACITY / 2;
+
+static void writeAsyncLogRecords(const char* threadName) {
+    for (int i = 0; i < MODULE_TESTS_NUM_OF_LOG_RECORDS; ++i)
+        ASYNC_LOG(DEBUG, "Module tests: record %d of %s thread\n", i, threadName);
+}
+
+/// @brief arguments are captured by type, strings are copied and cut, records of several threads are not dropped
+static void testAsyncLogger() {
+    char longString[2 * ASYNC_LOG_STRING_BYTES] = {};
+    memset(longString, 'x', sizeof(longString) - 1);
+
+    AsyncLogRecord record = {};
+    captureAsyncLogArg(&record, -5);
+    captureAsyncLogArg(&record, (size_t)5);
+    captureAsyncLogArg(&record, 1.5f);
+    captureAsyncLogArg(&record, 1.5L);
+    captureAsyncLogArg(&record, (const void*)&record);
+    captureAsyncLogArg(&record, "short");
+    captureAsyncLogArg(&record, (const char*)longString);
+    captureAsyncLogArg(&record, 7);
+    // it doesn't fit into record
+    captureAsyncLogArg(&record, 8);
+
+    MODULE_TEST_CHECK(record.numOfArgs == ASYNC_LOG_MAX_ARGS);
+    MODULE_TEST_CHECK(record.args[0].type == ASYNC_LOG_ARG_INT         && record.args[0].i  == -5);
+    MODULE_TEST_CHECK(record.args[1].type == ASYNC_LOG_ARG_UINT        && record.args[1].u  == 5);
+    MODULE_TEST_CHECK(record.args[2].type == ASYNC_LOG_ARG_DOUBLE      && record.args[2].d  == 1.5);
+    MODULE_TEST_CHECK(record.args[3].type == ASYNC_LOG_ARG_LONG_DOUBLE && record.args[3].ld == 1.5L);
+    MODULE_TEST_CHECK(record.args[4].type == ASYNC_LOG_ARG_POINTER     && record.args[4].p  == &record);
+    MODULE_TEST_CHECK(record.args[7].type == ASYNC_LOG_ARG_INT         && record.args[7].i  == 7);
+    MODULE_TEST_CHECK(record.args[5].type == ASYNC_LOG_ARG_STRING &&
+                      strcmp(record.strings + record.args[5].stringOffset, "short") == 0);
+    // long string takes the rest of place, '\0' still fits
+    MODULE_TEST_CHECK(record.args[6].type == ASYNC_LOG_ARG_STRING &&
+                      strlen(record.strings + record.args[6].stringOffset) ==
+                      ASYNC_LOG_STRING_BYTES - record.args[6].stringOffset - 1);
+
+    uint64_t numOfDropped = getAsyncLoggerDropped();
+    MODULE_TEST_CHECK(startAsyncLogger());
+    std::thread producer(writeAsyncLogRecords, "second");
+    writeAsyncLogRecords("first");
+    producer.join();
+    flushAsyncLogger();
+    MODULE_TEST_CHECK(getAsyncLoggerDropped() == numOfDropped);
+
+    // after stop records are written synchronously
+    stopAsyncLogger();
+    writeAsyncLogRecords("first");
+    MODULE_TEST_CHECK(getAsyncLoggerDropped() == numOfDropped);
+}
+
+/// @brief tests have the same coefficients and answers
+static bool isSameTest(const Test* first, const Test* second) {
+    return first->equation.a == second->equation.a && first->equation.b == second->equation.b &&
+           first->equation.c == second->equation.c && isSameAnswer(&first->answer, &second->answer);
+}
+
+/// @brief writes corpus in format and checks, that loadTestsFile() gives the same tests, as generator
+static void checkWrittenCorpus(const char* fileName, const CorpusGeneratorConfig* config, CorpusFormat format,
+                               const TestsArena* generated) {
+    ResultWriter writer = {};
+    MODULE_TEST_CHECK(openResultWriter(fileName, &writer) == QUAD_EQ_ERRORS_OK);
+    CorpusStats stats = {};
+    MODULE_TEST_CHECK(writeCorpus(config, generated->count, format, &writer, &stats) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(closeResultWriter(&writer) == QUAD_EQ_ERRORS_OK);
+
+    size_t numOfTests = 0;
+    for (int kind = 0; kind < CORPUS_NUM_OF_KINDS; ++kind)
+        numOfTests += stats.numOfKind[kind];
+    MODULE_TEST_CHECK(stats.numOfTests == generated->count && numOfTests == generated->count);
+
+    TestsArena loaded = {};
+    MODULE_TEST_CHECK(loadTestsFile(fileName, NULL, &loaded) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(loaded.count == generated->count);
+    for (size_t i = 0; i < loaded.count && i < generated->count; ++i)
+        MODULE_TEST_CHECK(isSameTest(&loaded.tests[i], &generated->tests[i]));
+    freeTestsArena(&loaded);
+    unlink(fileName);
+}
+
+/// @brief generated corpus is reproducible, passes checkOnTests() and survives text and binary files
+static void testCorpusGenerator(const char* directory) {
+    const size_t NUM_OF_TESTS = 2000;
+
+    CorpusGeneratorConfig config = {};
+    setDefaultCorpusConfig(&config);
+    MODULE_TEST_CHECK(parseCorpusMix("two=1,unknown=1", &config) == QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT);
+    MODULE_TEST_CHECK(parseCorpusMix("two=0",           &config) == QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT);
+    for (int kind = 0; kind < CORPUS_NUM_OF_KINDS; ++kind)
+        MODULE_TEST_CHECK(config.weights[kind] == CORPUS_DEFAULT_WEIGHTS[kind]);
+
+    TestsArena generated = {}, again = {};
+    MODULE_TEST_CHECK(generateCorpusTests(&config, NUM_OF_TESTS, &generated) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(generateCorpusTests(&config, NUM_OF_TESTS, &again)     == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(generated.count == NUM_OF_TESTS && again.count == NUM_OF_TESTS);
+    for (size_t i = 0; i < generated.count && i < again.count; ++i)
+        MODULE_TEST_CHECK(isSameTest(&generated.tests[i], &again.tests[i]));
+    freeTestsArena(&again);
+
+    Tester tester = {};
+    tester.cntOfTests       = (int)generated.count;
+    tester.tests            = generated.tests;
+    tester.GetSolutionsFunc = &getSolutions;
+    tester.isQuiet          = true;
+    MODULE_TEST_CHECK(checkOnTests(&tester).state == ALL_TESTS_PASSED);
+
+    char corpusFile[MODULE_TESTS_MAX_PATH_LEN] = {};
+    snprintf(corpusFile, sizeof(corpusFile), "%s/corpus.txt", directory);
+    checkWrittenCorpus(corpusFile, &config, CORPUS_FORMAT_TEXT, &generated);
+    snprintf(corpusFile, sizeof(corpusFile), "%s/corpus.bin", directory);
+    checkWrittenCorpus(corpusFile, &config, CORPUS_FORMAT_BINARY, &generated);
+    freeTestsArena(&generated);
+
+    // only stated kinds are generated
+    MODULE_TEST_CHECK(parseCorpusMix("one=1,inf=1", &config) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(generateCorpusTests(&config, NUM_OF_TESTS, &generated) == QUAD_EQ_ERRORS_OK);
+    for (size_t i = 0; i < generated.count; ++i)
+        MODULE_TEST_CHECK(generated.tests[i].answer.numOfSols == ONE_ROOT ||
+                          generated.tests[i].answer.numOfSols == INFINITE_ROOTS);
+    freeTestsArena(&generated);
+}
+
+/// @brief getSolutions() with first root moved by 1e-6, so it doesn't pass default gate
+static QuadEqErrors getSolutionsShifted(const QuadraticEquation* eq, QuadraticEquationAnswer* answer) {
+    QuadEqErrors error = getSolutions(eq, answer);
+    answer->root_1 += 1e-6L;
+    return error;
+}
+
+/// @brief harness passes getSolutions() on generated corpus, counts every equation and root once, fails broken solver
+static void testAccuracyHarness() {
+    const size_t NUM_OF_TESTS = 2000;
+    CorpusGeneratorConfig config = {};
+    setDefaultCorpusConfig(&config);
+    TestsArena tests = {};
+    MODULE_TEST_CHECK(generateCorpusTests(&config, NUM_OF_TESTS, &tests) == QUAD_EQ_ERRORS_OK);
+
+    const AccuracyReference references[] = {ACCURACY_REFERENCE_EXPECTED, getDefaultAccuracyReference()};
+    for (size_t r = 0; r < sizeof(references) / sizeof(*references); ++r) {
+        AccuracyReport report = {};
+        MODULE_TEST_CHECK(runAccuracyHarness(&getSolutions, tests.tests, tests.count, references[r],
+                                             getDefaultAccuracyGate(), &report) == QUAD_EQ_ERRORS_OK);
+        MODULE_TEST_CHECK(report.isPassed && report.numOfEquations == tests.count && report.numOfSolverErrors == 0);
+        MODULE_TEST_CHECK(report.nsPerEquation > 0);
+
+        size_t numOfEquations = 0;
+        for (int numOfSols = 0; numOfSols <= INFINITE_ROOTS; ++numOfSols) {
+            const AccuracyClassReport* classReport = &report.classes[numOfSols];
+            numOfEquations += classReport->numOfEquations;
+            MODULE_TEST_CHECK(classReport->numOfMisclassified == 0 && classReport->numOfFailedRoots == 0);
+
+            size_t numOfUlpRoots = 0, numOfRelRoots = 0;
+            for (int bucket = 0; bucket < ACCURACY_NUM_OF_ULP_BUCKETS; ++bucket)
+                numOfUlpRoots += classReport->ulpHistogram[bucket];
+            for (int bucket = 0; bucket < ACCURACY_NUM_OF_REL_BUCKETS; ++bucket)
+                numOfRelRoots += classReport->relHistogram[bucket];
+            MODULE_TEST_CHECK(numOfUlpRoots == classReport->numOfRoots && numOfRelRoots == classReport->numOfRoots);
+        }
+        MODULE_TEST_CHECK(numOfEquations == tests.count);
+    }
+
+    AccuracyReport report = {};
+    MODULE_TEST_CHECK(runAccuracyHarness(&getSolutionsShifted, tests.tests, tests.count, ACCURACY_REFERENCE_EXPECTED,
+                                         getDefaultAccuracyGate(), &report) == QUAD_EQ_ERRORS_OK);
+    MODULE_TEST_CHECK(!report.isPassed && report.classes[TWO_ROOTS].numOfFailedRoots > 0);
+    MODULE_TEST_CHECK(report.classes[TWO_ROOTS].maxAbsError >= 1e-6L - MODULE_TESTS_ROOT_TOLERANCE);
+    freeTestsArena(&tests);
+}
+
+CheckOnTestsState runModuleTests() {
+    printf("Running module tests: \n");
+    numOfFailedChecks = 0;
+
+    char directory[] = "/tmp/quadModuleTestsXXXXXX";
+    if (mkdtemp(directory) == NULL) {
+        printf("Module tests: couldn't create temporary directory\n");
+        return FAILED_ON_SOME_TEST;
+    }
+
+    testSolutionsStore(directory);
+    testSolutionsCache();
+    testColumnarFormat(directory);
+    testCAbi();
+    testTestsLoader(directory);
+    testBatchMode(directory);
+    testSolverRegistry();
+    testNumberParser();
+    testFloatSolver();
+    testSimdSolver();
+    testAdaptiveSolver();
+    testExactSolver();
+    testSolverServer(directory);
+    testParabolaTabulation();
+    testSharedChannel();
+    testEquationAnalysis();
+    testAsyncLogger();
+    testCorpusGenerator(directory);
+    testAccuracyHarness();
+
+    rmdir(directory);
+
+    if (numOfFailedChecks > 0) {
+        printf("%d module check(s) failed\n", numOfFailedChecks);
+        return FAILED_ON_SOME_TEST;
+    }
+    printf("All module tests passed\n");
+    return ALL_TESTS_PASSED;
+}
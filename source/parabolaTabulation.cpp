@@ -0,0 +1,295 @@
+/**
+    \file
+    \brief realization of evaluation of parabolas at many points
+
+    Every instruction set has two kernels: one reads points from array, the other one generates points
+    of arithmetic range. Point of range is computed as start + i * step (not accumulated), so error doesn't grow.
+    Multiplication and addition are not fused, so all kernels give the same results as scalar code.
+*/
+
+#include <stdio.h>
+#include <assert.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include "../include/parabolaTabulation.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief coefficients of one parabola in double
+struct ParabolaCoefs {
+    double a;
+    double b;
+    double c;
+};
+
+// ------------------------ SCALAR PATH ---------------------------------------
+
+static inline double evaluateHorner(const ParabolaCoefs* coefs, double x) {
+    return (coefs->a * x + coefs->b) * x + coefs->c;
+}
+
+static void tabulateArrayScalar(const ParabolaCoefs* coefs, const double* x, size_t count, double* values,
+                                size_t from) {
+    for (size_t i = from; i < count; ++i)
+        values[i] = evaluateHorner(coefs, x[i]);
+}
+
+static void tabulateRangeScalar(const ParabolaCoefs* coefs, double start, double step, size_t count, double* values,
+                                size_t from) {
+    for (size_t i = from; i < count; ++i)
+        values[i] = evaluateHorner(coefs, start + (double)i * step);
+}
+
+// ------------------------ SSE2 KERNELS --------------------------------------
+
+__attribute__((target("sse2")))
+static inline __m128d evaluateHornerSse2(__m128d a, __m128d b, __m128d c, __m128d x) {
+    return _mm_add_pd(_mm_mul_pd(_mm_add_pd(_mm_mul_pd(a, x), b), x), c);
+}
+
+__attribute__((target("sse2")))
+static void tabulateArraySse2(const ParabolaCoefs* coefs, const double* x, size_t count, double* values) {
+    const size_t WIDTH = 2;
+    const __m128d a = _mm_set1_pd(coefs->a);
+    const __m128d b = _mm_set1_pd(coefs->b);
+    const __m128d c = _mm_set1_pd(coefs->c);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH)
+        _mm_storeu_pd(values + i, evaluateHornerSse2(a, b, c, _mm_loadu_pd(x + i)));
+
+    tabulateArrayScalar(coefs, x, count, values, i);
+}
+
+__attribute__((target("sse2")))
+static void tabulateRangeSse2(const ParabolaCoefs* coefs, double start, double step, size_t count, double* values) {
+    const size_t WIDTH = 2;
+    const __m128d a        = _mm_set1_pd(coefs->a);
+    const __m128d b        = _mm_set1_pd(coefs->b);
+    const __m128d c        = _mm_set1_pd(coefs->c);
+    const __m128d starts   = _mm_set1_pd(start);
+    const __m128d steps    = _mm_set1_pd(step);
+    const __m128d width    = _mm_set1_pd((double)WIDTH);
+    __m128d       indexes  = _mm_setr_pd(0, 1);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        __m128d x = _mm_add_pd(starts, _mm_mul_pd(indexes, steps));
+        _mm_storeu_pd(values + i, evaluateHornerSse2(a, b, c, x));
+        indexes = _mm_add_pd(indexes, width);
+    }
+
+    tabulateRangeScalar(coefs, start, step, count, values, i);
+}
+
+// ------------------------ AVX2 KERNELS --------------------------------------
+
+__attribute__((target("avx2")))
+static inline __m256d evaluateHornerAvx2(__m256d a, __m256d b, __m256d c, __m256d x) {
+    return _mm256_add_pd(_mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(a, x), b), x), c);
+}
+
+__attribute__((target("avx2")))
+static void tabulateArrayAvx2(const ParabolaCoefs* coefs, const double* x, size_t count, double* values) {
+    const size_t WIDTH = 4;
+    const __m256d a = _mm256_set1_pd(coefs->a);
+    const __m256d b = _mm256_set1_pd(coefs->b);
+    const __m256d c = _mm256_set1_pd(coefs->c);
+
+    // two vectors per iteration, so latency of dependent operations is hidden
+    size_t i = 0;
+    for (; i + 2 * WIDTH <= count; i += 2 * WIDTH) {
+        __m256d first  = evaluateHornerAvx2(a, b, c, _mm256_loadu_pd(x + i));
+        __m256d second = evaluateHornerAvx2(a, b, c, _mm256_loadu_pd(x + i + WIDTH));
+        _mm256_storeu_pd(values + i,         first);
+        _mm256_storeu_pd(values + i + WIDTH, second);
+    }
+
+    tabulateArrayScalar(coefs, x, count, values, i);
+}
+
+__attribute__((target("avx2")))
+static void tabulateRangeAvx2(const ParabolaCoefs* coefs, double start, double step, size_t count, double* values) {
+    const size_t WIDTH = 4;
+    const __m256d a        = _mm256_set1_pd(coefs->a);
+    const __m256d b        = _mm256_set1_pd(coefs->b);
+    const __m256d c        = _mm256_set1_pd(coefs->c);
+    const __m256d starts   = _mm256_set1_pd(start);
+    const __m256d steps    = _mm256_set1_pd(step);
+    const __m256d width    = _mm256_set1_pd((double)WIDTH);
+    __m256d       indexes  = _mm256_setr_pd(0, 1, 2, 3);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        __m256d x = _mm256_add_pd(starts, _mm256_mul_pd(indexes, steps));
+        _mm256_storeu_pd(values + i, evaluateHornerAvx2(a, b, c, x));
+        indexes = _mm256_add_pd(indexes, width);
+    }
+
+    tabulateRangeScalar(coefs, start, step, count, values, i);
+}
+
+// ------------------------ AVX-512 KERNELS -----------------------------------
+
+__attribute__((target("avx512f")))
+static inline __m512d evaluateHornerAvx512(__m512d a, __m512d b, __m512d c, __m512d x) {
+    return _mm512_add_pd(_mm512_mul_pd(_mm512_add_pd(_mm512_mul_pd(a, x), b), x), c);
+}
+
+__attribute__((target("avx512f")))
+static void tabulateArrayAvx512(const ParabolaCoefs* coefs, const double* x, size_t count, double* values) {
+    const size_t WIDTH = 8;
+    const __m512d a = _mm512_set1_pd(coefs->a);
+    const __m512d b = _mm512_set1_pd(coefs->b);
+    const __m512d c = _mm512_set1_pd(coefs->c);
+
+    size_t i = 0;
+    for (; i + 2 * WIDTH <= count; i += 2 * WIDTH) {
+        __m512d first  = evaluateHornerAvx512(a, b, c, _mm512_loadu_pd(x + i));
+        __m512d second = evaluateHornerAvx512(a, b, c, _mm512_loadu_pd(x + i + WIDTH));
+        _mm512_storeu_pd(values + i,         first);
+        _mm512_storeu_pd(values + i + WIDTH, second);
+    }
+
+    tabulateArrayScalar(coefs, x, count, values, i);
+}
+
+__attribute__((target("avx512f")))
+static void tabulateRangeAvx512(const ParabolaCoefs* coefs, double start, double step, size_t count, double* values) {
+    const size_t WIDTH = 8;
+    const __m512d a        = _mm512_set1_pd(coefs->a);
+    const __m512d b        = _mm512_set1_pd(coefs->b);
+    const __m512d c        = _mm512_set1_pd(coefs->c);
+    const __m512d starts   = _mm512_set1_pd(start);
+    const __m512d steps    = _mm512_set1_pd(step);
+    const __m512d width    = _mm512_set1_pd((double)WIDTH);
+    __m512d       indexes  = _mm512_setr_pd(0, 1, 2, 3, 4, 5, 6, 7);
+
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        __m512d x = _mm512_add_pd(starts, _mm512_mul_pd(indexes, steps));
+        _mm512_storeu_pd(values + i, evaluateHornerAvx512(a, b, c, x));
+        indexes = _mm512_add_pd(indexes, width);
+    }
+
+    tabulateRangeScalar(coefs, start, step, count, values, i);
+}
+
+// ------------------------ DISPATCH ------------------------------------------
+
+/// @brief evaluates parabola at points of array with instruction set of vectorized solver
+static void tabulateArray(const ParabolaCoefs* coefs, const double* x, size_t count, double* values) {
+    switch (getSimdLevel()) {
+        case SIMD_LEVEL_AVX512: tabulateArrayAvx512(coefs, x, count, values);    break;
+        case SIMD_LEVEL_AVX2:   tabulateArrayAvx2  (coefs, x, count, values);    break;
+        case SIMD_LEVEL_SSE2:   tabulateArraySse2  (coefs, x, count, values);    break;
+        case SIMD_LEVEL_SCALAR: tabulateArrayScalar(coefs, x, count, values, 0); break;
+        default:
+            assert(false);
+            tabulateArrayScalar(coefs, x, count, values, 0);
+            break;
+    }
+}
+
+static void tabulateRange(const ParabolaCoefs* coefs, double start, double step, size_t count, double* values) {
+    switch (getSimdLevel()) {
+        case SIMD_LEVEL_AVX512: tabulateRangeAvx512(coefs, start, step, count, values);    break;
+        case SIMD_LEVEL_AVX2:   tabulateRangeAvx2  (coefs, start, step, count, values);    break;
+        case SIMD_LEVEL_SSE2:   tabulateRangeSse2  (coefs, start, step, count, values);    break;
+        case SIMD_LEVEL_SCALAR: tabulateRangeScalar(coefs, start, step, count, values, 0); break;
+        default:
+            assert(false);
+            tabulateRangeScalar(coefs, start, step, count, values, 0);
+            break;
+    }
+}
+
+/// @brief checks that all points are not too big and are not NaN
+static bool arePointsValid(const double* x, size_t count) {
+    // every point is checked (fmax() would skip NaN), & has no branches, so loop is vectorized
+    bool isValid = true;
+    for (size_t i = 0; i < count; ++i)
+        isValid &= isCoefValidT<double>(x[i]);
+    return isValid;
+}
+
+/// @brief validates coefficients of equation and converts them to double
+static QuadEqErrors getParabolaCoefs(const QuadraticEquation* eq, ParabolaCoefs* coefs) {
+    if (!isCoefValidT<long double>(eq->a) || !isCoefValidT<long double>(eq->b) || !isCoefValidT<long double>(eq->c))
+        return QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG;
+
+    *coefs = {(double)eq->a, (double)eq->b, (double)eq->c};
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors tabulateParabola(const struct QuadraticEquation* eq, const double* x, size_t count, double* values) {
+    ///\throw eq should not be NULL
+    ///\throw x and values should not be NULL, if count is not 0
+    assert(eq != NULL);
+
+    if (eq == NULL || (count != 0 && (x == NULL || values == NULL)))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    ParabolaCoefs coefs = {};
+    QuadEqErrors error = getParabolaCoefs(eq, &coefs);
+    if (error != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(error);
+    ///\warning x should not be too big or too small
+    if (!arePointsValid(x, count))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    tabulateArray(&coefs, x, count, values);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors tabulateParabolaRange(const struct QuadraticEquation* eq, double start, double step, size_t count,
+                                   double* values) {
+    ///\throw eq should not be NULL
+    ///\throw values should not be NULL, if count is not 0
+    assert(eq != NULL);
+
+    if (eq == NULL || (count != 0 && values == NULL))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (count == 0)
+        return QUAD_EQ_ERRORS_OK;
+
+    ParabolaCoefs coefs = {};
+    QuadEqErrors error = getParabolaCoefs(eq, &coefs);
+    if (error != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(error);
+    // points of range are between first and last one, so only they are checked
+    double last = start + (double)(count - 1) * step;
+    if (!isCoefValidT<double>(start) || !isCoefValidT<double>(step) || !isCoefValidT<double>(last))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    tabulateRange(&coefs, start, step, count, values);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors tabulateParabolas(const struct QuadraticEquationDoubleBatch* batch, const double* x, size_t numOfPoints,
+                               double* values) {
+    ///\throw batch and all of it's arrays should not be NULL
+    ///\throw x and values should not be NULL, if there is something to compute
+    assert(batch != NULL);
+
+    if (batch == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (batch->count == 0 || numOfPoints == 0)
+        return QUAD_EQ_ERRORS_OK;
+    if (batch->a == NULL || batch->b == NULL || batch->c == NULL || x == NULL || values == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    for (size_t i = 0; i < batch->count; ++i)
+        if (!isCoefValidT<double>(batch->a[i]) || !isCoefValidT<double>(batch->b[i]) || !isCoefValidT<double>(batch->c[i]))
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+    if (!arePointsValid(x, numOfPoints))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    // grid is shared, so while it fits into cache every row is computed from cache
+    for (size_t i = 0; i < batch->count; ++i) {
+        ParabolaCoefs coefs = {batch->a[i], batch->b[i], batch->c[i]};
+        tabulateArray(&coefs, x, numOfPoints, values + i * numOfPoints);
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
@@ -0,0 +1,153 @@
+/**
+    \file
+    \brief realization of stable C interface, thin layer over solver core
+
+    Functions call templates from quadraticSolverCore.hpp directly (not getSolutions() and others
+    from quadraticEquation.cpp), so library doesn't depend on LoggerLib and has no output.
+*/
+
+#include <math.h>
+
+#include "../include/quadSolver.h"
+#include "../include/quadraticSolverCore.hpp"
+
+// enums of C interface are copies of internal ones, so error codes are passed through without conversion
+static_assert((int)QS_ERROR_OK               == (int)QUAD_EQ_ERRORS_OK,              "QsError differs from QuadEqErrors");
+static_assert((int)QS_ERROR_ILLEGAL_ARG      == (int)QUAD_EQ_ERRORS_ILLEGAL_ARG,     "QsError differs from QuadEqErrors");
+static_assert((int)QS_ERROR_VALUE_IS_TOO_BIG == (int)QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG, "QsError differs from QuadEqErrors");
+static_assert((int)QS_ERROR_LINEAR_EQ        == (int)QUAD_EQ_ERRORS_LINEAR_EQ,       "QsError differs from QuadEqErrors");
+static_assert((int)QS_NO_ROOTS       == (int)NO_ROOTS,       "QsRootState differs from QuadEqRootState");
+static_assert((int)QS_ONE_ROOT       == (int)ONE_ROOT,       "QsRootState differs from QuadEqRootState");
+static_assert((int)QS_TWO_ROOTS      == (int)TWO_ROOTS,      "QsRootState differs from QuadEqRootState");
+static_assert((int)QS_INFINITE_ROOTS == (int)INFINITE_ROOTS, "QsRootState differs from QuadEqRootState");
+
+static bool isEquationValid(const QsEquation* eq) {
+    return isCoefValidT<long double>(eq->a) && isCoefValidT<long double>(eq->b) && isCoefValidT<long double>(eq->c);
+}
+
+/// @brief solves arrays of equations of given type, roots of equations without roots are 0
+template <typename Scalar>
+static int solveArray(size_t count, const Scalar* a, const Scalar* b, const Scalar* c,
+                      Scalar* root_1, Scalar* root_2, int* numOfSols) {
+    if (count == 0)
+        return QS_ERROR_OK;
+
+    if (a == NULL || b == NULL || c == NULL || root_1 == NULL || root_2 == NULL || numOfSols == NULL)
+        return QS_ERROR_ILLEGAL_ARG;
+
+    for (size_t i = 0; i < count; ++i)
+        if (!isCoefValidT<Scalar>(a[i]) || !isCoefValidT<Scalar>(b[i]) || !isCoefValidT<Scalar>(c[i]))
+            return QS_ERROR_VALUE_IS_TOO_BIG;
+
+    for (size_t i = 0; i < count; ++i) {
+        QuadEqRootState state = NO_ROOTS;
+        root_1[i] = root_2[i] = 0;
+        solveValidatedEquationT<Scalar>(a[i], b[i], c[i], &root_1[i], &root_2[i], &state);
+        numOfSols[i] = state;
+    }
+    return QS_ERROR_OK;
+}
+
+unsigned qsGetVersion(void) {
+    return QUAD_SOLVER_VERSION;
+}
+
+const char* qsGetErrorMessage(int error) {
+    switch (error) {
+        case QS_ERROR_OK:
+            return "no errors occured";
+        case QS_ERROR_ILLEGAL_ARG:
+            return "illegal argument (possibly set to NULL)";
+        case QS_ERROR_VALUE_IS_TOO_BIG:
+            return "value is too big";
+        case QS_ERROR_LINEAR_EQ:
+            return "equation is linear";
+        default:
+            return "unknown error";
+    }
+}
+
+int qsGetSolutions(const QsEquation* eq, QsAnswer* answer) {
+    if (eq == NULL || answer == NULL)
+        return QS_ERROR_ILLEGAL_ARG;
+    if (!isEquationValid(eq))
+        return QS_ERROR_VALUE_IS_TOO_BIG;
+
+    QuadEqRootState state = NO_ROOTS;
+    answer->root_1 = answer->root_2 = 0;
+    solveValidatedEquationT<long double>(eq->a, eq->b, eq->c, &answer->root_1, &answer->root_2, &state);
+    answer->numOfSols = state;
+    return QS_ERROR_OK;
+}
+
+int qsGetDiscriminant(const QsEquation* eq, long double* result) {
+    if (eq == NULL || result == NULL)
+        return QS_ERROR_ILLEGAL_ARG;
+    if (!isEquationValid(eq))
+        return QS_ERROR_VALUE_IS_TOO_BIG;
+
+    *result = computeDiscriminantT<long double>(eq->a, eq->b, eq->c);
+    return QS_ERROR_OK;
+}
+
+int qsGetVertX(const QsEquation* eq, long double* result) {
+    if (eq == NULL || result == NULL)
+        return QS_ERROR_ILLEGAL_ARG;
+    if (!isEquationValid(eq))
+        return QS_ERROR_VALUE_IS_TOO_BIG;
+    if (signT<long double>(eq->a) == 0)
+        return QS_ERROR_LINEAR_EQ;
+
+    *result = -eq->b / (2 * eq->a);
+    return QS_ERROR_OK;
+}
+
+int qsGetVertY(const QsEquation* eq, long double* result) {
+    if (eq == NULL || result == NULL)
+        return QS_ERROR_ILLEGAL_ARG;
+    if (!isEquationValid(eq))
+        return QS_ERROR_VALUE_IS_TOO_BIG;
+    if (signT<long double>(eq->a) == 0)
+        return QS_ERROR_LINEAR_EQ;
+
+    *result = -computeDiscriminantT<long double>(eq->a, eq->b, eq->c) / (4 * eq->a);
+    return QS_ERROR_OK;
+}
+
+int qsGetPointValue(const QsEquation* eq, long double x, long double* result) {
+    if (eq == NULL || result == NULL)
+        return QS_ERROR_ILLEGAL_ARG;
+    if (!isEquationValid(eq) || !isCoefValidT<long double>(x))
+        return QS_ERROR_VALUE_IS_TOO_BIG;
+
+    *result = (eq->a * x + eq->b) * x + eq->c;
+    return QS_ERROR_OK;
+}
+
+int qsGetSolutionsArray(size_t count, const long double* a, const long double* b, const long double* c,
+                        long double* root_1, long double* root_2, int* numOfSols) {
+    return solveArray<long double>(count, a, b, c, root_1, root_2, numOfSols);
+}
+
+int qsGetSolutionsArrayDouble(size_t count, const double* a, const double* b, const double* c,
+                              double* root_1, double* root_2, int* numOfSols) {
+    return solveArray<double>(count, a, b, c, root_1, root_2, numOfSols);
+}
+
+int qsGetPointValues(const QsEquation* eq, size_t count, const long double* x, long double* values) {
+    if (count == 0)
+        return QS_ERROR_OK;
+    if (eq == NULL || x == NULL || values == NULL)
+        return QS_ERROR_ILLEGAL_ARG;
+    if (!isEquationValid(eq))
+        return QS_ERROR_VALUE_IS_TOO_BIG;
+
+    for (size_t i = 0; i < count; ++i)
+        if (!isCoefValidT<long double>(x[i]))
+            return QS_ERROR_VALUE_IS_TOO_BIG;
+
+    // Horner scheme, loop has no branches
+    for (size_t i = 0; i < count; ++i)
+        values[i] = (eq->a * x[i] + eq->b) * x[i] + eq->c;
+    return QS_ERROR_OK;
+}
@@ -18,6 +18,10 @@
 
 #include "../LoggerLib/include/colourfullPrint.hpp"
 #include "../include/quadraticEquation.hpp"
+#include "../include/mappedInput.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/resultWriter.hpp"
+#include "../include/errorReporting.hpp"
 
 //extern "C" {
     #include "../LoggerLib/include/logLib.hpp"
@@ -28,13 +32,6 @@
                             printError(__VA_ARGS__); \
 */
 
-#define LOG_AND_RETURN(ERROR)                           \
-    do {                                                \
-        LOG_ERROR("%s", getErrorMessage(ERROR));        \
-        printError("%s", getErrorMessage(ERROR));       \
-        return ERROR;                                   \
-    } while(0)
-
 #define VALIDATE_EQUATION(eq)                           \
     do {                                                \
         QuadEqErrors error = validateEquation(eq);      \
@@ -45,23 +42,9 @@
 
 const int MAX_INPUT_LINE_LEN = 25; ///< maximum length of input line
 
-/**
-    \warning should be around 1e18, otherwise there might be errors with overflow
-    (cause long double MAX is around 1e36 and we use square of inputed values)
-*/
-const long double MAX_COEF_ABS_VALUE = 1e18; ///< maximum absolute value that coefficient can take
-
-
-/**
-    epsilon, regulates with what precision we work
-    \warning Should not be too small, otherwise there might be some errors with precision
-*/
-const long double EPSILON = 1e-9; ///< regulates with what precision we work
-
 /// @brief returns sign of variable x, we use it to avoid some precision problems
 int sign(long double x) {
-    if (x < -EPSILON) return -1;
-    return x > EPSILON;
+    return signT<long double>(x);
 }
 
 
@@ -84,6 +67,8 @@ const char* getErrorMessage(QuadEqErrors error) {
             return "Error: input line is too long\n";
         case QUAD_EQ_ERRORS_INVALID_EQUATION:
             return "Error: coefficients of equation are invalid\n";
+        case QUAD_EQ_ERRORS_MEMORY_ALLOCATION:
+            return "Error: couldn't allocate memory\n";
         default:
             return "No errors occured\n";
     }
@@ -109,23 +94,20 @@ QuadEqErrors parseLongDoubleAndCheckValid(char* line, long double* coef, bool* r
     if (line == NULL || coef == NULL || result == NULL)
         LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
 
-    char* ptr = line + strlen(line) - 1; // lineEnd
-    size_t len = strlen(line);
-    while (len >= 1 && (isblank(*ptr) || (*ptr) == '\n')) {
-        *ptr-- = '\0';
-        --len;
-    }
+    // line is not changed, blanks are just skipped
+    const char* begin = line;
+    const char* end   = line + strlen(line);
+    while (end > begin && (isblank(end[-1]) || end[-1] == '\n'))
+        --end;
+    while (begin < end && isspace(*begin))
+        ++begin;
 
-    if (len == 0) {
+    if (begin == end) {
         *result = false;
         return QUAD_EQ_ERRORS_OK;
     }
 
-    errno = 0;
-    char* endPtr = NULL; // init NULL (nullptr)
-    *coef = strtod(line, &endPtr);
-    *result = ((errno == 0) && (*endPtr == '\0'));
-    return QUAD_EQ_ERRORS_OK;
+    return parseNumberFast(begin, end, coef, result);
 }
 
 /**
@@ -160,7 +142,7 @@ static QuadEqErrors getCorrectCoef(const char* messageLine, long double* result)
 
         // if line was too long, error occurs
         if (inputLineLen - 1 > MAX_INPUT_LINE_LEN) {
-            LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG));
+            QUAD_EQ_LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG));
             printError("%s", getErrorMessage(QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG));
             continue;
         }
@@ -169,19 +151,19 @@ static QuadEqErrors getCorrectCoef(const char* messageLine, long double* result)
         // checks if line is a valid long double, if it is result is saved in coef
         QuadEqErrors error = parseLongDoubleAndCheckValid(line, &coef, &isOk);
         if (error != QUAD_EQ_ERRORS_OK) {
-            LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG));
+            QUAD_EQ_LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG));
             printError("%s", getErrorMessage(QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG));
         }
 
         if (isOk) {
             if (fabsl(coef) > MAX_COEF_ABS_VALUE) {
-                LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG));
+                QUAD_EQ_LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG));
                 printError("%s", getErrorMessage(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG));
             } else {
                 isGoodNumber = true;
             }
         } else {
-            LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT));
+            QUAD_EQ_LOG_ERROR("%s", getErrorMessage(QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT));
             printError("%s", getErrorMessage(QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT));
         }
     } while (!isGoodNumber); // until user will input correct coefficient
@@ -254,7 +236,7 @@ static QuadEqErrors validateEquation(const QuadraticEquation* eq) {
 
     long double coefArr[3] = {eq->a, eq->b, eq->c};
     for (int i = 0; i < 3; ++i)
-        if (sign(fabsl(coefArr[i]) - MAX_COEF_ABS_VALUE) > 0)
+        if (!isCoefValidT<long double>(coefArr[i]))
             return QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG;
     return QUAD_EQ_ERRORS_OK;
 }
@@ -305,7 +287,7 @@ QuadEqErrors getDiscriminant(const struct QuadraticEquation* eq, long double* re
     if (eq == NULL || result == NULL)
         LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
 
-    *result = square(eq->b) - 4 * eq->a * eq->c;
+    *result = computeDiscriminantT<long double>(eq->a, eq->b, eq->c);
     return QUAD_EQ_ERRORS_OK;
 }
 
@@ -342,11 +324,8 @@ QuadEqErrors getVertY(const struct QuadraticEquation* eq, long double* result) {
 
     ///\warning eq->a should not be 0
     if (sign(eq->a) != 0) {
-        long double disc = 0;
-        QuadEqErrors error = getDiscriminant(eq, &disc);
-        if (error != QUAD_EQ_ERRORS_OK)
-            LOG_AND_RETURN(error);
-
+        // equation and result are already checked, so discriminant is computed directly
+        long double disc = computeDiscriminantT<long double>(eq->a, eq->b, eq->c);
         *result = -disc / (4 * eq->a);
         return QUAD_EQ_ERRORS_OK;
     }
@@ -354,7 +333,7 @@ QuadEqErrors getVertY(const struct QuadraticEquation* eq, long double* result) {
     LOG_AND_RETURN(QUAD_EQ_ERRORS_LINEAR_EQ);
 }
 
-static QuadEqErrors solveLinearEquation(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer) {
+QuadEqErrors getSolutions(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer) {
     ///\throw eq should not be NULL
     ///\throw answer should not be NULL
     assert(eq != NULL);
@@ -365,155 +344,95 @@ static QuadEqErrors solveLinearEquation(const struct QuadraticEquation* eq, stru
 
     VALIDATE_EQUATION(eq);
 
-    if (sign(eq->b) == 0) {
-        answer->numOfSols = sign(eq->c) ? NO_ROOTS : INFINITE_ROOTS;
-        return QUAD_EQ_ERRORS_OK;
-    }
-
-    answer->root_1 = answer->root_2 = -eq->c / eq->b;
-    answer->numOfSols = ONE_ROOT;
+    // C-style API is long double instantiation of solver core
+    solveValidatedEquationT<long double>(eq->a, eq->b, eq->c, &answer->root_1, &answer->root_2, &answer->numOfSols);
     return QUAD_EQ_ERRORS_OK;
 }
 
-/**
-    \brief solves not linear case of equation (a != 0)
-    \param[in] eq given equation
-    \param[out] answer found roots and info about their cnt
-*/
-static QuadEqErrors solveQuadraticEquation(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer) {
-    ///\throw eq should not be NULL
-    ///\throw answer should not be NULL
-    assert(eq != NULL);
+QuadEqErrors getSolutionsBatch(const struct QuadraticEquationBatch* batch, struct QuadraticEquationBatchAnswer* answer) {
+    ///\throw batch and all of it's arrays should not be NULL
+    ///\throw answer and all of it's arrays should not be NULL
+    assert(batch != NULL);
     assert(answer != NULL);
 
-    if (eq == NULL || answer == NULL)
+    if (batch == NULL || answer == NULL)
         LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
 
-    VALIDATE_EQUATION(eq);
-
-    long double disc = 0;
-    QuadEqErrors error = getDiscriminant(eq, &disc);
+    QuadEqErrors error = getSolutionsBatchT<long double>(batch->count, batch->a, batch->b, batch->c,
+                                                         answer->root_1, answer->root_2, answer->numOfSols);
     if (error != QUAD_EQ_ERRORS_OK)
         LOG_AND_RETURN(error);
 
-    /// negative disc -> no solutions
-    if (sign(disc) < 0) {
-        answer->numOfSols = NO_ROOTS;
-        return QUAD_EQ_ERRORS_OK;
-    }
-
-    /**
-        we store this values, because they take a lot of time to compute (espessialy operation of square root).
-        So in case if we have a big number of calls to this function, it will not work too slow.
-        \code
-        long double discRoot = sqrtl(disc);
-        long double denom = 1 / (2 * eq->a);
-        \endcode
-    */
-
-    long double discRoot = sqrtl(disc);
-    long double denom = 1 / (2 * eq->a);
-    answer->root_1 = (-eq->b - discRoot) * denom;
-    /// we have 2 distinct solutions in case if disc != 0
-    if (sign(disc) != 0) {
-        answer->root_2 = (-eq->b + discRoot) * denom;
-        answer->numOfSols = TWO_ROOTS;
-    } else {
-        answer->numOfSols = ONE_ROOT;
-        // WARNING !!!
-        answer->root_2 = answer->root_1;
-    }
-
     return QUAD_EQ_ERRORS_OK;
 }
 
-QuadEqErrors getSolutions(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer) {
-    ///\throw eq should not be NULL
-    ///\throw answer should not be NULL
-    assert(eq != NULL);
-    assert(answer != NULL);
-
-    if (eq == NULL || answer == NULL)
-        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
-
-    VALIDATE_EQUATION(eq);
-
-    QuadEqErrors error = {};
-    if (sign(eq->a) == 0) {
-        error = solveLinearEquation(eq, answer);
-        if (error != QUAD_EQ_ERRORS_OK)
-            LOG_AND_RETURN(error);
-        return error;
-    }
-
-    error = solveQuadraticEquation(eq, answer);
-    if (error != QUAD_EQ_ERRORS_OK)
-        LOG_AND_RETURN(error);
-    return error;
+/// @brief appends text to line of solutions
+static char* appendText(char* line, const char* text) {
+    size_t len = strlen(text);
+    memcpy(line, text, len);
+    return line + len;
 }
 
-QuadEqErrors printSolutions(const struct QuadraticEquationAnswer* answer, int outputPrecision, const char* outputFile) {
+QuadEqErrors printSolutions(const struct QuadraticEquationAnswer* answer, int outputPrecision, struct ResultWriter* output) {
     ///\throw answer should not be NULL
+    ///\throw outputPrecision should be >= 0
     assert(answer != NULL);
-    if (answer == NULL)
+    assert(outputPrecision >= 0);
+    if (answer == NULL || outputPrecision < 0)
         LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
 
-    FILE* stream = stdout;
-    if (outputFile != NULL) {
-        FILE* outFile = fopen(outputFile, "w");
-        assert(outFile != NULL);
-        if (outFile == NULL)
-            LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
-
-        LOG_WARNING("Output of solutions goes to file: %s\n", outputFile);
-        // changeTextColor(YELLOW_COLOR);
-        // colourfullPrint("Output of solutions goes to file: %s\n", outputFile);
-        stream = outFile;
+    // whole line is formatted at once, then it goes either to writer or to stdout
+    char  line[128 + 2 * RESULT_NUMBER_MAX_LEN] = "";
+    char* lineEnd = line;
+    if (answer->numOfSols != INFINITE_ROOTS) {
+        lineEnd = appendText(lineEnd, "Number of solutions: ");
+        *lineEnd++ = (char)('0' + answer->numOfSols);
+        lineEnd = appendText(lineEnd, ", solutions of equation : { ");
     }
 
-    if (answer->numOfSols != INFINITE_ROOTS)
-        fprintf(stream, "Number of solutions: %d, solutions of equation : { ", answer->numOfSols);
-
     //WARNING: root_1 can be equal to root_2
     switch (answer->numOfSols) {
         case INFINITE_ROOTS:
-            fprintf(stream, "Infinitely many solutions\n");
+            lineEnd = appendText(lineEnd, "Infinitely many solutions\n");
             break;
         case NO_ROOTS:
             break;
         case TWO_ROOTS:
-            fprintf(stream, "%.*Lg, ", outputPrecision, answer->root_1);
+            lineEnd = formatResultNumber(lineEnd, answer->root_1, outputPrecision);
+            lineEnd = appendText(lineEnd, ", ");
         case ONE_ROOT:
-            fprintf(stream, "%.*Lg", outputPrecision, answer->root_2);
+            lineEnd = formatResultNumber(lineEnd, answer->root_2, outputPrecision);
             break;
         default:
-            if (outputFile != NULL)
-                fclose(stream);
             assert(false);
             LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
     }
     if (answer->numOfSols != INFINITE_ROOTS)
-        fprintf(stream, " }\n");
+        lineEnd = appendText(lineEnd, " }\n");
 
-    if (outputFile != NULL)
-        fclose(stream);
-    return QUAD_EQ_ERRORS_OK;
+    size_t lineLen = (size_t)(lineEnd - line);
+    if (output == NULL) {
+        fwrite(line, 1, lineLen, stdout);
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    writeResultChars(output, line, lineLen);
+    return output->error;
 }
 
-QuadEqErrors solveAndPrintEquation(const struct QuadraticEquation* eq, const char* outputFile) {
+QuadEqErrors solveAndPrintEquation(const struct QuadraticEquation* eq, struct ResultWriter* output) {
     ///\throw eq should not be NULL
     assert(eq != NULL);
 
     if (eq == NULL)
         LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
 
-    VALIDATE_EQUATION(eq);
-
+    // getSolutions() validates equation itself
     struct QuadraticEquationAnswer answer = {};
     QuadEqErrors error = getSolutions(eq, &answer);
     if (error != QUAD_EQ_ERRORS_OK)
         LOG_AND_RETURN(error);
-    error = printSolutions(&answer, eq->outputPrecision, outputFile);
+    error = printSolutions(&answer, eq->outputPrecision, output);
     if (error != QUAD_EQ_ERRORS_OK)
         LOG_AND_RETURN(error);
 
@@ -0,0 +1,278 @@
+/**
+    \file
+    \brief realization of vectorized solver of many quadratic equations
+
+    Every kernel computes all possible cases for each lane (linear equation, negative, zero and positive discriminant)
+    and then chooses right one with masks, so there are no branches inside of solving loop.
+    Equations, that are left after the last full vector, are solved by scalar code with the same formulas.
+*/
+
+#include <stdio.h>
+#include <assert.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include "../include/quadraticEquationSimd.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+// kernels store number of solutions as 32-bit integers
+static_assert(sizeof(QuadEqRootState) == sizeof(int), "QuadEqRootState should be 32-bit");
+
+const double SIMD_EPSILON = SolverPrecisionTraits<double>::EPSILON;
+
+typedef void (*solveBatchKernelPtr)(const QuadraticEquationDoubleBatch* batch,
+                                    QuadraticEquationDoubleBatchAnswer* answer, size_t from);
+
+// ------------------------ SCALAR PATH ---------------------------------------
+
+/// @brief kernels use the same formulas as double instantiation of solver core, so results are the same
+static void solveBatchScalar(const QuadraticEquationDoubleBatch* batch,
+                             QuadraticEquationDoubleBatchAnswer* answer, size_t from) {
+    for (size_t i = from; i < batch->count; ++i) {
+        answer->root_1[i] = answer->root_2[i] = 0;
+        solveValidatedEquationT<double>(batch->a[i], batch->b[i], batch->c[i],
+                                        &answer->root_1[i], &answer->root_2[i], &answer->numOfSols[i]);
+    }
+}
+
+// ------------------------ SSE2 KERNEL ---------------------------------------
+
+/// @brief mask ? ifTrue : ifFalse, SSE2 has no blend instruction
+__attribute__((target("sse2")))
+static inline __m128d selectSse2(__m128d mask, __m128d ifTrue, __m128d ifFalse) {
+    return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse));
+}
+
+__attribute__((target("sse2")))
+static void solveBatchSse2(const QuadraticEquationDoubleBatch* batch,
+                           QuadraticEquationDoubleBatchAnswer* answer, size_t from) {
+    const size_t WIDTH = 2;
+    const __m128d eps      = _mm_set1_pd( SIMD_EPSILON);
+    const __m128d negEps   = _mm_set1_pd(-SIMD_EPSILON);
+    const __m128d signMask = _mm_set1_pd(-0.0);
+    const __m128d zero     = _mm_setzero_pd();
+    const __m128d one      = _mm_set1_pd(1);
+    const __m128d two      = _mm_set1_pd(2);
+    const __m128d four     = _mm_set1_pd(4);
+    const __m128d infRoots = _mm_set1_pd(INFINITE_ROOTS);
+
+    size_t i = from;
+    for (; i + WIDTH <= batch->count; i += WIDTH) {
+        __m128d a = _mm_loadu_pd(batch->a + i);
+        __m128d b = _mm_loadu_pd(batch->b + i);
+        __m128d c = _mm_loadu_pd(batch->c + i);
+
+        __m128d aZero = _mm_and_pd(_mm_cmpge_pd(a, negEps), _mm_cmple_pd(a, eps));
+        __m128d bZero = _mm_and_pd(_mm_cmpge_pd(b, negEps), _mm_cmple_pd(b, eps));
+        __m128d cZero = _mm_and_pd(_mm_cmpge_pd(c, negEps), _mm_cmple_pd(c, eps));
+
+        __m128d disc     = _mm_sub_pd(_mm_mul_pd(b, b), _mm_mul_pd(_mm_mul_pd(four, a), c));
+        __m128d discNeg  = _mm_cmplt_pd(disc, negEps);
+        __m128d discZero = _mm_and_pd(_mm_cmpge_pd(disc, negEps), _mm_cmple_pd(disc, eps));
+
+        __m128d discRoot = _mm_sqrt_pd(_mm_max_pd(disc, zero));
+        __m128d denom    = _mm_div_pd(one, _mm_mul_pd(two, a));
+        __m128d negB     = _mm_xor_pd(b, signMask);
+        __m128d quadRoot1 = _mm_mul_pd(_mm_sub_pd(negB, discRoot), denom);
+        __m128d quadRoot2 = _mm_mul_pd(_mm_add_pd(negB, discRoot), denom);
+        quadRoot2 = selectSse2(discZero, quadRoot1, quadRoot2);
+        __m128d linRoot  = _mm_div_pd(_mm_xor_pd(c, signMask), b);
+
+        __m128d quadCnt = selectSse2(discNeg, zero, selectSse2(discZero, one, two));
+        __m128d linCnt  = selectSse2(bZero, selectSse2(cZero, infRoots, zero), one);
+        __m128d cnt     = selectSse2(aZero, linCnt, quadCnt);
+
+        __m128d linRootOrZero = _mm_andnot_pd(bZero, linRoot);
+        __m128d root1 = selectSse2(aZero, linRootOrZero, _mm_andnot_pd(discNeg, quadRoot1));
+        __m128d root2 = selectSse2(aZero, linRootOrZero, _mm_andnot_pd(discNeg, quadRoot2));
+
+        _mm_storeu_pd(answer->root_1 + i, root1);
+        _mm_storeu_pd(answer->root_2 + i, root2);
+        _mm_storel_epi64((__m128i*)(answer->numOfSols + i), _mm_cvttpd_epi32(cnt));
+    }
+
+    solveBatchScalar(batch, answer, i);
+}
+
+// ------------------------ AVX2 KERNEL ---------------------------------------
+
+__attribute__((target("avx2")))
+static void solveBatchAvx2(const QuadraticEquationDoubleBatch* batch,
+                           QuadraticEquationDoubleBatchAnswer* answer, size_t from) {
+    const size_t WIDTH = 4;
+    const __m256d eps      = _mm256_set1_pd( SIMD_EPSILON);
+    const __m256d negEps   = _mm256_set1_pd(-SIMD_EPSILON);
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    const __m256d zero     = _mm256_setzero_pd();
+    const __m256d one      = _mm256_set1_pd(1);
+    const __m256d two      = _mm256_set1_pd(2);
+    const __m256d four     = _mm256_set1_pd(4);
+    const __m256d infRoots = _mm256_set1_pd(INFINITE_ROOTS);
+
+    size_t i = from;
+    for (; i + WIDTH <= batch->count; i += WIDTH) {
+        __m256d a = _mm256_loadu_pd(batch->a + i);
+        __m256d b = _mm256_loadu_pd(batch->b + i);
+        __m256d c = _mm256_loadu_pd(batch->c + i);
+
+        __m256d aZero = _mm256_and_pd(_mm256_cmp_pd(a, negEps, _CMP_GE_OQ), _mm256_cmp_pd(a, eps, _CMP_LE_OQ));
+        __m256d bZero = _mm256_and_pd(_mm256_cmp_pd(b, negEps, _CMP_GE_OQ), _mm256_cmp_pd(b, eps, _CMP_LE_OQ));
+        __m256d cZero = _mm256_and_pd(_mm256_cmp_pd(c, negEps, _CMP_GE_OQ), _mm256_cmp_pd(c, eps, _CMP_LE_OQ));
+
+        __m256d disc     = _mm256_sub_pd(_mm256_mul_pd(b, b), _mm256_mul_pd(_mm256_mul_pd(four, a), c));
+        __m256d discNeg  = _mm256_cmp_pd(disc, negEps, _CMP_LT_OQ);
+        __m256d discZero = _mm256_and_pd(_mm256_cmp_pd(disc, negEps, _CMP_GE_OQ),
+                                         _mm256_cmp_pd(disc, eps,    _CMP_LE_OQ));
+
+        __m256d discRoot  = _mm256_sqrt_pd(_mm256_max_pd(disc, zero));
+        __m256d denom     = _mm256_div_pd(one, _mm256_mul_pd(two, a));
+        __m256d negB      = _mm256_xor_pd(b, signMask);
+        __m256d quadRoot1 = _mm256_mul_pd(_mm256_sub_pd(negB, discRoot), denom);
+        __m256d quadRoot2 = _mm256_mul_pd(_mm256_add_pd(negB, discRoot), denom);
+        quadRoot2 = _mm256_blendv_pd(quadRoot2, quadRoot1, discZero);
+        __m256d linRoot   = _mm256_div_pd(_mm256_xor_pd(c, signMask), b);
+
+        __m256d quadCnt = _mm256_blendv_pd(_mm256_blendv_pd(two, one, discZero), zero, discNeg);
+        __m256d linCnt  = _mm256_blendv_pd(one, _mm256_blendv_pd(zero, infRoots, cZero), bZero);
+        __m256d cnt     = _mm256_blendv_pd(quadCnt, linCnt, aZero);
+
+        __m256d linRootOrZero = _mm256_andnot_pd(bZero, linRoot);
+        __m256d root1 = _mm256_blendv_pd(_mm256_andnot_pd(discNeg, quadRoot1), linRootOrZero, aZero);
+        __m256d root2 = _mm256_blendv_pd(_mm256_andnot_pd(discNeg, quadRoot2), linRootOrZero, aZero);
+
+        _mm256_storeu_pd(answer->root_1 + i, root1);
+        _mm256_storeu_pd(answer->root_2 + i, root2);
+        _mm_storeu_si128((__m128i*)(answer->numOfSols + i), _mm256_cvttpd_epi32(cnt));
+    }
+
+    solveBatchScalar(batch, answer, i);
+}
+
+// ------------------------ AVX-512 KERNEL ------------------------------------
+
+__attribute__((target("avx512f")))
+static void solveBatchAvx512(const QuadraticEquationDoubleBatch* batch,
+                             QuadraticEquationDoubleBatchAnswer* answer, size_t from) {
+    const size_t WIDTH = 8;
+    const __m512i signMask = _mm512_set1_epi64((long long)0x8000000000000000ULL);
+    const __m512d eps      = _mm512_set1_pd( SIMD_EPSILON);
+    const __m512d negEps   = _mm512_set1_pd(-SIMD_EPSILON);
+    const __m512d zero     = _mm512_setzero_pd();
+    const __m512d one      = _mm512_set1_pd(1);
+    const __m512d two      = _mm512_set1_pd(2);
+    const __m512d four     = _mm512_set1_pd(4);
+    const __m512d infRoots = _mm512_set1_pd(INFINITE_ROOTS);
+
+    size_t i = from;
+    for (; i + WIDTH <= batch->count; i += WIDTH) {
+        __m512d a = _mm512_loadu_pd(batch->a + i);
+        __m512d b = _mm512_loadu_pd(batch->b + i);
+        __m512d c = _mm512_loadu_pd(batch->c + i);
+
+        __mmask8 aZero = _mm512_cmp_pd_mask(a, negEps, _CMP_GE_OQ) & _mm512_cmp_pd_mask(a, eps, _CMP_LE_OQ);
+        __mmask8 bZero = _mm512_cmp_pd_mask(b, negEps, _CMP_GE_OQ) & _mm512_cmp_pd_mask(b, eps, _CMP_LE_OQ);
+        __mmask8 cZero = _mm512_cmp_pd_mask(c, negEps, _CMP_GE_OQ) & _mm512_cmp_pd_mask(c, eps, _CMP_LE_OQ);
+
+        __m512d  disc     = _mm512_sub_pd(_mm512_mul_pd(b, b), _mm512_mul_pd(_mm512_mul_pd(four, a), c));
+        __mmask8 discNeg  = _mm512_cmp_pd_mask(disc, negEps, _CMP_LT_OQ);
+        __mmask8 discZero = _mm512_cmp_pd_mask(disc, negEps, _CMP_GE_OQ) & _mm512_cmp_pd_mask(disc, eps, _CMP_LE_OQ);
+
+        __m512d discRoot  = _mm512_sqrt_pd(_mm512_max_pd(disc, zero));
+        __m512d denom     = _mm512_div_pd(one, _mm512_mul_pd(two, a));
+        __m512d negB      = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(b), signMask));
+        __m512d quadRoot1 = _mm512_mul_pd(_mm512_sub_pd(negB, discRoot), denom);
+        __m512d quadRoot2 = _mm512_mask_blend_pd(discZero, _mm512_mul_pd(_mm512_add_pd(negB, discRoot), denom), quadRoot1);
+        __m512d negC      = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(c), signMask));
+        __m512d linRoot   = _mm512_maskz_div_pd((__mmask8)~bZero, negC, b);
+
+        __m512d quadCnt = _mm512_mask_blend_pd(discNeg, _mm512_mask_blend_pd(discZero, two, one), zero);
+        __m512d linCnt  = _mm512_mask_blend_pd(bZero, one, _mm512_mask_blend_pd(cZero, zero, infRoots));
+        __m512d cnt     = _mm512_mask_blend_pd(aZero, quadCnt, linCnt);
+
+        __m512d root1 = _mm512_mask_blend_pd(aZero, _mm512_mask_blend_pd(discNeg, quadRoot1, zero), linRoot);
+        __m512d root2 = _mm512_mask_blend_pd(aZero, _mm512_mask_blend_pd(discNeg, quadRoot2, zero), linRoot);
+
+        _mm512_storeu_pd(answer->root_1 + i, root1);
+        _mm512_storeu_pd(answer->root_2 + i, root2);
+        _mm256_storeu_si256((__m256i*)(answer->numOfSols + i), _mm512_cvttpd_epi32(cnt));
+    }
+
+    solveBatchScalar(batch, answer, i);
+}
+
+// ------------------------ DISPATCH ------------------------------------------
+
+SimdLevel getSupportedSimdLevel() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SIMD_LEVEL_AVX512;
+    if (__builtin_cpu_supports("avx2"))    return SIMD_LEVEL_AVX2;
+    if (__builtin_cpu_supports("sse2"))    return SIMD_LEVEL_SSE2;
+    return SIMD_LEVEL_SCALAR;
+}
+
+static solveBatchKernelPtr getKernel(SimdLevel level) {
+    switch (level) {
+        case SIMD_LEVEL_AVX512: return &solveBatchAvx512;
+        case SIMD_LEVEL_AVX2:   return &solveBatchAvx2;
+        case SIMD_LEVEL_SSE2:   return &solveBatchSse2;
+        case SIMD_LEVEL_SCALAR: return &solveBatchScalar;
+        default:
+            assert(false);
+            return &solveBatchScalar;
+    }
+}
+
+/// instruction set is chosen once, at program startup
+static SimdLevel           currentSimdLevel = getSupportedSimdLevel();
+static solveBatchKernelPtr currentKernel    = getKernel(currentSimdLevel);
+
+SimdLevel getSimdLevel() {
+    return currentSimdLevel;
+}
+
+QuadEqErrors setSimdLevel(SimdLevel level) {
+    ///\throw level should be supported by CPU
+    if (level < SIMD_LEVEL_SCALAR || level > getSupportedSimdLevel())
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    currentSimdLevel = level;
+    currentKernel    = getKernel(level);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+const char* getSimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SIMD_LEVEL_SCALAR: return "scalar";
+        case SIMD_LEVEL_SSE2:   return "sse2";
+        case SIMD_LEVEL_AVX2:   return "avx2";
+        case SIMD_LEVEL_AVX512: return "avx512";
+        default:
+            return "unknown";
+    }
+}
+
+QuadEqErrors getSolutionsBatchSimd(const struct QuadraticEquationDoubleBatch* batch,
+                                   struct QuadraticEquationDoubleBatchAnswer* answer) {
+    ///\throw batch and all of it's arrays should not be NULL
+    ///\throw answer and all of it's arrays should not be NULL
+    assert(batch != NULL);
+    assert(answer != NULL);
+
+    if (batch == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (batch->count == 0)
+        return QUAD_EQ_ERRORS_OK;
+
+    if (batch->a == NULL || batch->b == NULL || batch->c == NULL ||
+        answer->root_1 == NULL || answer->root_2 == NULL || answer->numOfSols == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    for (size_t i = 0; i < batch->count; ++i)
+        if (!isCoefValidT<double>(batch->a[i]) || !isCoefValidT<double>(batch->b[i]) || !isCoefValidT<double>(batch->c[i]))
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    (*currentKernel)(batch, answer, 0);
+    return QUAD_EQ_ERRORS_OK;
+}
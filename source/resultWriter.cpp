@@ -0,0 +1,150 @@
+/**
+    \file
+    \brief realization of buffered result writer and fast number formatting
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <float.h>
+#include <charconv>
+
+#include "../include/resultWriter.hpp"
+#include "../include/errorReporting.hpp"
+
+QuadEqErrors openResultWriterOnStream(FILE* stream, struct ResultWriter* writer) {
+    ///\throw stream should not be NULL
+    ///\throw writer should not be NULL
+    assert(stream != NULL);
+    assert(writer != NULL);
+
+    if (stream == NULL || writer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    *writer = {};
+    writer->buffer = (char*)malloc(RESULT_WRITER_BUFFER_SIZE);
+    if (writer->buffer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+
+    writer->stream = stream;
+    writer->error  = QUAD_EQ_ERRORS_OK;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors openResultWriter(const char* fileName, struct ResultWriter* writer) {
+    ///\throw writer should not be NULL
+    assert(writer != NULL);
+
+    if (writer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (fileName == NULL)
+        return openResultWriterOnStream(stdout, writer);
+
+    // file is truncated only once, all results of run go to it
+    FILE* stream = fopen(fileName, "w");
+    if (stream == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    QUAD_EQ_LOG_WARNING("Output of solutions goes to file: %s\n", fileName);
+
+    QuadEqErrors error = openResultWriterOnStream(stream, writer);
+    if (error != QUAD_EQ_ERRORS_OK) {
+        fclose(stream);
+        return error;
+    }
+    writer->isOwnStream = true;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors flushResultWriter(struct ResultWriter* writer) {
+    ///\throw writer should not be NULL
+    assert(writer != NULL);
+
+    if (writer == NULL || writer->buffer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // buffer is bigger than buffer of stream, so stdio writes it directly, without copying
+    if (writer->error == QUAD_EQ_ERRORS_OK && writer->size > 0 &&
+        (fwrite(writer->buffer, 1, writer->size, writer->stream) != writer->size || fflush(writer->stream) != 0)) {
+        writer->error = QUAD_EQ_ERRORS_INVALID_FILE;
+        reportError(writer->error, __FILE__, __FUNCTION__, __LINE__);
+    }
+    writer->size = 0;
+    return writer->error;
+}
+
+QuadEqErrors closeResultWriter(struct ResultWriter* writer) {
+    ///\throw writer should not be NULL
+    assert(writer != NULL);
+
+    if (writer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    QuadEqErrors error = QUAD_EQ_ERRORS_OK;
+    if (writer->buffer != NULL)
+        error = flushResultWriter(writer);
+    if (writer->isOwnStream && fclose(writer->stream) != 0 && error == QUAD_EQ_ERRORS_OK)
+        error = QUAD_EQ_ERRORS_INVALID_FILE;
+
+    free(writer->buffer);
+    *writer = {};
+    return error;
+}
+
+void writeResultChars(struct ResultWriter* writer, const char* text, size_t len) {
+    ///\throw writer should not be NULL
+    ///\throw text should not be NULL
+    assert(writer != NULL);
+    assert(text != NULL);
+
+    while (len > 0) {
+        if (writer->size == RESULT_WRITER_BUFFER_SIZE)
+            flushResultWriter(writer);
+
+        size_t part = RESULT_WRITER_BUFFER_SIZE - writer->size;
+        if (part > len)
+            part = len;
+        memcpy(writer->buffer + writer->size, text, part);
+        writer->size += part;
+        text += part;
+        len  -= part;
+    }
+}
+
+void writeResultString(struct ResultWriter* writer, const char* text) {
+    ///\throw text should not be NULL
+    assert(text != NULL);
+
+    writeResultChars(writer, text, strlen(text));
+}
+
+void writeResultNumber(struct ResultWriter* writer, long double number, int outputPrecision) {
+    ///\throw writer should not be NULL
+    assert(writer != NULL);
+
+    // number is formatted directly into buffer, so it's not copied
+    if (RESULT_WRITER_BUFFER_SIZE - writer->size < RESULT_NUMBER_MAX_LEN)
+        flushResultWriter(writer);
+    char* end = formatResultNumber(writer->buffer + writer->size, number, outputPrecision);
+    writer->size = (size_t)(end - writer->buffer);
+}
+
+char* formatResultNumber(char* buffer, long double number, int outputPrecision) {
+    ///\throw buffer should not be NULL
+    ///\throw outputPrecision should be >= 0
+    assert(buffer != NULL);
+    assert(outputPrecision >= 0);
+
+    char* bufferEnd = buffer + RESULT_NUMBER_MAX_LEN;
+    if (outputPrecision <= DBL_DIG)
+        return std::to_chars(buffer, bufferEnd, (double)number, std::chars_format::general, outputPrecision).ptr;
+
+    // shortest text has at most LDBL_DECIMAL_DIG digits, so bigger precision adds nothing,
+    // that's why RESULT_NUMBER_MAX_LEN is enough for any precision
+    if (outputPrecision >= LDBL_DECIMAL_DIG)
+        return std::to_chars(buffer, bufferEnd, number).ptr;
+    // libstdc++ formats long double with given precision through printf, so it's called directly
+    int len = snprintf(buffer, RESULT_NUMBER_MAX_LEN, "%.*Lg", outputPrecision, number);
+    return buffer + (len < 0 ? 0 : len);
+}
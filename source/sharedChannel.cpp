@@ -0,0 +1,367 @@
+/**
+    \file
+    \brief realization of submission channel in shared memory
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sched.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "../include/sharedChannel.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief number of checks of slot before sleeping on futex, short waits cost no system calls
+const int  SHARED_CHANNEL_SPIN_COUNT  = 2000;
+/// @brief sleeping side wakes up at least this often and checks that other side is alive
+const long SHARED_CHANNEL_WAIT_NS     = 100 * 1000 * 1000;
+
+/// @brief header of channel, that is served, SIGINT and SIGTERM wake up it's solver
+static SharedChannelHeader* volatile servedHeader = NULL;
+static volatile sig_atomic_t isStopRequested = 0;
+/// @brief on single CPU other side can't make progress while this one spins, so it sleeps at once
+static const int spinCount = sysconf(_SC_NPROCESSORS_ONLN) > 1 ? SHARED_CHANNEL_SPIN_COUNT : 0;
+
+// ------------------------ FUTEX ---------------------------------------------
+
+/// @brief sleeps while *address == value (but not longer than SHARED_CHANNEL_WAIT_NS), futex is shared between processes
+static void waitFutex(uint32_t* address, uint32_t value) {
+    struct timespec timeout = {0, SHARED_CHANNEL_WAIT_NS};
+    syscall(SYS_futex, address, FUTEX_WAIT, value, &timeout, NULL, 0);
+}
+
+static void wakeFutex(uint32_t* address) {
+    syscall(SYS_futex, address, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+static inline void pauseSpin() {
+    __builtin_ia32_pause();
+}
+
+static inline uint64_t loadSequence(const SharedChannelSlot* slot) {
+    return __atomic_load_n(&slot->sequence, __ATOMIC_SEQ_CST);
+}
+
+/// @brief sequence is stored before waiters are checked, so sleeping side either sees it or is woken up
+static inline void publishSequence(SharedChannelSlot* slot, uint64_t sequence) {
+    __atomic_store_n(&slot->sequence, sequence, __ATOMIC_SEQ_CST);
+}
+
+// ------------------------ MAPPING -------------------------------------------
+
+static size_t getMappingSize(uint64_t capacity) {
+    return sizeof(SharedChannelHeader) + capacity * sizeof(SharedChannelSlot);
+}
+
+static QuadEqErrors mapChannel(int fd, size_t mappingSize, SharedChannel* channel) {
+    void* mapping = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+
+    channel->header      = (SharedChannelHeader*)mapping;
+    channel->slots       = (SharedChannelSlot*)((char*)mapping + sizeof(SharedChannelHeader));
+    channel->mappingSize = mappingSize;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors createSharedChannel(const char* name, size_t capacity, struct SharedChannel* channel) {
+    ///\throw name should not be NULL
+    ///\throw channel should not be NULL
+    assert(name != NULL);
+    assert(channel != NULL);
+
+    if (name == NULL || channel == NULL || strlen(name) >= sizeof(channel->name))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    uint64_t slots = 1;
+    while (slots < (capacity == 0 ? SHARED_CHANNEL_DEFAULT_CAPACITY : capacity))
+        slots *= 2;
+    // sequences pos + 1 and pos + 2 should differ from pos + capacity
+    if (slots < 4)
+        slots = 4;
+
+    // old channel is removed, processes, that have it mapped, continue to use it
+    shm_unlink(name);
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd == -1)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    *channel = {};
+    QuadEqErrors error = ftruncate(fd, (off_t)getMappingSize(slots)) == -1 ? QUAD_EQ_ERRORS_INVALID_FILE :
+                                                                             mapChannel(fd, getMappingSize(slots), channel);
+    close(fd);
+    if (error != QUAD_EQ_ERRORS_OK) {
+        shm_unlink(name);
+        LOG_AND_RETURN(error);
+    }
+
+    // new object is filled with zeros
+    for (uint64_t i = 0; i < slots; ++i)
+        channel->slots[i].sequence = i;
+    channel->header->version         = SHARED_CHANNEL_VERSION;
+    channel->header->slotSize        = sizeof(SharedChannelSlot);
+    channel->header->capacity        = slots;
+    channel->header->isSolverRunning = 1;
+    // magic is written last, producers don't attach to half initialized channel
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(channel->header->magic, SHARED_CHANNEL_MAGIC, sizeof(SHARED_CHANNEL_MAGIC));
+
+    channel->isOwner = true;
+    strcpy(channel->name, name);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors openSharedChannel(const char* name, struct SharedChannel* channel) {
+    ///\throw name should not be NULL
+    ///\throw channel should not be NULL
+    assert(name != NULL);
+    assert(channel != NULL);
+
+    if (name == NULL || channel == NULL || strlen(name) >= sizeof(channel->name))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    int fd = shm_open(name, O_RDWR | O_CLOEXEC, 0);
+    if (fd == -1)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    *channel = {};
+    struct stat info = {};
+    QuadEqErrors error = fstat(fd, &info) == -1 || (size_t)info.st_size < sizeof(SharedChannelHeader) ?
+                         QUAD_EQ_ERRORS_INVALID_FILE : mapChannel(fd, (size_t)info.st_size, channel);
+    close(fd);
+    if (error != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(error);
+
+    const SharedChannelHeader* header = channel->header;
+    uint64_t capacity = header->capacity;
+    if (memcmp(header->magic, SHARED_CHANNEL_MAGIC, sizeof(SHARED_CHANNEL_MAGIC)) != 0 ||
+        header->version != SHARED_CHANNEL_VERSION || header->slotSize != sizeof(SharedChannelSlot) ||
+        capacity < 4 || (capacity & (capacity - 1)) != 0 || getMappingSize(capacity) != channel->mappingSize) {
+        closeSharedChannel(channel);
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    }
+
+    strcpy(channel->name, name);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+void closeSharedChannel(struct SharedChannel* channel) {
+    if (channel == NULL || channel->header == NULL)
+        return;
+
+    if (channel->isOwner) {
+        // producers, that still wait for answers, get error instead of waiting forever
+        __atomic_store_n(&channel->header->isSolverRunning, 0, __ATOMIC_SEQ_CST);
+        shm_unlink(channel->name);
+    }
+    munmap(channel->header, channel->mappingSize);
+    *channel = {};
+}
+
+// ------------------------ SOLVER --------------------------------------------
+
+static void handleStopSignal(int) {
+    isStopRequested = 1;
+    SharedChannelHeader* header = servedHeader;
+    if (header != NULL) {
+        __atomic_add_fetch(&header->submitFutex, 1, __ATOMIC_SEQ_CST);
+        wakeFutex(&header->submitFutex);
+    }
+}
+
+/// @brief slots, that are solved by one call of solveSlots()
+struct SlotsRange {
+    SharedChannel* channel;
+    uint64_t       first;  ///< position of first slot
+};
+
+static void solveSlots(void* context, size_t begin, size_t end) {
+    const SlotsRange* range = (const SlotsRange*)context;
+    uint64_t mask = range->channel->header->capacity - 1;
+    for (size_t i = begin; i < end; ++i) {
+        SharedChannelSlot* slot = &range->channel->slots[(range->first + i) & mask];
+        slot->answer = {};
+        slot->error  = (uint32_t)getSolutions(&slot->eq, &slot->answer);
+    }
+}
+
+/// @brief returns number of consecutive submitted slots starting from pos
+static size_t countSubmitted(const SharedChannel* channel, uint64_t pos) {
+    uint64_t mask = channel->header->capacity - 1;
+    size_t count = 0;
+    while (count < SHARED_CHANNEL_MAX_BATCH && loadSequence(&channel->slots[(pos + count) & mask]) == pos + count + 1)
+        ++count;
+    return count;
+}
+
+/// @brief sleeps until something is submitted (or signal arrives)
+static void waitSubmitted(SharedChannel* channel, uint64_t pos) {
+    SharedChannelHeader* header = channel->header;
+    for (int spin = 0; spin < spinCount; ++spin) {
+        if (countSubmitted(channel, pos) != 0)
+            return;
+        pauseSpin();
+    }
+
+    uint32_t value = __atomic_load_n(&header->submitFutex, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&header->numOfSolverWaiters, 1, __ATOMIC_SEQ_CST);
+    if (countSubmitted(channel, pos) == 0 && !isStopRequested)
+        waitFutex(&header->submitFutex, value);
+    __atomic_store_n(&header->numOfSolverWaiters, 0, __ATOMIC_SEQ_CST);
+}
+
+QuadEqErrors runSharedChannelSolver(struct SharedChannel* channel, struct ThreadPool* pool) {
+    ///\throw channel should be created by this process
+    assert(channel != NULL);
+    assert(channel->isOwner);
+
+    if (channel == NULL || channel->header == NULL || !channel->isOwner)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    SharedChannelHeader* header = channel->header;
+    uint64_t mask = header->capacity - 1;
+    isStopRequested = 0;
+    servedHeader    = header;
+    struct sigaction action = {}, oldInterrupt = {}, oldTerminate = {};
+    action.sa_handler = &handleStopSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT,  &action, &oldInterrupt);
+    sigaction(SIGTERM, &action, &oldTerminate);
+    QUAD_EQ_LOG_INFO("Shared channel solver serves %s\n", channel->name);
+
+    uint64_t pos = header->dequeuePos;
+    while (!isStopRequested) {
+        size_t count = countSubmitted(channel, pos);
+        if (count == 0) {
+            waitSubmitted(channel, pos);
+            continue;
+        }
+
+        // small groups are solved right here, threads of pool are woken up only for big ones
+        SlotsRange range = {channel, pos};
+        if (count >= 2 * PARALLEL_CHUNK_SIZE)
+            runParallelFor(pool, count, PARALLEL_CHUNK_SIZE, &solveSlots, &range);
+        else
+            solveSlots(&range, 0, count);
+
+        for (size_t i = 0; i < count; ++i) {
+            SharedChannelSlot* slot = &channel->slots[(pos + i) & mask];
+            publishSequence(slot, pos + i + 2);
+            __atomic_add_fetch(&slot->answerFutex, 1, __ATOMIC_SEQ_CST);
+            if (__atomic_load_n(&slot->numOfWaiters, __ATOMIC_SEQ_CST) != 0)
+                wakeFutex(&slot->answerFutex);
+        }
+        pos += count;
+        __atomic_store_n(&header->dequeuePos,  pos, __ATOMIC_RELEASE);
+        __atomic_store_n(&header->numOfSolved, header->numOfSolved + count, __ATOMIC_RELEASE);
+    }
+
+    sigaction(SIGINT,  &oldInterrupt, NULL);
+    sigaction(SIGTERM, &oldTerminate, NULL);
+    servedHeader = NULL;
+    __atomic_store_n(&header->isSolverRunning, 0, __ATOMIC_SEQ_CST);
+    QUAD_EQ_LOG_INFO("Shared channel solver of %s is stopped, %lu equations solved\n", channel->name,
+             (unsigned long)header->numOfSolved);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+// ------------------------ PRODUCER ------------------------------------------
+
+static bool isSolverRunning(const SharedChannel* channel) {
+    return __atomic_load_n(&channel->header->isSolverRunning, __ATOMIC_SEQ_CST) != 0;
+}
+
+QuadEqErrors submitToSharedChannel(struct SharedChannel* channel, const struct QuadraticEquation* eq, uint64_t* ticket) {
+    ///\throw channel should not be NULL
+    ///\throw eq should not be NULL
+    ///\throw ticket should not be NULL
+    assert(channel != NULL);
+    assert(eq != NULL);
+    assert(ticket != NULL);
+
+    if (channel == NULL || channel->header == NULL || eq == NULL || ticket == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    SharedChannelHeader* header = channel->header;
+    uint64_t mask = header->capacity - 1;
+    uint64_t pos  = __atomic_load_n(&header->enqueuePos, __ATOMIC_RELAXED);
+    SharedChannelSlot* slot = NULL;
+    while (true) {
+        slot = &channel->slots[pos & mask];
+        int64_t difference = (int64_t)(loadSequence(slot) - pos);
+        if (difference == 0) {
+            // on failure pos gets current value of enqueuePos
+            if (__atomic_compare_exchange_n(&header->enqueuePos, &pos, pos + 1, true,
+                                            __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+                break;
+        } else if (difference < 0) {
+            // channel is full: producer of previous lap hasn't taken answer yet
+            if (!isSolverRunning(channel))
+                LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+            sched_yield();
+            pos = __atomic_load_n(&header->enqueuePos, __ATOMIC_RELAXED);
+        } else {
+            pos = __atomic_load_n(&header->enqueuePos, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->eq = *eq;
+    publishSequence(slot, pos + 1);
+    __atomic_add_fetch(&header->submitFutex, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&header->numOfSolverWaiters, __ATOMIC_SEQ_CST) != 0)
+        wakeFutex(&header->submitFutex);
+
+    *ticket = pos;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors waitSharedChannelAnswer(struct SharedChannel* channel, uint64_t ticket, struct QuadraticEquationAnswer* answer) {
+    ///\throw channel should not be NULL
+    ///\throw answer should not be NULL
+    assert(channel != NULL);
+    assert(answer != NULL);
+
+    if (channel == NULL || channel->header == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    SharedChannelSlot* slot = &channel->slots[ticket & (channel->header->capacity - 1)];
+    for (int spin = 0; spin < spinCount && loadSequence(slot) != ticket + 2; ++spin)
+        pauseSpin();
+
+    while (loadSequence(slot) != ticket + 2) {
+        uint32_t value = __atomic_load_n(&slot->answerFutex, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&slot->numOfWaiters, 1, __ATOMIC_SEQ_CST);
+        if (loadSequence(slot) != ticket + 2) {
+            if (!isSolverRunning(channel)) {
+                __atomic_store_n(&slot->numOfWaiters, 0, __ATOMIC_SEQ_CST);
+                LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+            }
+            waitFutex(&slot->answerFutex, value);
+        }
+        __atomic_store_n(&slot->numOfWaiters, 0, __ATOMIC_SEQ_CST);
+    }
+
+    *answer = slot->answer;
+    QuadEqErrors error = (QuadEqErrors)slot->error;
+    // slot is given to producer of next lap
+    publishSequence(slot, ticket + channel->header->capacity);
+    return error;
+}
+
+QuadEqErrors solveOnSharedChannel(struct SharedChannel* channel, const struct QuadraticEquation* eq,
+                                  struct QuadraticEquationAnswer* answer) {
+    uint64_t ticket = 0;
+    QuadEqErrors error = submitToSharedChannel(channel, eq, &ticket);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+    return waitSharedChannelAnswer(channel, ticket, answer);
+}
@@ -0,0 +1,303 @@
+/**
+    \file
+    \brief realization of memoization cache of solutions
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <new>
+#include <atomic>
+
+#include "../include/solutionsCache.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief what key of entry means
+enum CacheKeyKind {
+    CACHE_KEY_EMPTY     = 0, ///< entry is free
+    CACHE_KEY_QUADRATIC = 1, ///< key is (b / a, c / a)
+    CACHE_KEY_LINEAR    = 2, ///< key is (c / b, 0)
+};
+
+/// @brief normalized coefficients of equation
+struct CacheKey {
+    CacheKeyKind kind;
+    int          scale;  ///< binary exponent of a, discriminant of equations with the same key differs less than 4 times
+    long double  first;
+    long double  second;
+};
+
+/**
+    \brief equations with |discriminant| up to this bound are not cached
+
+    Discriminant is compared with absolute EPSILON, so proportional equations can be classified differently.
+    Within one scale discriminants differ less than 4 times, so cached equations are classified as every
+    equation with their key.
+*/
+const long double CACHE_DISCRIMINANT_BOUND = 4 * SolverPrecisionTraits<long double>::EPSILON;
+
+/// @brief cached answer, roots are stored in order of equation with a > 0
+struct CacheEntry {
+    CacheKey        key;
+    long double     root_1;
+    long double     root_2;
+    QuadEqRootState numOfSols;
+    bool            isReferenced; ///< entry was used since last pass of clock hand
+};
+
+struct CacheSet {
+    std::atomic<bool> isLocked;
+    size_t            hand;     ///< next candidate for eviction
+    CacheEntry        entries[SOLUTIONS_CACHE_WAYS];
+};
+
+static CacheSet* cacheSets    = NULL;
+static size_t    numOfSets    = 0;   ///< power of 2
+/// @brief misses are solved by it, see setSolutionsCacheSolver()
+static getSolutionsFuncPtr cacheSolver = &getSolutions;
+
+static std::atomic<unsigned long long> numOfHits     (0);
+static std::atomic<unsigned long long> numOfMisses   (0);
+static std::atomic<unsigned long long> numOfEvictions(0);
+static std::atomic<unsigned long long> numOfUncached (0);
+
+QuadEqErrors createSolutionsCache(size_t capacity) {
+    destroySolutionsCache();
+    if (capacity == 0)
+        return QUAD_EQ_ERRORS_OK;
+
+    size_t sets = 1;
+    while (sets * SOLUTIONS_CACHE_WAYS < capacity)
+        sets *= 2;
+
+    // value initialization: all sets are unlocked and all entries are empty
+    cacheSets = new (std::nothrow) CacheSet[sets]();
+    if (cacheSets == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+    numOfSets = sets;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+void destroySolutionsCache() {
+    delete[] cacheSets;
+    cacheSets = NULL;
+    numOfSets = 0;
+}
+
+void setSolutionsCacheSolver(getSolutionsFuncPtr solver) {
+    cacheSolver = solver != NULL ? solver : &getSolutions;
+}
+
+bool isSolutionsCacheEnabled() {
+    return cacheSets != NULL;
+}
+
+/**
+    \brief builds key of equation
+    \result false if equation is not cached: it has a = b = 0 or it's discriminant is near EPSILON
+*/
+static bool makeCacheKey(const QuadraticEquation* eq, CacheKey* key) {
+    // classification of a and b is the same as in solver, adding 0 turns -0 into +0
+    if (sign(eq->a) != 0) {
+        if (fabsl(computeDiscriminantT<long double>(eq->a, eq->b, eq->c)) <= CACHE_DISCRIMINANT_BOUND)
+            return false;
+
+        key->kind   = CACHE_KEY_QUADRATIC;
+        key->scale  = ilogbl(eq->a);
+        key->first  = eq->b / eq->a + 0.0L;
+        key->second = eq->c / eq->a + 0.0L;
+        return true;
+    }
+    if (sign(eq->b) != 0) {
+        // linear equation with b != 0 always has one root, so scale doesn't matter
+        key->kind   = CACHE_KEY_LINEAR;
+        key->scale  = 0;
+        key->first  = eq->c / eq->b + 0.0L;
+        key->second = 0;
+        return true;
+    }
+    return false;
+}
+
+static bool areKeysEqual(const CacheKey* first, const CacheKey* second) {
+    return first->kind == second->kind && first->scale == second->scale && first->first == second->first &&
+           first->second == second->second;
+}
+
+/// @brief only 10 bytes of long double are significant, the rest is padding
+static uint64_t hashLongDouble(long double x) {
+    uint64_t mantissa = 0;
+    uint16_t exponent = 0;
+    memcpy(&mantissa, &x, sizeof(mantissa));
+    memcpy(&exponent, (const char*)&x + sizeof(mantissa), sizeof(exponent));
+    return mantissa ^ ((uint64_t)exponent << 48) ^ ((uint64_t)exponent >> 16);
+}
+
+/// @brief splitmix64 finalizer, so all bits of key affect index of set
+static size_t getSetIndex(const CacheKey* key) {
+    uint64_t hash = hashLongDouble(key->first) * 0x9E3779B97F4A7C15ULL ^ hashLongDouble(key->second) ^ (uint64_t)key->kind ^
+                    ((uint64_t)(uint32_t)key->scale << 32);
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return (size_t)hash & (numOfSets - 1);
+}
+
+static void lockSet(CacheSet* set) {
+    while (set->isLocked.exchange(true, std::memory_order_acquire))
+        while (set->isLocked.load(std::memory_order_relaxed))
+            ;
+}
+
+static void unlockSet(CacheSet* set) {
+    set->isLocked.store(false, std::memory_order_release);
+}
+
+/// @brief returns entry with given key, NULL if there is no such entry, set should be locked
+static CacheEntry* findEntry(CacheSet* set, const CacheKey* key) {
+    for (size_t way = 0; way < SOLUTIONS_CACHE_WAYS; ++way)
+        if (areKeysEqual(&set->entries[way].key, key))
+            return &set->entries[way];
+    return NULL;
+}
+
+/// @brief chooses entry for new key by CLOCK policy, set should be locked
+static CacheEntry* evictEntry(CacheSet* set) {
+    while (true) {
+        CacheEntry* entry = &set->entries[set->hand];
+        set->hand = (set->hand + 1) % SOLUTIONS_CACHE_WAYS;
+        if (entry->key.kind == CACHE_KEY_EMPTY)
+            return entry;
+        if (!entry->isReferenced) {
+            numOfEvictions.fetch_add(1, std::memory_order_relaxed);
+            return entry;
+        }
+        entry->isReferenced = false;
+    }
+}
+
+/// @brief roots of equation with a < 0 go in reversed order
+static void copyRoots(const QuadraticEquation* eq, long double root_1, long double root_2,
+                      long double* resultRoot_1, long double* resultRoot_2) {
+    bool isReversed = eq->a < 0 && sign(eq->a) != 0;
+    *resultRoot_1 = isReversed ? root_2 : root_1;
+    *resultRoot_2 = isReversed ? root_1 : root_2;
+}
+
+QuadEqErrors getSolutionsCached(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer) {
+    ///\throw eq should not be NULL
+    ///\throw answer should not be NULL
+    assert(eq != NULL);
+    assert(answer != NULL);
+
+    if (eq == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // invalid equations are not cached, solver reports error
+    CacheKey key = {};
+    if (cacheSets == NULL || !isCoefValidT<long double>(eq->a) || !isCoefValidT<long double>(eq->b) ||
+        !isCoefValidT<long double>(eq->c))
+        return cacheSolver(eq, answer);
+
+    if (!makeCacheKey(eq, &key)) {
+        numOfUncached.fetch_add(1, std::memory_order_relaxed);
+        return cacheSolver(eq, answer);
+    }
+
+    CacheSet* set = &cacheSets[getSetIndex(&key)];
+    lockSet(set);
+    CacheEntry* entry = findEntry(set, &key);
+    if (entry != NULL) {
+        entry->isReferenced = true;
+        copyRoots(eq, entry->root_1, entry->root_2, &answer->root_1, &answer->root_2);
+        answer->numOfSols = entry->numOfSols;
+        unlockSet(set);
+        numOfHits.fetch_add(1, std::memory_order_relaxed);
+        return QUAD_EQ_ERRORS_OK;
+    }
+    unlockSet(set);
+
+    // equation is solved without lock, other threads can use set meanwhile
+    numOfMisses.fetch_add(1, std::memory_order_relaxed);
+    QuadEqErrors error = cacheSolver(eq, answer);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    lockSet(set);
+    // another thread could add the same key
+    if (findEntry(set, &key) == NULL) {
+        entry = evictEntry(set);
+        entry->key          = key;
+        entry->numOfSols    = answer->numOfSols;
+        entry->isReferenced = false;
+        copyRoots(eq, answer->root_1, answer->root_2, &entry->root_1, &entry->root_2);
+    }
+    unlockSet(set);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors getSolutionsBatchCached(const struct QuadraticEquationBatch* batch,
+                                     struct QuadraticEquationBatchAnswer* answer) {
+    ///\throw batch and all of it's arrays should not be NULL
+    ///\throw answer and all of it's arrays should not be NULL
+    assert(batch != NULL);
+    assert(answer != NULL);
+
+    if (batch == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (batch->count == 0)
+        return QUAD_EQ_ERRORS_OK;
+    if (batch->a == NULL || batch->b == NULL || batch->c == NULL ||
+        answer->root_1 == NULL || answer->root_2 == NULL || answer->numOfSols == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // same as getSolutionsBatch(): if any coefficient is invalid, nothing is solved
+    for (size_t i = 0; i < batch->count; ++i)
+        if (!isCoefValidT<long double>(batch->a[i]) || !isCoefValidT<long double>(batch->b[i]) ||
+            !isCoefValidT<long double>(batch->c[i]))
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    for (size_t i = 0; i < batch->count; ++i) {
+        QuadraticEquation       eq       = {batch->a[i], batch->b[i], batch->c[i], DEFAULT_PRECISION};
+        QuadraticEquationAnswer solution = {};
+        getSolutionsCached(&eq, &solution);
+        answer->root_1   [i] = solution.root_1;
+        answer->root_2   [i] = solution.root_2;
+        answer->numOfSols[i] = solution.numOfSols;
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
+
+SolutionsCacheStats getSolutionsCacheStats() {
+    SolutionsCacheStats stats = {};
+    stats.numOfHits      = numOfHits     .load(std::memory_order_relaxed);
+    stats.numOfMisses    = numOfMisses   .load(std::memory_order_relaxed);
+    stats.numOfEvictions = numOfEvictions.load(std::memory_order_relaxed);
+    stats.numOfUncached  = numOfUncached .load(std::memory_order_relaxed);
+    return stats;
+}
+
+void resetSolutionsCacheStats() {
+    numOfHits     .store(0, std::memory_order_relaxed);
+    numOfMisses   .store(0, std::memory_order_relaxed);
+    numOfEvictions.store(0, std::memory_order_relaxed);
+    numOfUncached .store(0, std::memory_order_relaxed);
+}
+
+void printSolutionsCacheStats(FILE* stream) {
+    ///\throw stream should not be NULL
+    assert(stream != NULL);
+
+    SolutionsCacheStats stats = getSolutionsCacheStats();
+    unsigned long long numOfLookups = stats.numOfHits + stats.numOfMisses;
+    double hitRate = numOfLookups == 0 ? 0 : 100.0 * (double)stats.numOfHits / (double)numOfLookups;
+    fprintf(stream, "Solutions cache: %zu entries, %llu hits, %llu misses, %llu evictions, "
+                    "%llu not cached (a = b = 0 or discriminant near EPSILON), %.3f%% hit rate\n",
+            numOfSets * SOLUTIONS_CACHE_WAYS, stats.numOfHits, stats.numOfMisses,
+            stats.numOfEvictions, stats.numOfUncached, hitRate);
+}
@@ -0,0 +1,383 @@
+/**
+    \file
+    \brief realization of persistent on-disk store of solutions
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <atomic>
+#include <mutex>
+
+#include "../include/solutionsStore.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief suffix of temporary file, that is created by compaction
+const char* COMPACTION_SUFFIX = ".compact";
+
+/// @brief minimum capacity of compacted file
+const uint64_t MIN_COMPACTED_CAPACITY = 1 << 16;
+
+/// @brief mapped store file
+struct SolutionsStoreFile {
+    int                   fd;          ///< descriptor of file, -1 if file is not opened
+    unsigned char*        mapping;     ///< whole file
+    size_t                mappingSize; ///< size of file
+    SolutionsStoreHeader* header;      ///< header at the beginning of mapping
+    SolutionsStoreSlot*   slots;       ///< capacity slots after header
+    bool                  isWriter;    ///< file is locked by this process, so new answers can be added
+};
+
+static SolutionsStoreFile  storeFile   = {-1, NULL, 0, NULL, NULL, false};
+static getSolutionsFuncPtr storeSolver = NULL;
+static std::mutex          appendMutex; ///< threads of writer append one by one
+
+static std::atomic<unsigned long long> numOfHits    (0);
+static std::atomic<unsigned long long> numOfMisses  (0);
+static std::atomic<unsigned long long> numOfAppended(0);
+static std::atomic<unsigned long long> numOfDropped (0);
+
+/// @brief returns size of file with given capacity
+static size_t getStoreFileSize(uint64_t capacity) {
+    return sizeof(SolutionsStoreHeader) + capacity * sizeof(SolutionsStoreSlot);
+}
+
+/// @brief checks that header describes file of given size
+static bool isHeaderValid(const SolutionsStoreHeader* header, size_t fileSize) {
+    assert(header != NULL);
+
+    return memcmp(header->magic, SOLUTIONS_STORE_MAGIC, sizeof(SOLUTIONS_STORE_MAGIC)) == 0 &&
+           header->version  == SOLUTIONS_STORE_VERSION &&
+           header->slotSize == sizeof(SolutionsStoreSlot) &&
+           header->capacity != 0 && (header->capacity & (header->capacity - 1)) == 0 &&
+           header->capacity <= (fileSize - sizeof(SolutionsStoreHeader)) / sizeof(SolutionsStoreSlot) &&
+           memchr(header->solverName, '\0', sizeof(header->solverName)) != NULL;
+}
+
+static void closeStoreFile(SolutionsStoreFile* file) {
+    assert(file != NULL);
+
+    if (file->mapping != NULL)
+        munmap(file->mapping, file->mappingSize);
+    // lock is released together with descriptor
+    if (file->fd != -1)
+        close(file->fd);
+    *file = {};
+    file->fd = -1;
+}
+
+/**
+    \brief opens store file, creates it with given capacity and name of solver if it's empty
+    \param[in] solverName name of solver, that should have filled file, NULL accepts any solver
+    \param[in] isWriterNeeded if true and file is locked by other process, error is returned
+    \result QUAD_EQ_ERRORS_ILLEGAL_ARG if file was filled by other solver
+*/
+static QuadEqErrors openStoreFile(const char* fileName, uint64_t capacity, const char* solverName, bool isWriterNeeded,
+                                  SolutionsStoreFile* file) {
+    assert(fileName != NULL);
+    assert(file != NULL);
+    assert(solverName == NULL || strlen(solverName) < SOLUTIONS_STORE_SOLVER_NAME_SIZE);
+
+    *file = {};
+    bool isWritable = true;
+    file->fd = open(fileName, O_RDWR | O_CREAT, 0644);
+    if (file->fd == -1) {
+        // file without write permission can still be read
+        isWritable = false;
+        file->fd = open(fileName, O_RDONLY);
+        if (file->fd == -1)
+            return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+
+    file->isWriter = isWritable && flock(file->fd, LOCK_EX | LOCK_NB) == 0;
+    struct stat fileInfo = {};
+    if ((isWriterNeeded && !file->isWriter) || fstat(file->fd, &fileInfo) == -1 || !S_ISREG(fileInfo.st_mode)) {
+        closeStoreFile(file);
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+
+    size_t fileSize = (size_t)fileInfo.st_size;
+    if (fileSize == 0 && file->isWriter) {
+        // new file is filled with zeros (all slots are empty), magic is written last,
+        // so readers don't accept half initialized file
+        SolutionsStoreHeader header = {};
+        header.version  = SOLUTIONS_STORE_VERSION;
+        header.slotSize = sizeof(SolutionsStoreSlot);
+        header.capacity = capacity;
+        if (solverName != NULL)
+            strcpy(header.solverName, solverName);
+        fileSize = getStoreFileSize(capacity);
+        if (ftruncate(file->fd, (off_t)fileSize) == -1 ||
+            pwrite(file->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+            pwrite(file->fd, SOLUTIONS_STORE_MAGIC, sizeof(SOLUTIONS_STORE_MAGIC), 0) !=
+                (ssize_t)sizeof(SOLUTIONS_STORE_MAGIC)) {
+            closeStoreFile(file);
+            return QUAD_EQ_ERRORS_INVALID_FILE;
+        }
+    }
+
+    if (fileSize < sizeof(SolutionsStoreHeader)) {
+        closeStoreFile(file);
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+
+    int protection = file->isWriter ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* mapping = mmap(NULL, fileSize, protection, MAP_SHARED, file->fd, 0);
+    if (mapping == MAP_FAILED) {
+        closeStoreFile(file);
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+
+    file->mapping     = (unsigned char*)mapping;
+    file->mappingSize = fileSize;
+    file->header      = (SolutionsStoreHeader*)mapping;
+    file->slots       = (SolutionsStoreSlot*)(file->mapping + sizeof(SolutionsStoreHeader));
+    if (!isHeaderValid(file->header, fileSize)) {
+        closeStoreFile(file);
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+    if (solverName != NULL && strcmp(file->header->solverName, solverName) != 0) {
+        closeStoreFile(file);
+        return QUAD_EQ_ERRORS_ILLEGAL_ARG;
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief only 10 bytes of long double are significant, the rest is padding
+static uint64_t hashLongDouble(long double x) {
+    uint64_t mantissa = 0;
+    uint16_t exponent = 0;
+    memcpy(&mantissa, &x, sizeof(mantissa));
+    memcpy(&exponent, (const char*)&x + sizeof(mantissa), sizeof(exponent));
+    return mantissa ^ ((uint64_t)exponent << 48) ^ ((uint64_t)exponent >> 16);
+}
+
+/// @brief returns index of first slot of probe sequence of key
+static uint64_t getSlotIndex(const SolutionsStoreFile* file, long double a, long double b, long double c) {
+    uint64_t hash = hashLongDouble(a);
+    hash = hash * 0x9E3779B97F4A7C15ULL ^ hashLongDouble(b);
+    hash = hash * 0x9E3779B97F4A7C15ULL ^ hashLongDouble(c);
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return hash & (file->header->capacity - 1);
+}
+
+/**
+    \brief finds slot with given key or first empty slot of it's probe sequence
+    \result NULL if table is full and key is not found
+*/
+static SolutionsStoreSlot* findSlot(const SolutionsStoreFile* file, long double a, long double b, long double c) {
+    uint64_t mask  = file->header->capacity - 1;
+    uint64_t index = getSlotIndex(file, a, b, c);
+    for (uint64_t probe = 0; probe <= mask; ++probe) {
+        SolutionsStoreSlot* slot = &file->slots[(index + probe) & mask];
+        // slot is read only after it's marked as filled
+        if (__atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) != SOLUTIONS_STORE_SLOT_FILLED)
+            return slot;
+        if (slot->a == a && slot->b == b && slot->c == c)
+            return slot;
+    }
+    return NULL;
+}
+
+/// @brief adds answer to writable file, returns false if file is full
+static bool appendSlot(SolutionsStoreFile* file, long double a, long double b, long double c,
+                       const QuadraticEquationAnswer* answer) {
+    uint64_t numOfEntries = file->header->numOfEntries;
+    if ((double)(numOfEntries + 1) > SOLUTIONS_STORE_MAX_LOAD * (double)file->header->capacity)
+        return false;
+
+    SolutionsStoreSlot* slot = findSlot(file, a, b, c);
+    if (slot == NULL)
+        return false;
+    // another thread could add the same key
+    if (slot->state == SOLUTIONS_STORE_SLOT_FILLED)
+        return true;
+
+    slot->a         = a;
+    slot->b         = b;
+    slot->c         = c;
+    slot->root_1    = answer->numOfSols == ONE_ROOT || answer->numOfSols == TWO_ROOTS ? answer->root_1 : 0;
+    slot->root_2    = answer->numOfSols == ONE_ROOT || answer->numOfSols == TWO_ROOTS ? answer->root_2 : 0;
+    slot->numOfSols = (uint32_t)answer->numOfSols;
+    __atomic_store_n(&slot->state, (uint32_t)SOLUTIONS_STORE_SLOT_FILLED, __ATOMIC_RELEASE);
+    __atomic_store_n(&file->header->numOfEntries, numOfEntries + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+QuadEqErrors openSolutionsStore(const char* fileName, const char* solverName, getSolutionsFuncPtr solver) {
+    ///\throw fileName should not be NULL
+    ///\throw solverName should not be NULL
+    ///\throw solver should not be NULL
+    assert(fileName != NULL);
+    assert(solverName != NULL);
+    assert(solver != NULL);
+
+    if (fileName == NULL || solverName == NULL || solver == NULL ||
+        strlen(solverName) >= SOLUTIONS_STORE_SOLVER_NAME_SIZE)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    closeSolutionsStore();
+    QuadEqErrors error = openStoreFile(fileName, SOLUTIONS_STORE_DEFAULT_CAPACITY, solverName, false, &storeFile);
+    if (error != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(error);
+    if (!storeFile.isWriter)
+        QUAD_EQ_LOG_WARNING("Solutions store %s is written by other process, it's opened read only\n", fileName);
+
+    storeSolver = solver;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+void closeSolutionsStore() {
+    closeStoreFile(&storeFile);
+    storeSolver = NULL;
+}
+
+bool isSolutionsStoreOpened() {
+    return storeFile.mapping != NULL;
+}
+
+QuadEqErrors getSolutionsStored(const struct QuadraticEquation* eq, struct QuadraticEquationAnswer* answer) {
+    ///\throw eq should not be NULL
+    ///\throw answer should not be NULL
+    assert(eq != NULL);
+    assert(answer != NULL);
+
+    if (eq == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // invalid equations are not stored, solver reports error
+    if (!isSolutionsStoreOpened())
+        return getSolutions(eq, answer);
+    if (!isCoefValidT<long double>(eq->a) || !isCoefValidT<long double>(eq->b) || !isCoefValidT<long double>(eq->c))
+        return storeSolver(eq, answer);
+
+    // adding 0 turns -0 into +0, so they are the same key
+    long double a = eq->a + 0.0L;
+    long double b = eq->b + 0.0L;
+    long double c = eq->c + 0.0L;
+    const SolutionsStoreSlot* slot = findSlot(&storeFile, a, b, c);
+    if (slot != NULL && __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) == SOLUTIONS_STORE_SLOT_FILLED) {
+        numOfHits.fetch_add(1, std::memory_order_relaxed);
+        answer->numOfSols = (QuadEqRootState)slot->numOfSols;
+        if (answer->numOfSols == ONE_ROOT || answer->numOfSols == TWO_ROOTS) {
+            answer->root_1 = slot->root_1;
+            answer->root_2 = slot->root_2;
+        }
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    numOfMisses.fetch_add(1, std::memory_order_relaxed);
+    QuadEqErrors error = storeSolver(eq, answer);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    bool isAppended = false;
+    if (storeFile.isWriter) {
+        std::lock_guard<std::mutex> lock(appendMutex);
+        isAppended = appendSlot(&storeFile, a, b, c, answer);
+    }
+    if (isAppended)
+        numOfAppended.fetch_add(1, std::memory_order_relaxed);
+    else
+        numOfDropped.fetch_add(1, std::memory_order_relaxed);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors compactSolutionsStore(const char* fileName, size_t* numOfEntries) {
+    ///\throw fileName should not be NULL
+    ///\throw numOfEntries should not be NULL
+    assert(fileName != NULL);
+    assert(numOfEntries != NULL);
+
+    if (fileName == NULL || numOfEntries == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // lock of old file is held until the end, so nobody appends to it meanwhile
+    SolutionsStoreFile source = {};
+    if (openStoreFile(fileName, SOLUTIONS_STORE_DEFAULT_CAPACITY, NULL, true, &source) != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    uint64_t capacity = MIN_COMPACTED_CAPACITY;
+    while (capacity < source.header->numOfEntries * 4)
+        capacity *= 2;
+
+    size_t nameLen = strlen(fileName);
+    char*  tmpName = (char*)calloc(nameLen + strlen(COMPACTION_SUFFIX) + 1, sizeof(char));
+    if (tmpName == NULL) {
+        closeStoreFile(&source);
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+    }
+    memcpy(tmpName, fileName, nameLen);
+    strcpy(tmpName + nameLen, COMPACTION_SUFFIX);
+
+    unlink(tmpName);
+    SolutionsStoreFile destination = {};
+    QuadEqErrors error = openStoreFile(tmpName, capacity, source.header->solverName, true, &destination);
+    *numOfEntries = 0;
+    for (uint64_t i = 0; error == QUAD_EQ_ERRORS_OK && i < source.header->capacity; ++i) {
+        const SolutionsStoreSlot* slot = &source.slots[i];
+        if (slot->state != SOLUTIONS_STORE_SLOT_FILLED)
+            continue;
+
+        QuadraticEquationAnswer answer = {slot->root_1, slot->root_2, (QuadEqRootState)slot->numOfSols};
+        if (!appendSlot(&destination, slot->a, slot->b, slot->c, &answer))
+            error = QUAD_EQ_ERRORS_INVALID_FILE;
+        ++*numOfEntries;
+    }
+
+    // new file replaces old one atomically, readers of old file keep their mapping
+    if (error == QUAD_EQ_ERRORS_OK && (msync(destination.mapping, destination.mappingSize, MS_SYNC) == -1 ||
+                                       rename(tmpName, fileName) == -1))
+        error = QUAD_EQ_ERRORS_INVALID_FILE;
+    if (error != QUAD_EQ_ERRORS_OK)
+        unlink(tmpName);
+
+    if (destination.fd != -1)
+        closeStoreFile(&destination);
+    closeStoreFile(&source);
+    free(tmpName);
+    if (error != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(error);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+SolutionsStoreStats getSolutionsStoreStats() {
+    SolutionsStoreStats stats = {};
+    stats.numOfHits     = numOfHits    .load(std::memory_order_relaxed);
+    stats.numOfMisses   = numOfMisses  .load(std::memory_order_relaxed);
+    stats.numOfAppended = numOfAppended.load(std::memory_order_relaxed);
+    stats.numOfDropped  = numOfDropped .load(std::memory_order_relaxed);
+    return stats;
+}
+
+void resetSolutionsStoreStats() {
+    numOfHits    .store(0, std::memory_order_relaxed);
+    numOfMisses  .store(0, std::memory_order_relaxed);
+    numOfAppended.store(0, std::memory_order_relaxed);
+    numOfDropped .store(0, std::memory_order_relaxed);
+}
+
+void printSolutionsStoreStats(FILE* stream) {
+    ///\throw stream should not be NULL
+    assert(stream != NULL);
+
+    SolutionsStoreStats stats = getSolutionsStoreStats();
+    unsigned long long numOfLookups = stats.numOfHits + stats.numOfMisses;
+    double hitRate = numOfLookups == 0 ? 0 : 100.0 * (double)stats.numOfHits / (double)numOfLookups;
+    fprintf(stream, "Solutions store: %llu hits, %llu misses, %llu appended, %llu dropped, %.3f%% hit rate\n",
+            stats.numOfHits, stats.numOfMisses, stats.numOfAppended, stats.numOfDropped, hitRate);
+    if (stats.numOfDropped != 0 && storeFile.isWriter)
+        fprintf(stream, "Solutions store is full, run --compact-store to make it bigger\n");
+}
@@ -0,0 +1,210 @@
+/**
+    \file
+    \brief realization of registry of solver implementations and their autotuning
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "../include/solverRegistry.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/adaptiveSolver.hpp"
+#include "../include/solverTiming.hpp"
+#include "../include/errorReporting.hpp"
+
+const double BRANCH_FREE_EPSILON = SolverPrecisionTraits<double>::EPSILON;
+
+/// @brief validates coefficients in long double, so all implementations reject the same equations
+static QuadEqErrors checkEquationCoefs(const QuadraticEquation* eq, const QuadraticEquationAnswer* answer) {
+    ///\throw eq should not be NULL
+    ///\throw answer should not be NULL
+    assert(eq != NULL);
+    assert(answer != NULL);
+
+    if (eq == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (!isCoefValidT<long double>(eq->a) || !isCoefValidT<long double>(eq->b) || !isCoefValidT<long double>(eq->c))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+// --------------------------   IMPLEMENTATIONS   ---------------------------------
+
+/// @brief solver core in given type, roots are converted back to long double
+template <typename Scalar>
+static QuadEqErrors getSolutionsInType(const QuadraticEquation* eq, QuadraticEquationAnswer* answer) {
+    QuadEqErrors error = checkEquationCoefs(eq, answer);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    // roots are not changed, if equation has no roots, as in getSolutions()
+    Scalar root_1 = 0, root_2 = 0;
+    solveValidatedEquationT<Scalar>((Scalar)eq->a, (Scalar)eq->b, (Scalar)eq->c, &root_1, &root_2, &answer->numOfSols);
+    if (answer->numOfSols == ONE_ROOT || answer->numOfSols == TWO_ROOTS) {
+        answer->root_1 = (long double)root_1;
+        answer->root_2 = (long double)root_2;
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief same formulas as SIMD kernels (see quadraticEquationSimd.cpp): every case is computed, result is selected
+static QuadEqErrors getSolutionsBranchFree(const QuadraticEquation* eq, QuadraticEquationAnswer* answer) {
+    QuadEqErrors error = checkEquationCoefs(eq, answer);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    double a = (double)eq->a;
+    double b = (double)eq->b;
+    double c = (double)eq->c;
+
+    // & instead of &&, so conditions don't become branches
+    bool aZero    = (a >= -BRANCH_FREE_EPSILON) & (a <= BRANCH_FREE_EPSILON);
+    bool bZero    = (b >= -BRANCH_FREE_EPSILON) & (b <= BRANCH_FREE_EPSILON);
+    bool cZero    = (c >= -BRANCH_FREE_EPSILON) & (c <= BRANCH_FREE_EPSILON);
+
+    double disc   = b * b - 4 * a * c;
+    bool discNeg  = disc < -BRANCH_FREE_EPSILON;
+    bool discZero = (disc >= -BRANCH_FREE_EPSILON) & (disc <= BRANCH_FREE_EPSILON);
+
+    // division by zero gives inf or nan, such values are never selected
+    double discRoot  = sqrt(disc > 0 ? disc : 0);
+    double denom     = 1 / (2 * a);
+    double quadRoot1 = (-b - discRoot) * denom;
+    double quadRoot2 = discZero ? quadRoot1 : (-b + discRoot) * denom;
+    double linRoot   = bZero ? 0 : -c / b;
+
+    int quadCnt = discNeg ? NO_ROOTS : (discZero ? ONE_ROOT : TWO_ROOTS);
+    int linCnt  = bZero ? (cZero ? INFINITE_ROOTS : NO_ROOTS) : ONE_ROOT;
+
+    answer->numOfSols = (QuadEqRootState)(aZero ? linCnt : quadCnt);
+    answer->root_1    = aZero ? linRoot : (discNeg ? 0 : quadRoot1);
+    answer->root_2    = aZero ? linRoot : (discNeg ? 0 : quadRoot2);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+// --------------------------   REGISTRY   ---------------------------------
+
+static SolverImplementation registry[SOLVER_REGISTRY_CAPACITY] = {
+    {"long-double", "solver core in long double, getSolutions()",                  &getSolutions},
+    {"double",      "solver core in double",                                       &getSolutionsInType<double>},
+    {"branch-free", "double, cases are selected without branches (as SIMD kernels)", &getSolutionsBranchFree},
+    {"adaptive",    "double, escalates to long double near classification bounds", &getSolutionsAdaptive},
+#ifdef QUAD_SOLVER_HAS_FLOAT128
+    {"reference",   "solver core in __float128, slow",                             &getSolutionsInType<__float128>},
+#endif
+};
+
+/// @brief built-in implementations occupy the beginning of registry
+static size_t countBuiltinSolvers() {
+    size_t count = 0;
+    while (count < SOLVER_REGISTRY_CAPACITY && registry[count].name != NULL)
+        ++count;
+    return count;
+}
+
+static size_t numOfSolvers = countBuiltinSolvers();
+
+QuadEqErrors registerSolver(const char* name, const char* description, getSolutionsFuncPtr solver) {
+    ///\throw name should not be NULL
+    ///\throw solver should not be NULL
+    assert(name != NULL);
+    assert(solver != NULL);
+
+    if (name == NULL || solver == NULL || strcmp(name, SOLVER_AUTO_NAME) == 0 || findSolver(name) != NULL ||
+        numOfSolvers == SOLVER_REGISTRY_CAPACITY)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    registry[numOfSolvers++] = {name, description != NULL ? description : "", solver};
+    return QUAD_EQ_ERRORS_OK;
+}
+
+size_t getNumOfSolvers() {
+    return numOfSolvers;
+}
+
+const SolverImplementation* getSolverImplementation(size_t index) {
+    return index < numOfSolvers ? &registry[index] : NULL;
+}
+
+const SolverImplementation* findSolver(const char* name) {
+    ///\throw name should not be NULL
+    assert(name != NULL);
+    if (name == NULL)
+        return NULL;
+
+    for (size_t i = 0; i < numOfSolvers; ++i)
+        if (strcmp(registry[i].name, name) == 0)
+            return &registry[i];
+    return NULL;
+}
+
+// --------------------------   AUTOTUNING   ---------------------------------
+
+QuadEqErrors calibrateSolvers(const struct Test* tests, size_t numOfTests, struct SolverCalibration* results,
+                              const struct SolverImplementation** fastest) {
+    ///\throw tests should not be NULL
+    ///\throw results should not be NULL
+    ///\throw fastest should not be NULL
+    assert(tests != NULL);
+    assert(results != NULL);
+    assert(fastest != NULL);
+
+    if (tests == NULL || results == NULL || fastest == NULL || numOfTests == 0 || numOfTests > INT_MAX)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    *fastest = NULL;
+    double fastestNs = 0;
+    for (size_t i = 0; i < numOfSolvers; ++i) {
+        // failed tests are not printed, verdict is printed by printSolverCalibration()
+        Tester tester = {};
+        tester.cntOfTests       = (int)numOfTests;
+        tester.tests            = tests;
+        tester.GetSolutionsFunc = registry[i].solver;
+        tester.isQuiet          = true;
+        CheckOnTestsOutput check = checkOnTests(&tester);
+
+        SolverCalibration* result = &results[i];
+        result->implementation = &registry[i];
+        result->isPassed       = check.state == ALL_TESTS_PASSED;
+        result->failedTest     = check.testIndex;
+        result->nsPerEquation  = measureSolverSpeed(registry[i].solver, tests, numOfTests, SOLVER_CALIBRATION_NUM_OF_RUNS);
+
+        if (result->isPassed && (*fastest == NULL || result->nsPerEquation < fastestNs)) {
+            *fastest  = &registry[i];
+            fastestNs = result->nsPerEquation;
+        }
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
+
+void printSolverCalibration(const struct SolverCalibration* results, size_t numOfResults,
+                            const struct SolverImplementation* chosen, FILE* stream) {
+    ///\throw results should not be NULL
+    ///\throw stream should not be NULL
+    assert(results != NULL);
+    assert(stream != NULL);
+
+    for (size_t i = 0; i < numOfResults; ++i) {
+        const SolverCalibration* result = &results[i];
+        fprintf(stream, "%s %-12s %8.2f ns/equation  ", result->implementation == chosen ? "*" : " ",
+                result->implementation->name, result->nsPerEquation);
+        if (result->isPassed)
+            fprintf(stream, "passed\n");
+        else
+            fprintf(stream, "failed on test #%d\n", result->failedTest);
+    }
+}
+
+void printSolverNames(FILE* stream) {
+    ///\throw stream should not be NULL
+    assert(stream != NULL);
+
+    for (size_t i = 0; i < numOfSolvers; ++i)
+        fprintf(stream, "  %-12s %s\n", registry[i].name, registry[i].description);
+    fprintf(stream, "  %-12s fastest of them, that passes tests on generated corpus\n", SOLVER_AUTO_NAME);
+}
@@ -0,0 +1,638 @@
+/**
+    \file
+    \brief realization of resident solver over unix domain socket and of it's client
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+
+#include "../include/solverServer.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+/// @brief maximum number of events, that are taken from epoll at once
+const int    SERVER_MAX_EVENTS     = 64;
+/// @brief size of block, that is read from socket at once
+const size_t SERVER_READ_BLOCK     = 1 << 16;
+/// @brief maximum number of not accepted connections
+const int    SERVER_LISTEN_BACKLOG = 128;
+/// @brief received bytes of one connection are not read further, so biggest request always fits
+const size_t SERVER_MAX_INPUT_SIZE = sizeof(SolverRequestHeader) +
+                                     SOLVER_SERVER_MAX_EQUATIONS * sizeof(SolverRequestEquation);
+/// @brief requests of connection are not read, while it has more unsent bytes, client with two requests in flight
+///        (see solveOnSolverServer()) never reaches it
+const size_t SERVER_MAX_OUTPUT_SIZE = 2 * (sizeof(SolverResponseHeader) +
+                                           SOLVER_SERVER_MAX_EQUATIONS * sizeof(SolverResponseAnswer));
+
+/// @brief what descriptor of epoll event is
+enum ServerEndpointKind {
+    SERVER_ENDPOINT_LISTENER = 0,
+    SERVER_ENDPOINT_SIGNAL   = 1,
+    SERVER_ENDPOINT_CLIENT   = 2,
+};
+
+/// @brief growable array of bytes
+struct ServerBuffer {
+    char*  data;
+    size_t size;
+    size_t capacity;
+};
+
+/// @brief one descriptor of epoll, pointer to it is stored in event
+struct ServerEndpoint {
+    ServerEndpointKind kind;
+    int                fd;
+    ServerBuffer       input;          ///< received bytes, that are not parsed yet
+    ServerBuffer       output;         ///< responses, that are not sent yet
+    size_t             outputOffset;   ///< number of sent bytes of output
+    bool               isWaitingOutput; ///< EPOLLOUT is enabled
+    bool               isInputPaused;  ///< EPOLLIN is disabled, because client doesn't read it's responses
+    bool               isClosing;      ///< connection is closed, when it's output is sent
+    bool               isLingering;    ///< closing connection, that waits only for sending of it's output
+    bool               isBroken;       ///< output can't be sent, it's dropped
+};
+
+/// @brief one request, that is solved in current wakeup
+struct ServerJob {
+    ServerEndpoint* client;
+    size_t          first;  ///< index of first equation in batch
+    uint32_t        count;
+    QuadEqErrors    status;
+};
+
+/// @brief all equations of current wakeup (structure of arrays) and their requests
+struct ServerBatch {
+    size_t count;
+    size_t capacity;
+    double*          a;
+    double*          b;
+    double*          c;
+    double*          root_1;
+    double*          root_2;
+    QuadEqRootState* numOfSols;
+
+    ServerJob* jobs;
+    size_t     numOfJobs;
+    size_t     jobsCapacity;
+
+    ServerEndpoint** closing;         ///< connections, that are closed after current wakeup
+    size_t           numOfClosing;
+    size_t           closingCapacity;
+};
+
+/// @brief makes sure that buffer has place for size more bytes
+static bool reserveBuffer(ServerBuffer* buffer, size_t size) {
+    if (buffer->capacity - buffer->size >= size)
+        return true;
+
+    size_t capacity = buffer->capacity == 0 ? SERVER_READ_BLOCK : buffer->capacity;
+    while (capacity - buffer->size < size)
+        capacity *= 2;
+    char* data = (char*)realloc(buffer->data, capacity);
+    if (data == NULL)
+        return false;
+    buffer->data     = data;
+    buffer->capacity = capacity;
+    return true;
+}
+
+/// @brief makes sure that all arrays of batch have place for count more equations
+static bool reserveBatch(ServerBatch* batch, size_t count) {
+    if (batch->capacity - batch->count >= count)
+        return true;
+
+    size_t capacity = batch->capacity == 0 ? PARALLEL_CHUNK_SIZE : batch->capacity;
+    while (capacity - batch->count < count)
+        capacity *= 2;
+
+    double** arrays[] = {&batch->a, &batch->b, &batch->c, &batch->root_1, &batch->root_2};
+    for (size_t i = 0; i < sizeof(arrays) / sizeof(*arrays); ++i) {
+        double* array = (double*)realloc(*arrays[i], capacity * sizeof(double));
+        if (array == NULL)
+            return false;
+        *arrays[i] = array;
+    }
+    QuadEqRootState* numOfSols = (QuadEqRootState*)realloc(batch->numOfSols, capacity * sizeof(QuadEqRootState));
+    if (numOfSols == NULL)
+        return false;
+    batch->numOfSols = numOfSols;
+    batch->capacity  = capacity;
+    return true;
+}
+
+static bool addJob(ServerBatch* batch, const ServerJob* job) {
+    if (batch->numOfJobs == batch->jobsCapacity) {
+        size_t capacity = batch->jobsCapacity == 0 ? SERVER_MAX_EVENTS : batch->jobsCapacity * 2;
+        ServerJob* jobs = (ServerJob*)realloc(batch->jobs, capacity * sizeof(ServerJob));
+        if (jobs == NULL)
+            return false;
+        batch->jobs         = jobs;
+        batch->jobsCapacity = capacity;
+    }
+    batch->jobs[batch->numOfJobs++] = *job;
+    return true;
+}
+
+/// @brief marks connection, it's closed after responses of current wakeup are written
+static void markClosing(ServerBatch* batch, ServerEndpoint* client) {
+    if (client->isClosing)
+        return;
+
+    if (batch->numOfClosing == batch->closingCapacity) {
+        size_t capacity = batch->closingCapacity == 0 ? SERVER_MAX_EVENTS : batch->closingCapacity * 2;
+        ServerEndpoint** closing = (ServerEndpoint**)realloc(batch->closing, capacity * sizeof(ServerEndpoint*));
+        // without place in list connection can't be closed, it will be closed on next wakeup
+        if (closing == NULL)
+            return;
+        batch->closing         = closing;
+        batch->closingCapacity = capacity;
+    }
+    client->isClosing = true;
+    batch->closing[batch->numOfClosing++] = client;
+}
+
+static void freeBatch(ServerBatch* batch) {
+    free(batch->a);
+    free(batch->b);
+    free(batch->c);
+    free(batch->root_1);
+    free(batch->root_2);
+    free(batch->numOfSols);
+    free(batch->jobs);
+    free(batch->closing);
+    *batch = {};
+}
+
+static void freeEndpoint(ServerEndpoint* endpoint) {
+    if (endpoint->fd != -1)
+        close(endpoint->fd);
+    free(endpoint->input.data);
+    free(endpoint->output.data);
+    free(endpoint);
+}
+
+/// @brief copies equations of request to the end of batch (without increasing count), returns false if any is invalid
+static bool copyRequest(ServerBatch* batch, const char* request, uint32_t count) {
+    bool isValid = true;
+    for (uint32_t i = 0; i < count; ++i) {
+        // input buffer is not aligned for double, so every equation is copied
+        SolverRequestEquation equation = {};
+        memcpy(&equation, request + i * sizeof(equation), sizeof(equation));
+        batch->a[batch->count + i] = equation.a;
+        batch->b[batch->count + i] = equation.b;
+        batch->c[batch->count + i] = equation.c;
+        isValid &= isCoefValidT<double>(equation.a) && isCoefValidT<double>(equation.b) &&
+                   isCoefValidT<double>(equation.c);
+    }
+    return isValid;
+}
+
+/// @brief parses all complete requests of connection and adds them to batch
+static void parseRequests(ServerBatch* batch, ServerEndpoint* client) {
+    size_t offset = 0;
+    while (client->input.size - offset >= sizeof(SolverRequestHeader)) {
+        SolverRequestHeader header = {};
+        memcpy(&header, client->input.data + offset, sizeof(header));
+        // broken stream can't be resynchronized
+        if (header.magic != SOLVER_REQUEST_MAGIC || header.count > SOLVER_SERVER_MAX_EQUATIONS) {
+            markClosing(batch, client);
+            break;
+        }
+
+        size_t frameSize = sizeof(header) + header.count * sizeof(SolverRequestEquation);
+        if (client->input.size - offset < frameSize)
+            break;
+
+        ServerJob job = {client, batch->count, header.count, QUAD_EQ_ERRORS_OK};
+        if (!reserveBatch(batch, header.count))
+            job.status = QUAD_EQ_ERRORS_MEMORY_ALLOCATION;
+        else if (!copyRequest(batch, client->input.data + offset + sizeof(header), header.count))
+            job.status = QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG;
+        else
+            batch->count += header.count;
+
+        if (!addJob(batch, &job)) {
+            markClosing(batch, client);
+            break;
+        }
+        offset += frameSize;
+    }
+
+    memmove(client->input.data, client->input.data + offset, client->input.size - offset);
+    client->input.size -= offset;
+}
+
+/// @brief reads everything, that is available on connection, but not more than SERVER_MAX_INPUT_SIZE bytes
+static void readClient(ServerBatch* batch, ServerEndpoint* client) {
+    // the rest stays in socket, it's read on next wakeup after parsed requests free input
+    while (client->input.size < SERVER_MAX_INPUT_SIZE) {
+        size_t blockSize = SERVER_MAX_INPUT_SIZE - client->input.size;
+        if (blockSize > SERVER_READ_BLOCK)
+            blockSize = SERVER_READ_BLOCK;
+        if (!reserveBuffer(&client->input, blockSize)) {
+            markClosing(batch, client);
+            return;
+        }
+
+        ssize_t len = read(client->fd, client->input.data + client->input.size, blockSize);
+        if (len > 0) {
+            client->input.size += (size_t)len;
+            continue;
+        }
+        if (len == -1 && errno == EINTR)
+            continue;
+        // connection is closed by client (or broken), requests, that were fully read, are still answered
+        if (len == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            markClosing(batch, client);
+        break;
+    }
+    parseRequests(batch, client);
+}
+
+/// @brief writes as much of output as socket takes, enables EPOLLOUT if something is left
+static void flushClient(int epollFd, ServerBatch* batch, ServerEndpoint* client) {
+    while (client->outputOffset < client->output.size) {
+        ssize_t len = send(client->fd, client->output.data + client->outputOffset,
+                           client->output.size - client->outputOffset, MSG_NOSIGNAL);
+        if (len > 0) {
+            client->outputOffset += (size_t)len;
+            continue;
+        }
+        if (len == -1 && errno == EINTR)
+            continue;
+        if (len == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        client->isBroken = true;
+        markClosing(batch, client);
+        return;
+    }
+
+    bool isWaitingOutput = client->outputOffset < client->output.size;
+    if (!isWaitingOutput)
+        client->output.size = client->outputOffset = 0;
+    // output can't grow without limit, reading is continued, when socket takes enough of it
+    bool isInputPaused = client->output.size - client->outputOffset > SERVER_MAX_OUTPUT_SIZE;
+    // lingering connection waits only for EPOLLOUT
+    if (client->isLingering)
+        return;
+    if (isWaitingOutput != client->isWaitingOutput || isInputPaused != client->isInputPaused) {
+        epoll_event event = {};
+        event.events   = (isInputPaused ? 0u : (uint32_t)EPOLLIN) | (isWaitingOutput ? (uint32_t)EPOLLOUT : 0u);
+        event.data.ptr = client;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, client->fd, &event);
+        client->isWaitingOutput = isWaitingOutput;
+        client->isInputPaused   = isInputPaused;
+    }
+}
+
+/// @brief appends response to output of connection
+static void appendResponse(ServerBatch* batch, const ServerJob* job) {
+    ServerEndpoint* client = job->client;
+    uint32_t count = job->status == QUAD_EQ_ERRORS_OK ? job->count : 0;
+    if (!reserveBuffer(&client->output, sizeof(SolverResponseHeader) + count * sizeof(SolverResponseAnswer))) {
+        markClosing(batch, client);
+        return;
+    }
+
+    SolverResponseHeader header = {SOLVER_RESPONSE_MAGIC, (uint32_t)job->status, count, 0};
+    memcpy(client->output.data + client->output.size, &header, sizeof(header));
+    client->output.size += sizeof(header);
+    for (uint32_t i = 0; i < count; ++i) {
+        size_t index = job->first + i;
+        SolverResponseAnswer answer = {batch->root_1[index], batch->root_2[index], (uint32_t)batch->numOfSols[index], 0};
+        memcpy(client->output.data + client->output.size, &answer, sizeof(answer));
+        client->output.size += sizeof(answer);
+    }
+}
+
+/// @brief solves all requests of current wakeup, writes responses and closes marked connections
+static void processBatch(int epollFd, ServerBatch* batch, ThreadPool* pool) {
+    QuadraticEquationDoubleBatch       equations = {batch->count, batch->a, batch->b, batch->c};
+    QuadraticEquationDoubleBatchAnswer answers   = {batch->root_1, batch->root_2, batch->numOfSols};
+    // all requests are validated already, so batch can't fail
+    if (batch->count != 0)
+        getSolutionsBatchSimdParallel(pool, &equations, &answers);
+
+    // closing connections get responses too, client could only shut down it's side of socket
+    for (size_t i = 0; i < batch->numOfJobs; ++i)
+        appendResponse(batch, &batch->jobs[i]);
+    for (size_t i = 0; i < batch->numOfJobs; ++i)
+        if (batch->jobs[i].client->output.size != 0)
+            flushClient(epollFd, batch, batch->jobs[i].client);
+
+    for (size_t i = 0; i < batch->numOfClosing; ++i) {
+        ServerEndpoint* client = batch->closing[i];
+        // socket didn't take all responses, they are sent on EPOLLOUT, requests are not read any more
+        if (!client->isBroken && client->outputOffset < client->output.size) {
+            epoll_event event = {};
+            event.events   = EPOLLOUT;
+            event.data.ptr = client;
+            epoll_ctl(epollFd, EPOLL_CTL_MOD, client->fd, &event);
+            client->isLingering = true;
+            continue;
+        }
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, client->fd, NULL);
+        freeEndpoint(client);
+    }
+
+    batch->count = batch->numOfJobs = batch->numOfClosing = 0;
+}
+
+/// @brief sends output of closing connection, frees connection, when everything is sent or client is gone
+static void flushLingeringClient(int epollFd, ServerBatch* batch, ServerEndpoint* client, uint32_t events) {
+    if (events & (EPOLLHUP | EPOLLERR))
+        client->isBroken = true;
+    else if (events & EPOLLOUT)
+        flushClient(epollFd, batch, client);
+
+    if (client->isBroken || client->outputOffset == client->output.size) {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, client->fd, NULL);
+        freeEndpoint(client);
+    }
+}
+
+/// @brief accepts all waiting connections
+static void acceptClients(int epollFd, ServerEndpoint* listener) {
+    while (true) {
+        int fd = accept4(listener->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1)
+            return;
+
+        ServerEndpoint* client = (ServerEndpoint*)calloc(1, sizeof(ServerEndpoint));
+        if (client == NULL) {
+            close(fd);
+            continue;
+        }
+        client->kind = SERVER_ENDPOINT_CLIENT;
+        client->fd   = fd;
+
+        epoll_event event = {};
+        event.events   = EPOLLIN;
+        event.data.ptr = client;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == -1)
+            freeEndpoint(client);
+    }
+}
+
+/// @brief creates listening socket
+static QuadEqErrors createListener(const char* socketPath, int* fd) {
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (strlen(socketPath) >= sizeof(address.sun_path))
+        return QUAD_EQ_ERRORS_ILLEGAL_ARG;
+    strcpy(address.sun_path, socketPath);
+
+    *fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (*fd == -1)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+
+    unlink(socketPath);
+    if (bind(*fd, (const sockaddr*)&address, sizeof(address)) == -1 || listen(*fd, SERVER_LISTEN_BACKLOG) == -1) {
+        close(*fd);
+        *fd = -1;
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief write end of pipe, that wakes up epoll loop, when SIGINT or SIGTERM arrives
+static int stopPipeWriteFd = -1;
+
+static void handleStopSignal(int) {
+    // signal can be delivered to any thread (for example to thread of pool), so it's only forwarded to loop
+    int savedErrno = errno;
+    char byte = 0;
+    ssize_t len = write(stopPipeWriteFd, &byte, 1);
+    (void)len;
+    errno = savedErrno;
+}
+
+/// @brief installs handlers of SIGINT and SIGTERM, returns read end of pipe, that becomes readable on signal
+static int createStopPipe(struct sigaction oldActions[2]) {
+    int fds[2] = {-1, -1};
+    if (pipe2(fds, O_NONBLOCK | O_CLOEXEC) == -1)
+        return -1;
+    stopPipeWriteFd = fds[1];
+
+    struct sigaction action = {};
+    action.sa_handler = &handleStopSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT,  &action, &oldActions[0]);
+    sigaction(SIGTERM, &action, &oldActions[1]);
+    return fds[0];
+}
+
+static void destroyStopPipe(int readFd, const struct sigaction oldActions[2]) {
+    sigaction(SIGINT,  &oldActions[0], NULL);
+    sigaction(SIGTERM, &oldActions[1], NULL);
+    close(readFd);
+    close(stopPipeWriteFd);
+    stopPipeWriteFd = -1;
+}
+
+QuadEqErrors runSolverServer(const char* socketPath, struct ThreadPool* pool) {
+    ///\throw socketPath should not be NULL
+    assert(socketPath != NULL);
+
+    if (socketPath == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    struct sigaction oldActions[2] = {};
+    ServerEndpoint listener   = {};
+    ServerEndpoint signalStop = {};
+    listener  .kind = SERVER_ENDPOINT_LISTENER;
+    signalStop.kind = SERVER_ENDPOINT_SIGNAL;
+    signalStop.fd   = createStopPipe(oldActions);
+    int epollFd     = epoll_create1(EPOLL_CLOEXEC);
+    QuadEqErrors error = signalStop.fd == -1 || epollFd == -1 ? QUAD_EQ_ERRORS_INVALID_FILE :
+                                                                createListener(socketPath, &listener.fd);
+    if (error != QUAD_EQ_ERRORS_OK) {
+        if (signalStop.fd != -1) destroyStopPipe(signalStop.fd, oldActions);
+        if (epollFd != -1)       close(epollFd);
+        LOG_AND_RETURN(error);
+    }
+
+    ServerEndpoint* endpoints[] = {&listener, &signalStop};
+    for (size_t i = 0; i < sizeof(endpoints) / sizeof(*endpoints); ++i) {
+        epoll_event event = {};
+        event.events   = EPOLLIN;
+        event.data.ptr = endpoints[i];
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, endpoints[i]->fd, &event);
+    }
+    QUAD_EQ_LOG_INFO("Solver server listens on %s\n", socketPath);
+
+    ServerBatch batch = {};
+    bool isStopping = false;
+    epoll_event events[SERVER_MAX_EVENTS] = {};
+    while (!isStopping) {
+        int numOfEvents = epoll_wait(epollFd, events, SERVER_MAX_EVENTS, -1);
+        if (numOfEvents == -1 && errno == EINTR)
+            continue;
+        if (numOfEvents == -1) {
+            error = QUAD_EQ_ERRORS_INVALID_FILE;
+            break;
+        }
+
+        for (int i = 0; i < numOfEvents; ++i) {
+            ServerEndpoint* endpoint = (ServerEndpoint*)events[i].data.ptr;
+            switch (endpoint->kind) {
+                case SERVER_ENDPOINT_LISTENER:
+                    acceptClients(epollFd, endpoint);
+                    break;
+                case SERVER_ENDPOINT_SIGNAL:
+                    isStopping = true;
+                    break;
+                case SERVER_ENDPOINT_CLIENT:
+                    if (endpoint->isLingering) {
+                        flushLingeringClient(epollFd, &batch, endpoint, events[i].events);
+                        break;
+                    }
+                    if (events[i].events & EPOLLOUT)
+                        flushClient(epollFd, &batch, endpoint);
+                    // EPOLLHUP and EPOLLERR come even without EPOLLIN, paused connection is not read anyway
+                    if (!endpoint->isInputPaused && (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+                        readClient(&batch, endpoint);
+                    break;
+                default:
+                    assert(false);
+                    break;
+            }
+        }
+        processBatch(epollFd, &batch, pool);
+    }
+
+    // connections, that are still opened, are closed by exit of process, only socket file is removed
+    QUAD_EQ_LOG_INFO("Solver server on %s is stopped\n", socketPath);
+    freeBatch(&batch);
+    close(listener.fd);
+    destroyStopPipe(signalStop.fd, oldActions);
+    close(epollFd);
+    unlink(socketPath);
+    return error;
+}
+
+QuadEqErrors connectToSolverServer(const char* socketPath, int* fd) {
+    ///\throw socketPath should not be NULL
+    ///\throw fd should not be NULL
+    assert(socketPath != NULL);
+    assert(fd != NULL);
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (socketPath == NULL || fd == NULL || strlen(socketPath) >= sizeof(address.sun_path))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    strcpy(address.sun_path, socketPath);
+
+    *fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (*fd == -1)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    if (connect(*fd, (const sockaddr*)&address, sizeof(address)) == -1) {
+        close(*fd);
+        *fd = -1;
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    }
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief sends (or receives) exactly size bytes
+static bool transferAll(int fd, void* data, size_t size, bool isSending) {
+    char* bytes = (char*)data;
+    while (size > 0) {
+        ssize_t len = isSending ? send(fd, bytes, size, MSG_NOSIGNAL) : recv(fd, bytes, size, 0);
+        if (len == -1 && errno == EINTR)
+            continue;
+        if (len <= 0)
+            return false;
+        bytes += len;
+        size  -= (size_t)len;
+    }
+    return true;
+}
+
+/// @brief number of equations in request, that starts with equation first of batch
+static uint32_t getRequestCount(const QuadraticEquationDoubleBatch* batch, size_t first) {
+    size_t count = batch->count - first;
+    return count < SOLVER_SERVER_MAX_EQUATIONS ? (uint32_t)count : SOLVER_SERVER_MAX_EQUATIONS;
+}
+
+/// @brief sends one request with equations [first, first + count) of batch
+static bool sendRequest(int fd, const QuadraticEquationDoubleBatch* batch, size_t first, uint32_t count) {
+    SolverRequestHeader header = {SOLVER_REQUEST_MAGIC, count};
+    SolverRequestEquation* equations = (SolverRequestEquation*)malloc(count * sizeof(SolverRequestEquation) + 1);
+    if (equations == NULL)
+        return false;
+
+    for (uint32_t i = 0; i < count; ++i)
+        equations[i] = {batch->a[first + i], batch->b[first + i], batch->c[first + i]};
+    bool isOk = transferAll(fd, &header, sizeof(header), true) &&
+                transferAll(fd, equations, count * sizeof(SolverRequestEquation), true);
+    free(equations);
+    return isOk;
+}
+
+/// @brief receives response to request with equations [first, first + count) of batch
+static QuadEqErrors receiveResponse(int fd, QuadraticEquationDoubleBatchAnswer* answer, size_t first, uint32_t count) {
+    SolverResponseHeader header = {};
+    if (!transferAll(fd, &header, sizeof(header), false) || header.magic != SOLVER_RESPONSE_MAGIC)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+    if (header.status != QUAD_EQ_ERRORS_OK)
+        return (QuadEqErrors)header.status;
+    if (header.count != count)
+        return QUAD_EQ_ERRORS_INVALID_FILE;
+
+    SolverResponseAnswer* answers = (SolverResponseAnswer*)malloc(count * sizeof(SolverResponseAnswer) + 1);
+    if (answers == NULL)
+        return QUAD_EQ_ERRORS_MEMORY_ALLOCATION;
+    bool isOk = transferAll(fd, answers, count * sizeof(SolverResponseAnswer), false);
+    for (uint32_t i = 0; isOk && i < count; ++i) {
+        answer->root_1   [first + i] = answers[i].root_1;
+        answer->root_2   [first + i] = answers[i].root_2;
+        answer->numOfSols[first + i] = (QuadEqRootState)answers[i].numOfSols;
+    }
+    free(answers);
+    return isOk ? QUAD_EQ_ERRORS_OK : QUAD_EQ_ERRORS_INVALID_FILE;
+}
+
+QuadEqErrors solveOnSolverServer(int fd, const struct QuadraticEquationDoubleBatch* batch,
+                                 struct QuadraticEquationDoubleBatchAnswer* answer) {
+    ///\throw batch should not be NULL
+    ///\throw answer should not be NULL
+    assert(batch != NULL);
+    assert(answer != NULL);
+
+    if (fd == -1 || batch == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // next request is sent before response to previous one is read, so server is never idle, but at most two
+    // requests are in flight, otherwise server stops reading of connection, while client is blocked on sending
+    QuadEqErrors error = QUAD_EQ_ERRORS_OK;
+    for (size_t first = 0; first < batch->count + SOLVER_SERVER_MAX_EQUATIONS; first += SOLVER_SERVER_MAX_EQUATIONS) {
+        if (first < batch->count && !sendRequest(fd, batch, first, getRequestCount(batch, first)))
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+        if (first == 0)
+            continue;
+
+        size_t previous = first - SOLVER_SERVER_MAX_EQUATIONS;
+        QuadEqErrors requestError = receiveResponse(fd, answer, previous, getRequestCount(batch, previous));
+        // all responses are read anyway, so connection stays in sync
+        if (requestError == QUAD_EQ_ERRORS_INVALID_FILE || requestError == QUAD_EQ_ERRORS_MEMORY_ALLOCATION)
+            LOG_AND_RETURN(requestError);
+        if (error == QUAD_EQ_ERRORS_OK)
+            error = requestError;
+    }
+    return error;
+}
+
+void disconnectFromSolverServer(int fd) {
+    if (fd != -1)
+        close(fd);
+}
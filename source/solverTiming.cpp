@@ -0,0 +1,42 @@
+/**
+    \file
+    \brief realization of measuring of time
+*/
+
+#include <assert.h>
+#include <time.h>
+
+#include "../include/solverTiming.hpp"
+
+uint64_t getMonotonicTimeNs() {
+    struct timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+double measureSolverSpeed(getSolutionsFuncPtr solver, const Test* tests, size_t numOfTests, int numOfRuns) {
+    ///\throw solver should not be NULL
+    ///\throw tests should not be NULL
+    ///\throw numOfTests should be positive
+    assert(solver != NULL);
+    assert(tests != NULL);
+    assert(numOfTests > 0);
+
+    uint64_t bestNs = UINT64_MAX;
+    // sum of roots is kept, so compiler can't throw calls away
+    volatile long double sink = 0;
+    for (int run = 0; run < numOfRuns; ++run) {
+        long double sum = 0;
+        uint64_t start = getMonotonicTimeNs();
+        for (size_t i = 0; i < numOfTests; ++i) {
+            QuadraticEquationAnswer answer = {};
+            solver(&tests[i].equation, &answer);
+            sum += answer.root_1;
+        }
+        uint64_t elapsedNs = getMonotonicTimeNs() - start;
+        sink = sum;
+        bestNs = elapsedNs < bestNs ? elapsedNs : bestNs;
+    }
+    (void)sink;
+    return (double)bestNs / (double)numOfTests;
+}
@@ -8,8 +8,10 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <limits.h>
 
 #include "../include/terminalArgs.hpp"
+#include "../include/errorReporting.hpp"
 #include "../LoggerLib/include/colourfullPrint.hpp"
 #include "../LoggerLib/include/logLib.hpp"
 
@@ -36,6 +38,52 @@ const char* OUTPUT_FLAG_SHORT    = "-o";
 const char* OUTPUT_FLAG_EXTENDED = "--output";
 const char* TESTS_FLAG_SHORT    = "-t";
 const char* TESTS_FLAG_EXTENDED = "--test";
+const char* EXACT_FLAG_SHORT    = "-e";
+const char* EXACT_FLAG_EXTENDED = "--exact";
+const char* BATCH_FLAG_SHORT    = "-b";
+const char* BATCH_FLAG_EXTENDED = "--batch";
+const char* BIN_INPUT_FLAG_SHORT     = "-bi";
+const char* BIN_INPUT_FLAG_EXTENDED  = "--bin-input";
+const char* BIN_OUTPUT_FLAG_SHORT    = "-bo";
+const char* BIN_OUTPUT_FLAG_EXTENDED = "--bin-output";
+const char* THREADS_FLAG_SHORT       = "-j";
+const char* THREADS_FLAG_EXTENDED    = "--threads";
+const char* CACHE_FLAG_SHORT         = "-c";
+const char* CACHE_FLAG_EXTENDED      = "--cache";
+const char* STORE_FLAG_SHORT         = "-s";
+const char* STORE_FLAG_EXTENDED      = "--store";
+const char* COMPACT_STORE_FLAG_SHORT    = "-cs";
+const char* COMPACT_STORE_FLAG_EXTENDED = "--compact-store";
+const char* SERVE_FLAG_SHORT         = "-sv";
+const char* SERVE_FLAG_EXTENDED      = "--serve";
+const char* CHANNEL_FLAG_SHORT       = "-ch";
+const char* CHANNEL_FLAG_EXTENDED    = "--channel";
+const char* GENERATE_FLAG_SHORT      = "-g";
+const char* GENERATE_FLAG_EXTENDED   = "--generate";
+const char* GEN_SEED_FLAG_SHORT      = "-gs";
+const char* GEN_SEED_FLAG_EXTENDED   = "--gen-seed";
+const char* GEN_MIX_FLAG_SHORT       = "-gm";
+const char* GEN_MIX_FLAG_EXTENDED    = "--gen-mix";
+const char* GEN_BINARY_FLAG_SHORT    = "-gb";
+const char* GEN_BINARY_FLAG_EXTENDED = "--gen-binary";
+const char* ACCURACY_FLAG_SHORT      = "-ac";
+const char* ACCURACY_FLAG_EXTENDED   = "--accuracy";
+const char* MAX_ULP_FLAG_SHORT       = "-mu";
+const char* MAX_ULP_FLAG_EXTENDED    = "--max-ulp";
+const char* SOLVER_FLAG_SHORT        = "-so";
+const char* SOLVER_FLAG_EXTENDED     = "--solver";
+
+/// @brief maximum number of threads, that user can ask for
+const unsigned long MAX_NUM_OF_THREADS = 1024;
+
+/// @brief maximum number of cached equations, that user can ask for (~80 bytes per entry)
+const unsigned long MAX_CACHE_CAPACITY = 1UL << 28;
+
+/// @brief maximum number of generated tests, that user can ask for (~50 bytes per test)
+const unsigned long MAX_NUM_OF_GENERATED_TESTS = 1UL << 40;
+
+/// @brief maximum error in ULP, that user can ask for
+const unsigned long MAX_ULP_LIMIT = 1UL << 62;
 
 static bool isKnownFlag(const char* flag) {
     const char* const arr[] = {
@@ -47,6 +95,40 @@ static bool isKnownFlag(const char* flag) {
         OUTPUT_FLAG_EXTENDED,
         TESTS_FLAG_SHORT,
         TESTS_FLAG_EXTENDED,
+        EXACT_FLAG_SHORT,
+        EXACT_FLAG_EXTENDED,
+        BATCH_FLAG_SHORT,
+        BATCH_FLAG_EXTENDED,
+        BIN_INPUT_FLAG_SHORT,
+        BIN_INPUT_FLAG_EXTENDED,
+        BIN_OUTPUT_FLAG_SHORT,
+        BIN_OUTPUT_FLAG_EXTENDED,
+        THREADS_FLAG_SHORT,
+        THREADS_FLAG_EXTENDED,
+        CACHE_FLAG_SHORT,
+        CACHE_FLAG_EXTENDED,
+        STORE_FLAG_SHORT,
+        STORE_FLAG_EXTENDED,
+        COMPACT_STORE_FLAG_SHORT,
+        COMPACT_STORE_FLAG_EXTENDED,
+        SERVE_FLAG_SHORT,
+        SERVE_FLAG_EXTENDED,
+        CHANNEL_FLAG_SHORT,
+        CHANNEL_FLAG_EXTENDED,
+        GENERATE_FLAG_SHORT,
+        GENERATE_FLAG_EXTENDED,
+        GEN_SEED_FLAG_SHORT,
+        GEN_SEED_FLAG_EXTENDED,
+        GEN_MIX_FLAG_SHORT,
+        GEN_MIX_FLAG_EXTENDED,
+        GEN_BINARY_FLAG_SHORT,
+        GEN_BINARY_FLAG_EXTENDED,
+        ACCURACY_FLAG_SHORT,
+        ACCURACY_FLAG_EXTENDED,
+        MAX_ULP_FLAG_SHORT,
+        MAX_ULP_FLAG_EXTENDED,
+        SOLVER_FLAG_SHORT,
+        SOLVER_FLAG_EXTENDED,
     };
 
     int arrLen = sizeof(arr) / sizeof(*arr);
@@ -76,7 +158,7 @@ void validateManager(const ArgsManager* manager) {
     for (int i = 1; i < manager->argc; ++i) {
         const char* flag = manager->argv[i];
         if (isParamFlag(flag) && !isKnownFlag(flag)) {
-            LOG_ERROR("%s", UNKNOWN_FLAGS_ERROR);
+            QUAD_EQ_LOG_ERROR("%s", UNKNOWN_FLAGS_ERROR);
             printError("%s", UNKNOWN_FLAGS_ERROR);
             return;
         }
@@ -135,19 +217,18 @@ static bool checkGoodParams(const ArgsManager* manager, int startInd, int cntNee
     return true;
 }
 
-const char* parseOutputFile(const ArgsManager* manager) {
-    ///\throw manager should not be NULL
-    ///\throw manager->argv should not be NULL
+/// @brief parses flag, that needs file argument, returns NULL if flag is not found or file is not stated
+static const char* parseFileArgument(const ArgsManager* manager, const char* flagShort, const char* flagExtended) {
     assert(manager       != NULL);
     assert(manager->argv != NULL);
 
-    int ind = findCommandIndex(manager, OUTPUT_FLAG_SHORT, OUTPUT_FLAG_EXTENDED);
-    // output file argument not found
+    int ind = findCommandIndex(manager, flagShort, flagExtended);
+    // file argument not found
     if (ind == -1) return NULL;
 
     const int numNeededArgs = 1;
     if (!checkGoodParams(manager, ind, numNeededArgs)) {
-        LOG_ERROR("%s", FILE_ARGUMENTS_ERROR);
+        QUAD_EQ_LOG_ERROR("%s", FILE_ARGUMENTS_ERROR);
         printError("%s", FILE_ARGUMENTS_ERROR);
         return NULL;
     }
@@ -155,6 +236,179 @@ const char* parseOutputFile(const ArgsManager* manager) {
     return manager->argv[ind + 1];
 }
 
+const char* parseOutputFile(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, OUTPUT_FLAG_SHORT, OUTPUT_FLAG_EXTENDED);
+}
+
+const char* parseBinInputFile(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, BIN_INPUT_FLAG_SHORT, BIN_INPUT_FLAG_EXTENDED);
+}
+
+const char* parseBinOutputFile(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, BIN_OUTPUT_FLAG_SHORT, BIN_OUTPUT_FLAG_EXTENDED);
+}
+
+/**
+    \brief parses flag, that needs non negative number argument
+    \param[in] maxValue maximum allowed number
+    \param[out] result parsed number, not changed if flag is not found
+    \result false if number is incorrect
+*/
+static bool parseNumberArgument(const ArgsManager* manager, const char* flagShort, const char* flagExtended,
+                                unsigned long maxValue, size_t* result) {
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+    assert(result        != NULL);
+
+    int ind = findCommandIndex(manager, flagShort, flagExtended);
+    if (ind == -1) return true;
+
+    const int numNeededArgs = 1;
+    if (!checkGoodParams(manager, ind, numNeededArgs)) {
+        QUAD_EQ_LOG_ERROR("%s", INCORRECT_USER_INPUT_ERROR);
+        printError("%s", INCORRECT_USER_INPUT_ERROR);
+        return false;
+    }
+
+    const char* number = manager->argv[ind + 1];
+    char* endPtr = NULL;
+    unsigned long value = strtoul(number, &endPtr, 10);
+    if (!isdigit(number[0]) || *endPtr != '\0' || value > maxValue) {
+        QUAD_EQ_LOG_ERROR("%s", INCORRECT_USER_INPUT_ERROR);
+        printError("%s", INCORRECT_USER_INPUT_ERROR);
+        return false;
+    }
+
+    *result = (size_t)value;
+    return true;
+}
+
+const char* parseStoreFile(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, STORE_FLAG_SHORT, STORE_FLAG_EXTENDED);
+}
+
+const char* parseCompactStoreFile(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, COMPACT_STORE_FLAG_SHORT, COMPACT_STORE_FLAG_EXTENDED);
+}
+
+const char* parseServeSocket(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, SERVE_FLAG_SHORT, SERVE_FLAG_EXTENDED);
+}
+
+const char* parseChannelName(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, CHANNEL_FLAG_SHORT, CHANNEL_FLAG_EXTENDED);
+}
+
+const char* parseSolverName(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+
+    return parseFileArgument(manager, SOLVER_FLAG_SHORT, SOLVER_FLAG_EXTENDED);
+}
+
+bool parseThreadsArg(const ArgsManager* manager, size_t* numOfThreads) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    ///\throw numOfThreads should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+    assert(numOfThreads  != NULL);
+
+    *numOfThreads = 1;
+    return parseNumberArgument(manager, THREADS_FLAG_SHORT, THREADS_FLAG_EXTENDED, MAX_NUM_OF_THREADS, numOfThreads);
+}
+
+bool parseCacheArg(const ArgsManager* manager, size_t* capacity) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    ///\throw capacity should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+    assert(capacity      != NULL);
+
+    *capacity = 0;
+    return parseNumberArgument(manager, CACHE_FLAG_SHORT, CACHE_FLAG_EXTENDED, MAX_CACHE_CAPACITY, capacity);
+}
+
+bool parseGenerateArgs(const ArgsManager* manager, size_t* numOfTests, CorpusGeneratorConfig* config,
+                       CorpusFormat* format) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    ///\throw numOfTests, config and format should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+    assert(numOfTests    != NULL);
+    assert(config        != NULL);
+    assert(format        != NULL);
+
+    *numOfTests = 0;
+    setDefaultCorpusConfig(config);
+    *format = findCommandIndex(manager, GEN_BINARY_FLAG_SHORT, GEN_BINARY_FLAG_EXTENDED) != -1 ?
+              CORPUS_FORMAT_BINARY : CORPUS_FORMAT_TEXT;
+
+    size_t seed = (size_t)config->seed;
+    if (!parseNumberArgument(manager, GENERATE_FLAG_SHORT, GENERATE_FLAG_EXTENDED, MAX_NUM_OF_GENERATED_TESTS, numOfTests) ||
+        !parseNumberArgument(manager, GEN_SEED_FLAG_SHORT, GEN_SEED_FLAG_EXTENDED, ULONG_MAX, &seed))
+        return false;
+    config->seed = seed;
+
+    int ind = findCommandIndex(manager, GEN_MIX_FLAG_SHORT, GEN_MIX_FLAG_EXTENDED);
+    if (ind == -1)
+        return true;
+    if (!checkGoodParams(manager, ind, 1) || parseCorpusMix(manager->argv[ind + 1], config) != QUAD_EQ_ERRORS_OK) {
+        QUAD_EQ_LOG_ERROR("%s", INCORRECT_USER_INPUT_ERROR);
+        printError("%s", INCORRECT_USER_INPUT_ERROR);
+        return false;
+    }
+    return true;
+}
+
+bool isGenerateNeeded(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager != NULL);
+    assert(manager->argv != NULL);
+
+    return findCommandIndex(manager, GENERATE_FLAG_SHORT, GENERATE_FLAG_EXTENDED) != -1;
+}
+
 // FIXME: this function is not very stable
 bool parseUserInput(const ArgsManager* manager, QuadraticEquation* eq) {
     ///\throw manager should not be NULL
@@ -170,21 +424,21 @@ bool parseUserInput(const ArgsManager* manager, QuadraticEquation* eq) {
 
     const int numNeededArgs = 1;
     if (!checkGoodParams(manager, ind, numNeededArgs)) {
-        LOG_ERROR("%s", USER_INPUT_ARGUMENTS_ERROR);
+        QUAD_EQ_LOG_ERROR("%s", USER_INPUT_ARGUMENTS_ERROR);
         printError("%s", USER_INPUT_ARGUMENTS_ERROR);
         return false;
     }
 
     char* line = (char*)calloc(strlen(manager->argv[ind + 1]) + 2, sizeof(*manager->argv[ind + 1]));
     if (line == NULL)
-        LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
+        QUAD_EQ_LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
     strcpy(line, manager->argv[ind + 1]);
 
     int cntBlanks = 0;
     for (int i = 0; i < (int)strlen(line); ++i)
         cntBlanks += isblank(line[i]);
     if (cntBlanks != 2) {
-        LOG_ERROR("%s", USER_INPUT_ARGUMENTS_ERROR);
+        QUAD_EQ_LOG_ERROR("%s", USER_INPUT_ARGUMENTS_ERROR);
         printError("%s", USER_INPUT_ARGUMENTS_ERROR);
         return false;
     }
@@ -195,7 +449,7 @@ bool parseUserInput(const ArgsManager* manager, QuadraticEquation* eq) {
     long double* const arr[3] = {&eq->a, &eq->b, &eq->c};
     char* word = (char*)calloc(strlen(line) + 1, sizeof(*line));
     if (word == NULL)
-        LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
+        QUAD_EQ_LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
     eq->outputPrecision = DEFAULT_PRECISION; // global const STD_PRECISION
     // printf("word : %s, len : %d\n", word, strlen(word));
 
@@ -211,12 +465,12 @@ bool parseUserInput(const ArgsManager* manager, QuadraticEquation* eq) {
         QuadEqErrors error = parseLongDoubleAndCheckValid(word, arr[argInd], &isOk);
 
         if (error) {
-            LOG_ERROR("%s", getErrorMessage(error));
+            QUAD_EQ_LOG_ERROR("%s", getErrorMessage(error));
             printError("%s", getErrorMessage(error));
             return false;
         }
         if (!isOk) {
-            LOG_ERROR("%s", getErrorMessage(error));
+            QUAD_EQ_LOG_ERROR("%s", getErrorMessage(error));
             printError("%s", INCORRECT_USER_INPUT_ERROR);
             return false;
         }
@@ -229,6 +483,62 @@ bool parseUserInput(const ArgsManager* manager, QuadraticEquation* eq) {
     return true;
 }
 
+bool parseUserInputExact(const ArgsManager* manager, IntegerQuadraticEquation* eq) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    ///\throw eq should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+    assert(eq != NULL);
+
+    int ind = findCommandIndex(manager, USER_FLAG_SHORT, USER_FLAG_EXTENDED);
+    if (ind == -1 || !checkGoodParams(manager, ind, 1)) {
+        QUAD_EQ_LOG_ERROR("%s", USER_INPUT_ARGUMENTS_ERROR);
+        printError("%s", USER_INPUT_ARGUMENTS_ERROR);
+        return false;
+    }
+
+    char* line = (char*)calloc(strlen(manager->argv[ind + 1]) + 1, sizeof(char));
+    if (line == NULL) {
+        QUAD_EQ_LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
+        return false;
+    }
+    strcpy(line, manager->argv[ind + 1]);
+
+    // 3 -> cnt of coefficient of quadratic equation
+    ExactRational coefs[3] = {};
+    int argInd = 0;
+    bool isOk = true;
+    for (char* word = strtok(line, " \t"); word != NULL && isOk; word = strtok(NULL, " \t")) {
+        if (argInd == 3) {
+            isOk = false;
+            break;
+        }
+        parseExactCoef(word, &coefs[argInd++], &isOk);
+    }
+    free(line);
+
+    if (isOk && argInd == 3)
+        buildIntegerEquation(coefs, eq, &isOk);
+    if (!isOk || argInd != 3) {
+        QUAD_EQ_LOG_ERROR("%s", INCORRECT_USER_INPUT_ERROR);
+        printError("%s", INCORRECT_USER_INPUT_ERROR);
+        return false;
+    }
+
+    return true;
+}
+
+bool isExactModeNeeded(const ArgsManager* manager) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager != NULL);
+    assert(manager->argv != NULL);
+
+    int ind = findCommandIndex(manager, EXACT_FLAG_SHORT, EXACT_FLAG_EXTENDED);
+    return ind != -1;
+}
+
 bool isHelpNeeded(const ArgsManager* manager) {
     ///\throw manager should not be NULL
     ///\throw manager->argv should not be NULL
@@ -239,6 +549,40 @@ bool isHelpNeeded(const ArgsManager* manager) {
     return ind != -1;
 }
 
+/**
+    \brief parses flag, that has optional file argument
+    \param[out] isFound does flag occur in arguments
+    \result heap allocated file name, NULL if it's not stated
+*/
+static char* parseFlagWithOptionalFile(const ArgsManager* manager, const char* flagShort, const char* flagExtended,
+                                       bool* isFound) {
+    assert(manager != NULL);
+    assert(manager->argv != NULL);
+    assert(isFound != NULL);
+
+    char* fileName = {};
+    int ind = findCommandIndex(manager, flagShort, flagExtended);
+    if (ind == -1) {
+        *isFound = false;
+        return NULL;
+    }
+
+    *isFound = true;
+    const int cntNeedArgs = 1;
+    bool isGood = checkGoodParams(manager, ind, cntNeedArgs);
+    if (isGood) {
+        fileName = (char*)calloc(strlen(manager->argv[ind + 1]) + 1, sizeof(*(manager->argv[ind + 1])));
+        if (fileName == NULL) {
+            QUAD_EQ_LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
+            return NULL;
+        }
+        strcpy(fileName, manager->argv[ind + 1]);
+        return fileName;
+    }
+
+    return NULL;
+}
+
 /// @brief
 /// @param manager
 /// @param isTest
@@ -251,23 +595,42 @@ char* parseTestsArgs(const ArgsManager* manager, bool* isTest) {
     assert(manager->argv != NULL);
     assert(isTest != NULL);
 
-    char* outputFile = {};
-    int ind = findCommandIndex(manager, TESTS_FLAG_SHORT, TESTS_FLAG_EXTENDED);
-    if (ind == -1) {
-        *isTest = false;
-        return NULL;
-    }
+    return parseFlagWithOptionalFile(manager, TESTS_FLAG_SHORT, TESTS_FLAG_EXTENDED, isTest);
+}
 
-    *isTest = true;
-    const int cntNeedArgs = 1;
-    bool isGood = checkGoodParams(manager, ind, cntNeedArgs);
-    if (isGood) {
-        outputFile = (char*)calloc(strlen(manager->argv[ind + 1]) + 1, sizeof(*(manager->argv[ind + 1])));
-        if (outputFile == NULL)
-            LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
-        strcpy(outputFile, manager->argv[ind + 1]);
-        return outputFile;
-    }
+/// @note The returning pointer is heap-allocated, do not forget to free!
+char* parseBatchArgs(const ArgsManager* manager, bool* isBatch) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager != NULL);
+    assert(manager->argv != NULL);
+    assert(isBatch != NULL);
 
-    return NULL;
+    return parseFlagWithOptionalFile(manager, BATCH_FLAG_SHORT, BATCH_FLAG_EXTENDED, isBatch);
+}
+
+/// @note The returning pointer is heap-allocated, do not forget to free!
+char* parseAccuracyArgs(const ArgsManager* manager, bool* isAccuracy) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    assert(manager != NULL);
+    assert(manager->argv != NULL);
+    assert(isAccuracy != NULL);
+
+    return parseFlagWithOptionalFile(manager, ACCURACY_FLAG_SHORT, ACCURACY_FLAG_EXTENDED, isAccuracy);
+}
+
+bool parseMaxUlpArg(const ArgsManager* manager, double* maxUlp) {
+    ///\throw manager should not be NULL
+    ///\throw manager->argv should not be NULL
+    ///\throw maxUlp should not be NULL
+    assert(manager       != NULL);
+    assert(manager->argv != NULL);
+    assert(maxUlp        != NULL);
+
+    size_t value = 0;
+    if (!parseNumberArgument(manager, MAX_ULP_FLAG_SHORT, MAX_ULP_FLAG_EXTENDED, MAX_ULP_LIMIT, &value))
+        return false;
+    *maxUlp = (double)value;
+    return true;
 }
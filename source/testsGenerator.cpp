@@ -19,6 +19,8 @@
 #include "../LoggerLib/include/logLib.hpp"
 #include "../include/quadraticEquation.hpp"
 #include "../include/testsGenerator.hpp"
+#include "../include/testsLoader.hpp"
+#include "../include/errorReporting.hpp"
 
 /// @brief error occurs if there are too few tests and testIndex is bigger than number of tests
 const char* TOO_FEW_TESTS_ERROR           = "Error: there are too few tests\n";
@@ -35,9 +37,9 @@ const char* INVALID_FILE_ERROR            = "Error: invalid file name (or couldn
 /// @brief error occures if memory is not allocated during calloc or malloc
 const char* const MEMORY_ALLOCATION_ERROR = "Error: couldn't allocate memory\n";
 
-const int LINE_BUFFER_SIZE = 256;
-const char BREAK_CHAR = '#';
-const char* INF_ROOTS_IN_FILE = "inf\n";
+/// @brief if there are more tests, only their number is printed by validateTester()
+const int MAX_NUM_OF_PRINTED_TESTS = 100;
+
 
 
 //   a        b       c precision root_1           root_2           cnt_of_roots
@@ -74,7 +76,6 @@ const Test* getMyTests(Tester* tester) {
     \param[in] one, two answers from getSolutions func and tests
     \result are two answer equal
 */
-                                        // FIXME: принято  vvv src                               ref
 static bool checkIfAnswerEqual(const QuadraticEquationAnswer* mine, const QuadraticEquationAnswer* corr) {
     ///\throw mine should not be NULL
     ///\throw corr should not be NULL
@@ -89,13 +90,13 @@ static bool checkIfAnswerEqual(const QuadraticEquationAnswer* mine, const Quadra
         case INFINITE_ROOTS:
             return true;
         case TWO_ROOTS:
-            if (sign(corr->root_1 - corr->root_1) != 0)
+            if (sign(mine->root_1 - corr->root_1) != 0)
                 return false;
         case ONE_ROOT:
             return (sign(mine->root_2 - corr->root_2) == 0);
         default:
             assert(false);
-            LOG_ERROR("%s", ILLEGAL_ARG_ERROR);
+            QUAD_EQ_LOG_ERROR("%s", ILLEGAL_ARG_ERROR);
             break;
     }
     return false;
@@ -113,25 +114,65 @@ CheckOnTestsOutput checkOnTests(const Tester* tester) {
     assert(tester->tests != NULL);
 
     CheckOnTestsOutput result = {};
+    size_t cntOfTests = (size_t)tester->cntOfTests;
+    QuadraticEquation*       equations = (QuadraticEquation*)      calloc(cntOfTests + 1, sizeof(QuadraticEquation));
+    QuadraticEquationAnswer* answers   = (QuadraticEquationAnswer*)calloc(cntOfTests + 1, sizeof(QuadraticEquationAnswer));
+    QuadEqErrors*            errors    = (QuadEqErrors*)           calloc(cntOfTests + 1, sizeof(QuadEqErrors));
+    if (equations == NULL || answers == NULL || errors == NULL) {
+        QUAD_EQ_LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
+        printError("%s", MEMORY_ALLOCATION_ERROR);
+        free(equations);
+        free(answers);
+        free(errors);
+        result.state = FAILED_ON_SOME_TEST;
+        result.error = QUAD_EQ_ERRORS_MEMORY_ALLOCATION;
+        return result;
+    }
+
+    // all tests are solved first (in parallel if tester has pool), then they are checked in order
+    for (size_t i = 0; i < cntOfTests; ++i)
+        equations[i] = tester->tests[i].equation;
+    QuadEqErrors error = getSolutionsParallel(tester->pool, tester->GetSolutionsFunc, equations, answers, errors,
+                                              cntOfTests);
+    // if nothing was solved (for example, tasks couldn't be started), errors of tests are not filled
+    bool isErrorOfTest = false;
+    for (size_t i = 0; error != QUAD_EQ_ERRORS_OK && i < cntOfTests && !isErrorOfTest; ++i)
+        isErrorOfTest = errors[i] != QUAD_EQ_ERRORS_OK;
+    if (error != QUAD_EQ_ERRORS_OK && !isErrorOfTest)
+        errors[0] = error;
+
     for (int i = 0; i < tester->cntOfTests; ++i) {
-        QuadraticEquationAnswer answer = {};
+        QuadraticEquationAnswer answer = answers[i];
         Test test = tester->tests[i];
-        (*tester->GetSolutionsFunc)(&test.equation, &answer);
-        if (!checkIfAnswerEqual(&answer, &test.answer)) {
-            printf("Failed on test: #%d\n", i);
-            printf("Test (expected):\n");
-            printTest(tester, &test);
-            printf("Yours (wrong):\n");
-            printSolutions(&answer, DEFAULT_PRECISION, NULL);
+        if (errors[i] != QUAD_EQ_ERRORS_OK || !checkIfAnswerEqual(&answer, &test.answer)) {
+            if (!tester->isQuiet) {
+                printf("Failed on test: #%d\n", i);
+                printf("Test (expected):\n");
+                printTest(tester, &test);
+                printf("Yours (wrong):\n");
+                if (errors[i] != QUAD_EQ_ERRORS_OK)
+                    printf("%s", getErrorMessage(errors[i]));
+                else
+                    printSolutions(&answer, DEFAULT_PRECISION, NULL);
+            }
 
             result.testIndex = i;
             result.state = FAILED_ON_SOME_TEST;
+            result.error = errors[i];
+            free(equations);
+            free(answers);
+            free(errors);
             return result;
         }
     }
+    free(equations);
+    free(answers);
+    free(errors);
 
-    changeTextColor(GREEN_COLOR);
-    colourfullPrint("All tests passed\n");
+    if (!tester->isQuiet) {
+        changeTextColor(GREEN_COLOR);
+        colourfullPrint("All tests passed\n");
+    }
     result.state = ALL_TESTS_PASSED;
     return result;
 }
@@ -175,7 +216,7 @@ void printTestWithInd(const Tester* tester, int testIndex) {
     assert(tester != NULL && tester->tests != NULL);
 
     if (testIndex >= tester->cntOfTests) {
-        LOG_ERROR("%s", TOO_FEW_TESTS_ERROR);
+        QUAD_EQ_LOG_ERROR("%s", TOO_FEW_TESTS_ERROR);
         printError("%s", TOO_FEW_TESTS_ERROR);
         return;
     }
@@ -208,14 +249,14 @@ static bool isValidTest(const Test* test) {
         case TWO_ROOTS:
             error = getPointValue(&test->equation, test->answer.root_1, &val);
             if (error) {
-                LOG_ERROR("%s", getErrorMessage(error));
+                QUAD_EQ_LOG_ERROR("%s", getErrorMessage(error));
                 printError("%s", getErrorMessage(error));
             }
             if (sign(val)) return false;
         case ONE_ROOT:
             error = getPointValue(&test->equation, test->answer.root_2, &val);
             if (error) {
-                LOG_ERROR("%s", getErrorMessage(error));
+                QUAD_EQ_LOG_ERROR("%s", getErrorMessage(error));
                 printError("%s", getErrorMessage(error));
             }
             if (sign(val)) return false;
@@ -227,7 +268,7 @@ static bool isValidTest(const Test* test) {
 
         default:
             assert(false);
-            LOG_ERROR("%s", ILLEGAL_ARG_ERROR);
+            QUAD_EQ_LOG_ERROR("%s", ILLEGAL_ARG_ERROR);
             printError("%s", ILLEGAL_ARG_ERROR);
             break;
     }
@@ -235,162 +276,26 @@ static bool isValidTest(const Test* test) {
     return true;
 }
 
-static bool isFileLineGood(const char* line) {
-    const char* newLinePtr = strchr(line, '\n');
-    if (newLinePtr == NULL) { // error
-        return false;
-    }
-
-    newLinePtr = strchr(newLinePtr + 1, '\n');
-    if (newLinePtr != NULL) // error
-        return false;
-    return true;
-}
-
-static int getCntOfTestsInSourceFile(FILE* source) {
-    ///\throw testsFileSource should not be NULL
-    assert(source != NULL);
-
-    if (source == NULL) {
-        LOG_ERROR("%s", INVALID_FILE_ERROR);
-        printError("%s", INVALID_FILE_ERROR);
-        return -1;
-    }
-
-    int cntOfTests = 0;
-    char line[LINE_BUFFER_SIZE] = {};
-    while (fgets(line, sizeof(line), source)) {
-        if (!isFileLineGood(line))
-            return -1;
-        cntOfTests += line[0] == BREAK_CHAR;
-    }
-
-    return cntOfTests;
-}
-
-static void modifyCurrentTest(Test* currentTest, int varInd, long double number) {
-    switch (varInd) {
-        case 0: currentTest->equation.a    = number; break;
-        case 1: currentTest->equation.b    = number; break;
-        case 2: currentTest->equation.c    = number; break;
-        case 3: currentTest->answer.root_1 = number; [[fallthrough]]
-        case 4: currentTest->answer.root_2 = number; break;
-
-        default:
-            LOG_ERROR("%s", ILLEGAL_ARG_ERROR);
-            printError("%s", ILLEGAL_ARG_ERROR);
-            assert(false);
-            break;
-    }
-}
-
-static void chooseNumOfSols(QuadEqRootState* numOfSols, int varInd) {
-    switch (varInd) {
-        case 3: *numOfSols = NO_ROOTS;  break;
-        case 4: *numOfSols = ONE_ROOT;  break;
-        case 5: *numOfSols = TWO_ROOTS; break;
-
-        default:
-            LOG_ERROR("%s", ILLEGAL_ARG_ERROR);
-            printError("%s", ILLEGAL_ARG_ERROR);
-            assert(false);
-            break;
-    }
-}
-
-static void readTestsFromSourceFile(Tester* tester, FILE* source, int cntOfTests) {
-    ///\throw testsFileSource should not be NULL
-    ///\throw tests should not be NULL
-    assert(source != NULL);
-    assert(tester != NULL);
-    assert(cntOfTests > 0);
-
-    rewind(source);
-    if (source == NULL) {
-        LOG_ERROR("%s", INVALID_FILE_ERROR);
-        printError("%s", INVALID_FILE_ERROR);
-        return;
-    }
-
-    Test* testsCopy = (Test*)calloc((size_t)cntOfTests, sizeof(Test));
-    if (testsCopy == NULL)
-        LOG_ERROR("%s", MEMORY_ALLOCATION_ERROR);
-
-    //tester->tests = testsCopy;
-
-    bool isInf = false;
-    int  varInd = 0;
-    int testInd = 0;
-    Test currentTest = {};
-    char line[LINE_BUFFER_SIZE] = {};
-
-    // if error, first we close file (source) and then return
-    #define FAIL_AND_RETURN()       \
-        do {                        \
-            free(testsCopy);        \
-            tester->tests = NULL;   \
-            return;                 \
-        } while(0);
-
-    while (fgets(line, sizeof(line), source)) {
-        if (!isFileLineGood(line))
-            FAIL_AND_RETURN();
-
-        if (line[0] == BREAK_CHAR) {
-            if (!isInf)
-                chooseNumOfSols(&currentTest.answer.numOfSols, varInd);
-            else
-                currentTest.answer.numOfSols = INFINITE_ROOTS;
-
-            currentTest.equation.outputPrecision = DEFAULT_PRECISION;
-            testsCopy[testInd++] = currentTest;
-            varInd = 0;
-            isInf = false;
-            continue;
-        }
-
-        if (strcmp(line, INF_ROOTS_IN_FILE) == 0) {
-            isInf = true;
-            continue;
-        }
-
-        bool isOk = false;
-        long double number = 0.0;
-        parseLongDoubleAndCheckValid(line, &number, &isOk);
-        if (!isOk)
-            FAIL_AND_RETURN();
-
-        modifyCurrentTest(&currentTest, varInd, number);
-        ++varInd;
-    }
-
-    tester->cntOfTests = testInd;
-    tester->membuffer = testsCopy;
-    tester->tests = (const Test*)testsCopy;
-}
-
 static void readTests(Tester* tester, const char* testsFileSource) {
     ///\throw tester should not be NULL
     ///\throw testsFileSource should not be NULL
     assert(tester != NULL);
     assert(testsFileSource != NULL);
 
-    FILE* source = fopen(testsFileSource, "r");
-    if (source == NULL) {
-        LOG_ERROR("%s", INVALID_FILE_ERROR);
+    // file is parsed in one pass (in parallel, if tester has pool), without counting of tests first
+    TestsArena arena = {};
+    QuadEqErrors error = loadTestsFile(testsFileSource, tester->pool, &arena);
+    if (error != QUAD_EQ_ERRORS_OK || arena.count == 0) {
+        QUAD_EQ_LOG_ERROR("%s", INVALID_FILE_ERROR);
         printError("%s", INVALID_FILE_ERROR);
+        freeTestsArena(&arena);
+        tester->tests = NULL;
         return;
     }
 
-    // Пометка менторам: не давать пока что онегина, пусть пока так
-    int cntOfTests = getCntOfTestsInSourceFile(source);
-    if (cntOfTests == -1) { // error
-        fclose(source);
-        return;
-    }
-
-    readTestsFromSourceFile(tester, source, cntOfTests);
-    fclose(source);
+    tester->cntOfTests = (int)arena.count;
+    tester->membuffer  = arena.tests;
+    tester->tests      = (const Test*)arena.tests;
 }
 
 void validateTester(Tester* tester, const char* testsFileSource) {
@@ -407,7 +312,11 @@ void validateTester(Tester* tester, const char* testsFileSource) {
         return;
 
     int arrLen = tester->cntOfTests;
-    printAllTests(tester);
+    // big generated corpora are not printed, it would take much longer than loading
+    if (arrLen <= MAX_NUM_OF_PRINTED_TESTS)
+        printAllTests(tester);
+    else
+        printf("Loaded %d tests\n", arrLen);
 
     // checking that tests are good
     for (int i = 0; i < arrLen; ++i) {
@@ -415,8 +324,8 @@ void validateTester(Tester* tester, const char* testsFileSource) {
         if (!isValidTest(test)) {
             printTest(tester, test);
 
-            LOG_ERROR("Test: %d\n", i);
-            LOG_ERROR("%s", VALIDATION_FAIL_ERROR);
+            QUAD_EQ_LOG_ERROR("Test: %d\n", i);
+            QUAD_EQ_LOG_ERROR("%s", VALIDATION_FAIL_ERROR);
             printError("Test: %d\n", i);
             printError("%s", VALIDATION_FAIL_ERROR);
             return;
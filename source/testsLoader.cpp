@@ -0,0 +1,316 @@
+/**
+    \file
+    \brief realization of single pass loader of tests file
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/testsLoader.hpp"
+#include "../include/mappedInput.hpp"
+#include "../include/corpusGenerator.hpp"
+#include "../include/errorReporting.hpp"
+
+const size_t TESTS_ARENA_INITIAL_CAPACITY = 1024;
+/// @brief line of test, that says, that equation has infinitely many roots
+const char   INF_ROOTS_LINE[]             = "inf";
+const char   TESTS_BREAK_CHAR             = '#';
+/// @brief lower estimate of size of test in text (tests of small integers take ~17 bytes, generated corpora ~40 bytes)
+const size_t TESTS_ESTIMATED_TEST_SIZE    = 16;
+/// @brief a, b, c and at most 2 roots
+const int    MAX_NUM_OF_TEST_NUMBERS      = 5;
+
+QuadEqErrors pushTestToArena(struct TestsArena* arena, const struct Test* test) {
+    ///\throw arena should not be NULL
+    ///\throw test should not be NULL
+    assert(arena != NULL);
+    assert(test != NULL);
+
+    if (arena == NULL || test == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (arena->count == arena->capacity) {
+        QuadEqErrors error = reserveTestsArena(arena, arena->capacity == 0 ? TESTS_ARENA_INITIAL_CAPACITY
+                                                                             : 2 * arena->capacity);
+        if (error != QUAD_EQ_ERRORS_OK)
+            return error;
+    }
+    arena->tests[arena->count++] = *test;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors reserveTestsArena(struct TestsArena* arena, size_t capacity) {
+    ///\throw arena should not be NULL
+    assert(arena != NULL);
+
+    if (arena == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (capacity <= arena->capacity)
+        return QUAD_EQ_ERRORS_OK;
+
+    Test* newTests = (Test*)realloc(arena->tests, capacity * sizeof(Test));
+    if (newTests == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+    arena->tests    = newTests;
+    arena->capacity = capacity;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+void freeTestsArena(struct TestsArena* arena) {
+    if (arena == NULL)
+        return;
+    free(arena->tests);
+    *arena = {};
+}
+
+/// @brief maximum number of digits of integer, that is parsed without parseNumberFast()
+const int MAX_FAST_INTEGER_DIGITS = 18;
+
+/**
+    \brief parses number, integers (most of numbers in generated tests) are parsed without from_chars()
+    \result false if [begin, end) is not a number
+*/
+static inline bool parseTestNumber(const char* begin, const char* end, long double* number) {
+    const char* digits = begin + (begin < end && (*begin == '-' || *begin == '+'));
+    if (digits < end && end - digits <= MAX_FAST_INTEGER_DIGITS) {
+        long long value = 0;
+        const char* position = digits;
+        for (; position < end && (unsigned)(*position - '0') < 10; ++position)
+            value = value * 10 + (*position - '0');
+        // integer is rounded to double, same as parseNumberFast() rounds it ("-0" stays negative zero)
+        if (position == end) {
+            double rounded = (double)value;
+            *number = *begin == '-' ? -rounded : rounded;
+            return true;
+        }
+    }
+
+    bool isOk = false;
+    parseNumberFast(begin, end, number, &isOk);
+    return isOk;
+}
+
+/// @brief number of numbers in test -> number of roots
+static bool getNumOfSols(int numOfNumbers, bool isInf, QuadEqRootState* numOfSols) {
+    if (isInf) {
+        *numOfSols = INFINITE_ROOTS;
+        return numOfNumbers == 3;
+    }
+
+    switch (numOfNumbers) {
+        case 3: *numOfSols = NO_ROOTS;  return true;
+        case 4: *numOfSols = ONE_ROOT;  return true;
+        case 5: *numOfSols = TWO_ROOTS; return true;
+        default:
+            return false;
+    }
+}
+
+QuadEqErrors parseTestsText(const char* begin, const char* end, struct TestsArena* arena) {
+    ///\throw begin, end and arena should not be NULL
+    assert(begin != NULL);
+    assert(end != NULL);
+    assert(arena != NULL);
+
+    if (begin == NULL || end == NULL || arena == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    // text is not scanned twice: arena is reserved by size of text (pages, that stay unused, are never touched),
+    // tests of unusually short lines grow it by doubling in pushTestToArena()
+    QuadEqErrors error = reserveTestsArena(arena, arena->count + (size_t)(end - begin) / TESTS_ESTIMATED_TEST_SIZE);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    long double numbers[MAX_NUM_OF_TEST_NUMBERS] = {};
+    int  numOfNumbers = 0;
+    bool isInf        = false;
+
+    const char* line = begin;
+    while (line < end) {
+        // lines are short, so simple loop is faster than call of memchr()
+        const char* lineEnd = line;
+        while (lineEnd < end && *lineEnd != '\n')
+            ++lineEnd;
+        // every line should fit into buffer of old reader, last line can have no '\n'
+        if ((size_t)(lineEnd - line) + 1 > TESTS_LOADER_MAX_LINE_LEN)
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_INPUT_LINE_TOO_LONG);
+        const char* next = lineEnd == end ? end : lineEnd + 1;
+
+        if (*line == TESTS_BREAK_CHAR) {
+            Test test = {};
+            if (!getNumOfSols(numOfNumbers, isInf, &test.answer.numOfSols))
+                LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_EQUATION);
+
+            test.equation = {numbers[0], numbers[1], numbers[2], DEFAULT_PRECISION};
+            // one root is written once, but it's both root_1 and root_2
+            test.answer.root_1 = numOfNumbers > 3 ? numbers[3] : 0;
+            test.answer.root_2 = numOfNumbers > 4 ? numbers[4] : test.answer.root_1;
+
+            error = pushTestToArena(arena, &test);
+            if (error != QUAD_EQ_ERRORS_OK)
+                return error;
+            numOfNumbers = 0;
+            isInf = false;
+            line = next;
+            continue;
+        }
+
+        if ((size_t)(lineEnd - line) == sizeof(INF_ROOTS_LINE) - 1 &&
+            memcmp(line, INF_ROOTS_LINE, sizeof(INF_ROOTS_LINE) - 1) == 0) {
+            isInf = true;
+            line = next;
+            continue;
+        }
+
+        // blanks around number are skipped, same as parseLongDoubleAndCheckValid() does
+        const char* numberBegin = line;
+        const char* numberEnd   = lineEnd;
+        while (numberEnd > numberBegin && isblank(numberEnd[-1]))
+            --numberEnd;
+        while (numberBegin < numberEnd && isspace(*numberBegin))
+            ++numberBegin;
+
+        if (numOfNumbers >= MAX_NUM_OF_TEST_NUMBERS || !parseTestNumber(numberBegin, numberEnd, &numbers[numOfNumbers]))
+            LOG_AND_RETURN(QUAD_EQ_ERRORS_INCORRECT_COEF_FORMAT);
+        ++numOfNumbers;
+        line = next;
+    }
+
+    // lines after last '#' don't form a test, they are ignored
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief part of file, that is parsed by one task
+struct TestsFilePart {
+    const char*  begin;
+    const char*  end;
+    TestsArena   arena;
+    QuadEqErrors error;
+};
+
+/// @brief returns pointer after line with '#', that starts at position or after it, end if there is no such line
+static const char* findTestsBreak(const char* begin, const char* position, const char* end) {
+    if (position > begin && position[-1] != '\n') {
+        position = (const char*)memchr(position, '\n', (size_t)(end - position));
+        if (position == NULL)
+            return end;
+        ++position;
+    }
+
+    while (position < end) {
+        const char* lineEnd = (const char*)memchr(position, '\n', (size_t)(end - position));
+        if (lineEnd == NULL)
+            return end;
+        if (*position == TESTS_BREAK_CHAR)
+            return lineEnd + 1;
+        position = lineEnd + 1;
+    }
+    return end;
+}
+
+static void parseTestsParts(void* context, size_t begin, size_t end) {
+    TestsFilePart* parts = (TestsFilePart*)context;
+    for (size_t i = begin; i < end; ++i)
+        parts[i].error = parseTestsText(parts[i].begin, parts[i].end, &parts[i].arena);
+}
+
+/// @brief parses text in parallel, parts are joined in order of file
+static QuadEqErrors parseTestsTextParallel(const char* text, size_t size, struct ThreadPool* pool,
+                                           struct TestsArena* arena) {
+    size_t numOfParts = 4 * getThreadPoolSize(pool);
+    if (numOfParts > size / TESTS_LOADER_MIN_PART_SIZE)
+        numOfParts = size / TESTS_LOADER_MIN_PART_SIZE;
+    if (numOfParts <= 1)
+        return parseTestsText(text, text + size, arena);
+
+    TestsFilePart* parts = (TestsFilePart*)calloc(numOfParts, sizeof(TestsFilePart));
+    if (parts == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+
+    const char* end = text + size;
+    const char* partBegin = text;
+    for (size_t i = 0; i < numOfParts; ++i) {
+        parts[i].begin = partBegin;
+        parts[i].end   = i + 1 == numOfParts ? end : findTestsBreak(text, text + size / numOfParts * (i + 1), end);
+        if (parts[i].end < partBegin)
+            parts[i].end = partBegin;
+        partBegin = parts[i].end;
+    }
+
+    QuadEqErrors error = runParallelFor(pool, numOfParts, 1, parseTestsParts, parts);
+    size_t numOfTests = 0;
+    for (size_t i = 0; i < numOfParts; ++i) {
+        if (error == QUAD_EQ_ERRORS_OK)
+            error = parts[i].error;
+        numOfTests += parts[i].arena.count;
+    }
+
+    // arenas of parts are copied into one, so tests are contiguous, as Tester needs
+    if (error == QUAD_EQ_ERRORS_OK && numOfTests > 0) {
+        arena->tests = (Test*)malloc(numOfTests * sizeof(Test));
+        if (arena->tests == NULL) {
+            error = QUAD_EQ_ERRORS_MEMORY_ALLOCATION;
+        } else {
+            arena->capacity = numOfTests;
+            for (size_t i = 0; i < numOfParts; ++i) {
+                memcpy(arena->tests + arena->count, parts[i].arena.tests, parts[i].arena.count * sizeof(Test));
+                arena->count += parts[i].arena.count;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < numOfParts; ++i)
+        freeTestsArena(&parts[i].arena);
+    free(parts);
+    if (error != QUAD_EQ_ERRORS_OK)
+        LOG_AND_RETURN(error);
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors loadTestsFile(const char* fileName, struct ThreadPool* pool, struct TestsArena* arena) {
+    ///\throw fileName should not be NULL
+    ///\throw arena should not be NULL
+    assert(fileName != NULL);
+    assert(arena != NULL);
+
+    if (fileName == NULL || arena == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    *arena = {};
+
+    int fd = open(fileName, O_RDONLY);
+    if (fd == -1)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) == -1 || !S_ISREG(fileStat.st_mode)) {
+        close(fd);
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    }
+
+    size_t size = (size_t)fileStat.st_size;
+    if (size == 0) {
+        close(fd);
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    void* text = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (text == MAP_FAILED)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_INVALID_FILE);
+    // whole file is read once, parts are read by different threads from different places
+    madvise(text, size, MADV_WILLNEED);
+
+    // binary corpus (see corpusGenerator.hpp) is recognized by it's magic, it's copied without parsing
+    QuadEqErrors error = isCorpusBinary(text, size) ? parseCorpusBinary(text, size, arena) :
+                                                      parseTestsTextParallel((const char*)text, size, pool, arena);
+    munmap(text, size);
+    if (error != QUAD_EQ_ERRORS_OK)
+        freeTestsArena(arena);
+    return error;
+}
@@ -0,0 +1,389 @@
+/**
+    \file
+    \brief realization of work stealing pool of threads
+
+    Range of chunks [begin, end) of every thread is packed into one 64-bit atomic (begin in low half, end in high half),
+    owner takes chunk from the front: (begin, end) -> (begin + 1, end),
+    thief takes back half: (begin, end) -> (begin, middle) and processes [middle, end) as it's own range.
+    Both operations are done by compare and swap of the whole word, so every chunk is taken exactly once.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "../include/threadPool.hpp"
+#include "../include/quadraticSolverCore.hpp"
+#include "../include/errorReporting.hpp"
+
+const size_t CACHE_LINE_SIZE = 64;
+
+/// @brief range of chunks of one thread, every range is on it's own cache line, so threads don't share lines
+struct alignas(CACHE_LINE_SIZE) WorkerRange {
+    std::atomic<uint64_t> range; ///< begin | (end << 32)
+};
+
+struct ThreadPool {
+    size_t       numOfThreads; ///< including calling thread
+    std::thread* workers;      ///< numOfThreads - 1 threads
+    WorkerRange* ranges;       ///< range of every thread, 0 is calling thread
+
+    std::mutex              mutex;
+    std::condition_variable jobStarted;
+    std::condition_variable jobFinished;
+    uint64_t jobNumber;      ///< increased when new job is started
+    size_t   numOfRunning;   ///< number of workers, that haven't finished current job
+    bool     isStopping;
+
+    // current job
+    ParallelTaskFunc task;
+    void*            context;
+    size_t           count;
+    size_t           chunkSize;
+};
+
+static uint64_t packRange(uint64_t begin, uint64_t end) {
+    return begin | (end << 32);
+}
+
+static uint64_t getRangeBegin(uint64_t range) {
+    return range & UINT32_MAX;
+}
+
+static uint64_t getRangeEnd(uint64_t range) {
+    return range >> 32;
+}
+
+/// @brief takes chunk from the front of own range
+static bool popOwnChunk(WorkerRange* own, uint64_t* chunk) {
+    uint64_t range = own->range.load(std::memory_order_acquire);
+    while (getRangeBegin(range) < getRangeEnd(range)) {
+        uint64_t begin = getRangeBegin(range);
+        if (own->range.compare_exchange_weak(range, packRange(begin + 1, getRangeEnd(range)),
+                                             std::memory_order_acq_rel)) {
+            *chunk = begin;
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief steals back half of range of some other thread, result becomes own range
+static bool stealRange(ThreadPool* pool, size_t self) {
+    for (size_t shift = 1; shift < pool->numOfThreads; ++shift) {
+        WorkerRange* victim = &pool->ranges[(self + shift) % pool->numOfThreads];
+        uint64_t range = victim->range.load(std::memory_order_acquire);
+        while (getRangeBegin(range) < getRangeEnd(range)) {
+            uint64_t begin  = getRangeBegin(range);
+            uint64_t end    = getRangeEnd(range);
+            uint64_t middle = begin + (end - begin) / 2;
+            if (victim->range.compare_exchange_weak(range, packRange(begin, middle), std::memory_order_acq_rel)) {
+                // own range is empty, so nobody can change it now
+                pool->ranges[self].range.store(packRange(middle, end), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// @brief processes chunks until there is nothing to take or steal
+static void processJob(ThreadPool* pool, size_t self) {
+    assert(pool != NULL);
+
+    while (true) {
+        uint64_t chunk = 0;
+        if (popOwnChunk(&pool->ranges[self], &chunk)) {
+            size_t begin = (size_t)chunk * pool->chunkSize;
+            size_t end   = begin + pool->chunkSize < pool->count ? begin + pool->chunkSize : pool->count;
+            pool->task(pool->context, begin, end);
+            continue;
+        }
+
+        if (!stealRange(pool, self))
+            return;
+    }
+}
+
+static void runWorker(ThreadPool* pool, size_t self) {
+    uint64_t lastJobNumber = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(pool->mutex);
+            pool->jobStarted.wait(lock, [&] { return pool->isStopping || pool->jobNumber != lastJobNumber; });
+            if (pool->isStopping)
+                return;
+            lastJobNumber = pool->jobNumber;
+        }
+
+        processJob(pool, self);
+
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if (--pool->numOfRunning == 0)
+            pool->jobFinished.notify_one();
+    }
+}
+
+QuadEqErrors createThreadPool(size_t numOfThreads, struct ThreadPool** pool) {
+    ///\throw pool should not be NULL
+    assert(pool != NULL);
+
+    if (pool == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (numOfThreads == 0)
+        numOfThreads = std::thread::hardware_concurrency();
+    if (numOfThreads == 0)
+        numOfThreads = 1;
+
+    ThreadPool* result = new (std::nothrow) ThreadPool();
+    if (result == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+
+    result->numOfThreads = numOfThreads;
+    result->ranges  = new (std::nothrow) WorkerRange[numOfThreads];
+    result->workers = new (std::nothrow) std::thread[numOfThreads - 1];
+    if (result->ranges == NULL || result->workers == NULL) {
+        delete[] result->ranges;
+        delete[] result->workers;
+        delete result;
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_MEMORY_ALLOCATION);
+    }
+
+    for (size_t i = 0; i < numOfThreads; ++i)
+        result->ranges[i].range.store(0, std::memory_order_relaxed);
+    for (size_t i = 1; i < numOfThreads; ++i)
+        result->workers[i - 1] = std::thread(runWorker, result, i);
+
+    *pool = result;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+QuadEqErrors destroyThreadPool(struct ThreadPool* pool) {
+    if (pool == NULL)
+        return QUAD_EQ_ERRORS_OK;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->isStopping = true;
+    }
+    pool->jobStarted.notify_all();
+    for (size_t i = 0; i + 1 < pool->numOfThreads; ++i)
+        pool->workers[i].join();
+
+    delete[] pool->workers;
+    delete[] pool->ranges;
+    delete pool;
+    return QUAD_EQ_ERRORS_OK;
+}
+
+size_t getThreadPoolSize(const struct ThreadPool* pool) {
+    return pool == NULL ? 1 : pool->numOfThreads;
+}
+
+QuadEqErrors runParallelFor(struct ThreadPool* pool, size_t count, size_t chunkSize,
+                            ParallelTaskFunc task, void* context) {
+    ///\throw task should not be NULL
+    assert(task != NULL);
+
+    if (task == NULL || chunkSize == 0)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    if (count == 0)
+        return QUAD_EQ_ERRORS_OK;
+
+    // ranges are stored in 32 bits
+    while ((count + chunkSize - 1) / chunkSize > UINT32_MAX)
+        chunkSize *= 2;
+    size_t numOfChunks = (count + chunkSize - 1) / chunkSize;
+
+    if (getThreadPoolSize(pool) == 1 || numOfChunks == 1) {
+        for (size_t begin = 0; begin < count; begin += chunkSize)
+            task(context, begin, begin + chunkSize < count ? begin + chunkSize : count);
+        return QUAD_EQ_ERRORS_OK;
+    }
+
+    size_t numOfThreads = pool->numOfThreads;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->task      = task;
+        pool->context   = context;
+        pool->count     = count;
+        pool->chunkSize = chunkSize;
+        for (size_t i = 0; i < numOfThreads; ++i)
+            pool->ranges[i].range.store(packRange(numOfChunks * i / numOfThreads, numOfChunks * (i + 1) / numOfThreads),
+                                        std::memory_order_relaxed);
+        pool->numOfRunning = numOfThreads - 1;
+        ++pool->jobNumber;
+    }
+    pool->jobStarted.notify_all();
+
+    processJob(pool, 0);
+
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    pool->jobFinished.wait(lock, [&] { return pool->numOfRunning == 0; });
+    return QUAD_EQ_ERRORS_OK;
+}
+
+/// @brief arguments of getSolutionsParallel()
+struct SolveContext {
+    getSolutionsFuncPtr            solver;
+    const QuadraticEquation*       equations;
+    QuadraticEquationAnswer*       answers;
+    QuadEqErrors*                  errors;
+    /// index of first failed equation and it's error: (index << 8) | error, UINT64_MAX if there are no errors
+    std::atomic<uint64_t>          firstError;
+};
+
+static void solveChunk(void* context, size_t begin, size_t end) {
+    SolveContext* solve = (SolveContext*)context;
+    for (size_t i = begin; i < end; ++i) {
+        QuadEqErrors error = solve->solver(&solve->equations[i], &solve->answers[i]);
+        if (solve->errors != NULL)
+            solve->errors[i] = error;
+        if (error == QUAD_EQ_ERRORS_OK)
+            continue;
+
+        uint64_t packed = ((uint64_t)i << 8) | (uint64_t)error;
+        uint64_t current = solve->firstError.load(std::memory_order_relaxed);
+        while (packed < current && !solve->firstError.compare_exchange_weak(current, packed, std::memory_order_relaxed))
+            ;
+    }
+}
+
+QuadEqErrors getSolutionsParallel(struct ThreadPool* pool, getSolutionsFuncPtr solver,
+                                  const struct QuadraticEquation* equations, struct QuadraticEquationAnswer* answers,
+                                  QuadEqErrors* errors, size_t count) {
+    ///\throw solver should not be NULL
+    ///\throw equations should not be NULL
+    ///\throw answers should not be NULL
+    assert(solver != NULL);
+    assert(equations != NULL || count == 0);
+    assert(answers != NULL || count == 0);
+
+    if (solver == NULL || ((equations == NULL || answers == NULL) && count != 0))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    SolveContext context = {solver, equations, answers, errors, {UINT64_MAX}};
+    QuadEqErrors error = runParallelFor(pool, count, PARALLEL_CHUNK_SIZE, solveChunk, &context);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+
+    uint64_t firstError = context.firstError.load(std::memory_order_relaxed);
+    return firstError == UINT64_MAX ? QUAD_EQ_ERRORS_OK : (QuadEqErrors)(firstError & 0xFF);
+}
+
+/// @brief arguments of getSolutionsBatchParallel()
+struct BatchContext {
+    const QuadraticEquationBatch* batch;
+    QuadraticEquationBatchAnswer* answer;
+    std::atomic<bool>             isValid;
+};
+
+static void validateBatchChunk(void* context, size_t begin, size_t end) {
+    BatchContext* solve = (BatchContext*)context;
+    const QuadraticEquationBatch* batch = solve->batch;
+    for (size_t i = begin; i < end; ++i) {
+        if (!isCoefValidT<long double>(batch->a[i]) || !isCoefValidT<long double>(batch->b[i]) ||
+            !isCoefValidT<long double>(batch->c[i])) {
+            solve->isValid.store(false, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+static void solveBatchChunk(void* context, size_t begin, size_t end) {
+    BatchContext* solve = (BatchContext*)context;
+    const QuadraticEquationBatch* batch  = solve->batch;
+    QuadraticEquationBatchAnswer* answer = solve->answer;
+    for (size_t i = begin; i < end; ++i) {
+        answer->root_1[i] = answer->root_2[i] = 0;
+        solveValidatedEquationT<long double>(batch->a[i], batch->b[i], batch->c[i],
+                                             &answer->root_1[i], &answer->root_2[i], &answer->numOfSols[i]);
+    }
+}
+
+QuadEqErrors getSolutionsBatchParallel(struct ThreadPool* pool, const struct QuadraticEquationBatch* batch,
+                                       struct QuadraticEquationBatchAnswer* answer) {
+    ///\throw batch and all of it's arrays should not be NULL
+    ///\throw answer and all of it's arrays should not be NULL
+    assert(batch != NULL);
+    assert(answer != NULL);
+
+    if (batch == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (batch->count == 0)
+        return QUAD_EQ_ERRORS_OK;
+    if (batch->a == NULL || batch->b == NULL || batch->c == NULL ||
+        answer->root_1 == NULL || answer->root_2 == NULL || answer->numOfSols == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    BatchContext context = {batch, answer, {true}};
+    QuadEqErrors error = runParallelFor(pool, batch->count, PARALLEL_CHUNK_SIZE, validateBatchChunk, &context);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+    if (!context.isValid.load(std::memory_order_relaxed))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    return runParallelFor(pool, batch->count, PARALLEL_CHUNK_SIZE, solveBatchChunk, &context);
+}
+
+/// @brief arguments of getSolutionsBatchSimdParallel()
+struct SimdBatchContext {
+    const QuadraticEquationDoubleBatch* batch;
+    QuadraticEquationDoubleBatchAnswer* answer;
+    std::atomic<bool>                   isValid;
+};
+
+static void validateSimdBatchChunk(void* context, size_t begin, size_t end) {
+    SimdBatchContext* solve = (SimdBatchContext*)context;
+    const QuadraticEquationDoubleBatch* batch = solve->batch;
+    for (size_t i = begin; i < end; ++i) {
+        if (!isCoefValidT<double>(batch->a[i]) || !isCoefValidT<double>(batch->b[i]) ||
+            !isCoefValidT<double>(batch->c[i])) {
+            solve->isValid.store(false, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+static void solveSimdBatchChunk(void* context, size_t begin, size_t end) {
+    SimdBatchContext* solve = (SimdBatchContext*)context;
+    const QuadraticEquationDoubleBatch* batch  = solve->batch;
+    QuadraticEquationDoubleBatchAnswer* answer = solve->answer;
+
+    QuadraticEquationDoubleBatch       chunk       = {end - begin, batch->a + begin, batch->b + begin, batch->c + begin};
+    QuadraticEquationDoubleBatchAnswer chunkAnswer = {answer->root_1 + begin, answer->root_2 + begin,
+                                                      answer->numOfSols + begin};
+    // chunk is already validated, so there can't be any errors
+    getSolutionsBatchSimd(&chunk, &chunkAnswer);
+}
+
+QuadEqErrors getSolutionsBatchSimdParallel(struct ThreadPool* pool, const struct QuadraticEquationDoubleBatch* batch,
+                                           struct QuadraticEquationDoubleBatchAnswer* answer) {
+    ///\throw batch and all of it's arrays should not be NULL
+    ///\throw answer and all of it's arrays should not be NULL
+    assert(batch != NULL);
+    assert(answer != NULL);
+
+    if (batch == NULL || answer == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+    if (batch->count == 0)
+        return QUAD_EQ_ERRORS_OK;
+    if (batch->a == NULL || batch->b == NULL || batch->c == NULL ||
+        answer->root_1 == NULL || answer->root_2 == NULL || answer->numOfSols == NULL)
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_ILLEGAL_ARG);
+
+    SimdBatchContext context = {batch, answer, {true}};
+    QuadEqErrors error = runParallelFor(pool, batch->count, PARALLEL_CHUNK_SIZE, validateSimdBatchChunk, &context);
+    if (error != QUAD_EQ_ERRORS_OK)
+        return error;
+    if (!context.isValid.load(std::memory_order_relaxed))
+        LOG_AND_RETURN(QUAD_EQ_ERRORS_VALUE_IS_TOO_BIG);
+
+    return runParallelFor(pool, batch->count, PARALLEL_CHUNK_SIZE, solveSimdBatchChunk, &context);
+}
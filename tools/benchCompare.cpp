@@ -0,0 +1,267 @@
+/**
+    \file
+    \brief compares speed of solver functions with saved baseline (see benchmarks/solverMicrobench.hpp)
+
+    Usage:
+    \code
+    benchCompare --save FILE [--reps N]                                      run suite and save it as baseline
+    benchCompare --baseline FILE [--threshold PCT] [--save FILE] [--reps N]  run suite and compare it with baseline
+    benchCompare --baseline FILE --current FILE [--threshold PCT]            compare two saved reports
+    \endcode
+
+    Samples of every case (function on class of input) are compared by two-sided Mann-Whitney U test.
+    Size of change is Hodges-Lehmann estimate (median of all pairwise differences current - baseline), it's
+    confidence interval is taken from order statistics of these differences. Case is regression, if p-value is
+    less than COMPARE_ALPHA and the whole confidence interval is slower than baseline by more than threshold.
+    Exit code is 0 if there are no regressions, 1 if there are, 2 on wrong usage or unreadable report.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../benchmarks/solverMicrobench.hpp"
+
+const size_t NUM_OF_RESULTS            = MICROBENCH_NUM_OF_FUNCTIONS * MICROBENCH_NUM_OF_CLASSES;
+/// @brief significance level of test, confidence interval has level 1 - COMPARE_ALPHA
+const double COMPARE_ALPHA             = 0.05;
+/// @brief quantile of normal distribution for 1 - COMPARE_ALPHA / 2
+const double COMPARE_Z                 = 1.959963984540054;
+/// @brief change of latency (in percents of baseline median), that is ignored even if it's significant
+const double COMPARE_DEFAULT_THRESHOLD = 5;
+/// @brief more samples than `make bench` takes, so small changes are significant
+const int    COMPARE_DEFAULT_REPS      = 31;
+
+/// @brief verdict of one case
+enum CompareVerdict {
+    COMPARE_SAME       = 0, ///< difference is not significant or is within threshold
+    COMPARE_FASTER     = 1,
+    COMPARE_REGRESSION = 2,
+    COMPARE_MISSING    = 3, ///< case has no samples in one of reports
+};
+
+const char* const COMPARE_VERDICT_NAMES[] = {"same", "faster", "REGRESSION", "missing"};
+
+/// @brief comparison of one case
+struct CaseComparison {
+    double         pValue;
+    double         shiftNs;         ///< Hodges-Lehmann estimate of current - baseline, ns per call
+    double         lowerNs;         ///< confidence interval of shift
+    double         upperNs;
+    double         changePercent;   ///< shift relative to baseline median
+    CompareVerdict verdict;
+};
+
+struct CompareArgs {
+    const char* baselineFile;
+    const char* currentFile;
+    const char* saveFile;
+    double      threshold;
+    int         numOfRepetitions;
+};
+
+static int compareDoubles(const void* first, const void* second) {
+    double firstValue  = *(const double*)first;
+    double secondValue = *(const double*)second;
+    return (firstValue > secondValue) - (firstValue < secondValue);
+}
+
+/// @brief value with it's sample, so ranks can be given after sorting of both samples
+struct RankedValue {
+    double value;
+    bool   isBaseline;
+};
+
+static int compareRankedValues(const void* first, const void* second) {
+    return compareDoubles(&((const RankedValue*)first)->value, &((const RankedValue*)second)->value);
+}
+
+/**
+    \brief two-sided Mann-Whitney U test with normal approximation, correction for ties and continuity
+    \result p-value
+*/
+static double getMannWhitneyPValue(const MicrobenchResult* baseline, const MicrobenchResult* current) {
+    int n1 = baseline->numOfSamples;
+    int n2 = current->numOfSamples;
+    int n  = n1 + n2;
+
+    RankedValue values[2 * MICROBENCH_MAX_REPETITIONS] = {};
+    for (int i = 0; i < n1; ++i)
+        values[i] = {baseline->samples[i], true};
+    for (int i = 0; i < n2; ++i)
+        values[n1 + i] = {current->samples[i], false};
+    qsort(values, (size_t)n, sizeof(RankedValue), compareRankedValues);
+
+    // equal values get average of their ranks
+    double baselineRankSum = 0;
+    double tiesSum         = 0;
+    for (int i = 0; i < n; ) {
+        int j = i;
+        while (j < n && values[j].value == values[i].value)
+            ++j;
+        double rank = (i + 1 + j) / 2.0;
+        for (int k = i; k < j; ++k)
+            if (values[k].isBaseline)
+                baselineRankSum += rank;
+        double tieSize = j - i;
+        tiesSum += tieSize * tieSize * tieSize - tieSize;
+        i = j;
+    }
+
+    double u        = baselineRankSum - n1 * (n1 + 1) / 2.0;
+    double mean     = n1 * (double)n2 / 2;
+    double variance = n1 * (double)n2 / 12 * ((n + 1) - tiesSum / (n * (double)(n - 1)));
+    if (variance <= 0)
+        return 1;
+
+    double deviation = fabs(u - mean) - 0.5;
+    if (deviation < 0)
+        deviation = 0;
+    return erfc(deviation / sqrt(variance) / sqrt(2.0));
+}
+
+/// @brief Hodges-Lehmann estimate of shift and it's confidence interval (Moses method)
+static bool getShiftEstimate(const MicrobenchResult* baseline, const MicrobenchResult* current,
+                             CaseComparison* comparison) {
+    int n1 = baseline->numOfSamples;
+    int n2 = current->numOfSamples;
+    size_t numOfDiffs = (size_t)n1 * (size_t)n2;
+
+    double* diffs = (double*)calloc(numOfDiffs, sizeof(double));
+    if (diffs == NULL)
+        return false;
+    for (int i = 0; i < n2; ++i)
+        for (int j = 0; j < n1; ++j)
+            diffs[(size_t)i * (size_t)n1 + (size_t)j] = current->samples[i] - baseline->samples[j];
+    qsort(diffs, numOfDiffs, sizeof(double), compareDoubles);
+
+    comparison->shiftNs = numOfDiffs % 2 == 1 ? diffs[numOfDiffs / 2] :
+                          (diffs[numOfDiffs / 2 - 1] + diffs[numOfDiffs / 2]) / 2;
+
+    // k smallest and k biggest differences are outside of interval
+    double k = n1 * (double)n2 / 2 - COMPARE_Z * sqrt(n1 * (double)n2 * (n1 + n2 + 1) / 12);
+    size_t lower = k < 1 ? 0 : (size_t)k - 1;
+    if (lower > numOfDiffs / 2)
+        lower = numOfDiffs / 2;
+    comparison->lowerNs = diffs[lower];
+    comparison->upperNs = diffs[numOfDiffs - 1 - lower];
+
+    free(diffs);
+    return true;
+}
+
+static void compareCase(const MicrobenchResult* baseline, const MicrobenchResult* current, double threshold,
+                        CaseComparison* comparison) {
+    *comparison = {};
+    if (baseline->numOfSamples < 2 || current->numOfSamples < 2 || baseline->median <= 0 ||
+        !getShiftEstimate(baseline, current, comparison)) {
+        comparison->verdict = COMPARE_MISSING;
+        return;
+    }
+
+    comparison->pValue        = getMannWhitneyPValue(baseline, current);
+    comparison->changePercent = comparison->shiftNs / baseline->median * 100;
+
+    double lowerPercent = comparison->lowerNs / baseline->median * 100;
+    double upperPercent = comparison->upperNs / baseline->median * 100;
+    if (comparison->pValue < COMPARE_ALPHA && lowerPercent > threshold)
+        comparison->verdict = COMPARE_REGRESSION;
+    else if (comparison->pValue < COMPARE_ALPHA && upperPercent < -threshold)
+        comparison->verdict = COMPARE_FASTER;
+    else
+        comparison->verdict = COMPARE_SAME;
+}
+
+/// @brief prints comparison of all cases, returns number of regressions
+static int printComparison(const MicrobenchResult* baseline, const MicrobenchResult* current, double threshold) {
+    printf("%-28s %-12s %10s %10s %9s %21s %9s %10s\n", "function", "class", "base ns", "current ns",
+           "change %", "95% CI of shift (ns)", "p-value", "verdict");
+
+    int numOfRegressions = 0;
+    for (size_t i = 0; i < NUM_OF_RESULTS; ++i) {
+        CaseComparison comparison = {};
+        compareCase(&baseline[i], &current[i], threshold, &comparison);
+        numOfRegressions += comparison.verdict == COMPARE_REGRESSION;
+
+        printf("%-28s %-12s %10.2f %10.2f %+9.2f  [%+8.2f, %+8.2f] %9.2g %10s\n",
+               MICROBENCH_FUNCTION_NAMES[current[i].function], MICROBENCH_CLASS_NAMES[current[i].inputClass],
+               baseline[i].median, current[i].median, comparison.changePercent,
+               comparison.lowerNs, comparison.upperNs, comparison.pValue, COMPARE_VERDICT_NAMES[comparison.verdict]);
+    }
+
+    printf("%d regression(s), threshold %.1f%%, significance level %.2f\n", numOfRegressions, threshold, COMPARE_ALPHA);
+    return numOfRegressions;
+}
+
+static bool parseCompareArgs(int argc, const char* const argv[], CompareArgs* args) {
+    args->threshold        = COMPARE_DEFAULT_THRESHOLD;
+    args->numOfRepetitions = COMPARE_DEFAULT_REPS;
+
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc)
+            return false;
+        const char* value = argv[++i];
+        if      (strcmp(argv[i - 1], "--baseline")  == 0) args->baselineFile     = value;
+        else if (strcmp(argv[i - 1], "--current")   == 0) args->currentFile      = value;
+        else if (strcmp(argv[i - 1], "--save")      == 0) args->saveFile         = value;
+        else if (strcmp(argv[i - 1], "--threshold") == 0) args->threshold        = atof(value);
+        else if (strcmp(argv[i - 1], "--reps")      == 0) args->numOfRepetitions = atoi(value);
+        else
+            return false;
+    }
+
+    if (args->numOfRepetitions < 2 || args->numOfRepetitions > MICROBENCH_MAX_REPETITIONS || args->threshold < 0)
+        return false;
+    if (args->currentFile != NULL && (args->baselineFile == NULL || args->saveFile != NULL))
+        return false;
+    return args->baselineFile != NULL || args->saveFile != NULL;
+}
+
+int main(int argc, const char* const argv[]) {
+    CompareArgs args = {};
+    if (!parseCompareArgs(argc, argv, &args)) {
+        fprintf(stderr, "Usage: %s --save FILE [--reps N]\n"
+                        "       %s --baseline FILE [--threshold PCT] [--save FILE] [--reps N]\n"
+                        "       %s --baseline FILE --current FILE [--threshold PCT]\n", argv[0], argv[0], argv[0]);
+        return 2;
+    }
+
+    static MicrobenchResult baseline[NUM_OF_RESULTS] = {};
+    static MicrobenchResult current [NUM_OF_RESULTS] = {};
+    if (args.baselineFile != NULL && readMicrobenchJson(args.baselineFile, baseline) != QUAD_EQ_ERRORS_OK) {
+        fprintf(stderr, "Error: couldn't read report %s\n", args.baselineFile);
+        return 2;
+    }
+
+    if (args.currentFile != NULL) {
+        if (readMicrobenchJson(args.currentFile, current) != QUAD_EQ_ERRORS_OK) {
+            fprintf(stderr, "Error: couldn't read report %s\n", args.currentFile);
+            return 2;
+        }
+    } else {
+        MicrobenchConfig config = getDefaultMicrobenchConfig();
+        config.numOfRepetitions = args.numOfRepetitions;
+        if (runMicrobenchSuite(&config, current) != QUAD_EQ_ERRORS_OK) {
+            fprintf(stderr, "Error: couldn't run benchmarks\n");
+            return 2;
+        }
+
+        if (args.saveFile != NULL) {
+            FILE* file = fopen(args.saveFile, "w");
+            if (file == NULL) {
+                fprintf(stderr, "Error: couldn't open %s\n", args.saveFile);
+                return 2;
+            }
+            writeMicrobenchJson(current, NUM_OF_RESULTS, &config, file);
+            fclose(file);
+            printf("Report is saved to %s\n", args.saveFile);
+        }
+    }
+
+    if (args.baselineFile == NULL) {
+        printMicrobenchResults(current, NUM_OF_RESULTS, stdout);
+        return 0;
+    }
+    return printComparison(baseline, current, args.threshold) > 0 ? 1 : 0;
+}
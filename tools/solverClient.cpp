@@ -0,0 +1,115 @@
+/**
+    \file
+    \brief client of solver server (libRun --serve socket)
+
+    Usage: solverClient socket [source]
+
+    Reads records "a b c" (one per line) from source file (or stdin), sends them to server in requests of
+    CLIENT_CHUNK_SIZE equations and prints one result line per record in the same format as libRun --batch.
+    Records with too big coefficients are printed as "error" and are not sent, so server never rejects request.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../include/solverServer.hpp"
+#include "../include/resultWriter.hpp"
+#include "../include/batchMode.hpp"
+#include "../include/quadraticSolverCore.hpp"
+
+/// @brief number of records in one request
+const size_t CLIENT_CHUNK_SIZE = 1 << 16;
+/// @brief maximum length of record
+const size_t CLIENT_LINE_SIZE  = 1024;
+
+/// @brief records of one request, malformed records are not sent
+struct ClientChunk {
+    size_t           numOfRecords;
+    bool             isMalformed[CLIENT_CHUNK_SIZE];
+    double           a        [CLIENT_CHUNK_SIZE];
+    double           b        [CLIENT_CHUNK_SIZE];
+    double           c        [CLIENT_CHUNK_SIZE];
+    double           root_1   [CLIENT_CHUNK_SIZE];
+    double           root_2   [CLIENT_CHUNK_SIZE];
+    QuadEqRootState  numOfSols[CLIENT_CHUNK_SIZE];
+};
+
+/// @brief solves all well formed records of chunk on server and prints results
+static bool flushChunk(int fd, ClientChunk* chunk, ResultWriter* output) {
+    size_t count = 0;
+    for (size_t i = 0; i < chunk->numOfRecords; ++i) {
+        if (chunk->isMalformed[i])
+            continue;
+        chunk->a[count] = chunk->a[i];
+        chunk->b[count] = chunk->b[i];
+        chunk->c[count] = chunk->c[i];
+        ++count;
+    }
+
+    QuadraticEquationDoubleBatch       batch  = {count, chunk->a, chunk->b, chunk->c};
+    QuadraticEquationDoubleBatchAnswer answer = {chunk->root_1, chunk->root_2, chunk->numOfSols};
+    QuadEqErrors error = solveOnSolverServer(fd, &batch, &answer);
+    if (error == QUAD_EQ_ERRORS_INVALID_FILE || error == QUAD_EQ_ERRORS_MEMORY_ALLOCATION)
+        return false;
+
+    for (size_t i = 0, index = 0; i < chunk->numOfRecords; ++i) {
+        if (chunk->isMalformed[i] || error != QUAD_EQ_ERRORS_OK) {
+            writeResultChars(output, "error\n", 6);
+            continue;
+        }
+        printBatchResult(output, chunk->numOfSols[index], chunk->root_1[index], chunk->root_2[index],
+                         DEFAULT_PRECISION);
+        ++index;
+    }
+    chunk->numOfRecords = 0;
+    return true;
+}
+
+int main(int argc, const char* const argv[]) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s socket [source]\n", argv[0]);
+        return 1;
+    }
+
+    FILE* input = argc == 3 ? fopen(argv[2], "r") : stdin;
+    if (input == NULL) {
+        fprintf(stderr, "Error: couldn't open file %s\n", argv[2]);
+        return 1;
+    }
+
+    ClientChunk* chunk = (ClientChunk*)calloc(1, sizeof(ClientChunk));
+    int fd = -1;
+    ResultWriter output = {};
+    if (chunk == NULL || connectToSolverServer(argv[1], &fd) != QUAD_EQ_ERRORS_OK ||
+        openResultWriter(NULL, &output) != QUAD_EQ_ERRORS_OK) {
+        free(chunk);
+        disconnectFromSolverServer(fd);
+        if (input != stdin)
+            fclose(input);
+        return 1;
+    }
+
+    bool isOk = true;
+    char line[CLIENT_LINE_SIZE] = {};
+    while (isOk && fgets(line, sizeof(line), input) != NULL) {
+        size_t index = chunk->numOfRecords++;
+        char extra = 0;
+        chunk->isMalformed[index] = sscanf(line, "%lf %lf %lf %c", &chunk->a[index], &chunk->b[index],
+                                           &chunk->c[index], &extra) != 3 ||
+                                    !isCoefValidT<double>(chunk->a[index]) || !isCoefValidT<double>(chunk->b[index]) ||
+                                    !isCoefValidT<double>(chunk->c[index]);
+        if (chunk->numOfRecords == CLIENT_CHUNK_SIZE)
+            isOk = flushChunk(fd, chunk, &output);
+    }
+    if (isOk && chunk->numOfRecords != 0)
+        isOk = flushChunk(fd, chunk, &output);
+    if (!isOk)
+        fprintf(stderr, "Error: connection to server is lost\n");
+
+    isOk = closeResultWriter(&output) == QUAD_EQ_ERRORS_OK && isOk;
+    disconnectFromSolverServer(fd);
+    free(chunk);
+    if (input != stdin)
+        fclose(input);
+    return isOk ? 0 : 1;
+}